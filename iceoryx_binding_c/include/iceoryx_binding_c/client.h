@@ -142,6 +142,27 @@ ENUM iox_ChunkReceiveResult iox_client_take_response(iox_client_t const self, co
 /// @param[in] payload pointer to the user-payload of chunk which should be released
 void iox_client_release_response(iox_client_t const self, const void* const payload);
 
+/// @brief retrieve multiple received responses with one call
+/// @param[in] self handle to the client
+/// @param[in] payloads array of at least maxNumberOfResponses elements in which the pointers to the user-payloads of
+///            the responses are stored, the oldest response first
+/// @param[in] maxNumberOfResponses the maximum number of responses which are retrieved
+/// @param[in] numberOfResponses pointer in which the number of retrieved responses is stored
+/// @return if at least one response could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+ENUM iox_ChunkReceiveResult iox_client_take_responses(iox_client_t const self,
+                                                      const void** const payloads,
+                                                      const uint64_t maxNumberOfResponses,
+                                                      uint64_t* const numberOfResponses);
+
+/// @brief release multiple previously acquired responses (via iox_client_take_response or iox_client_take_responses)
+/// @param[in] self handle to the client
+/// @param[in] payloads array of pointers to the user-payloads of the responses which should be released
+/// @param[in] numberOfResponses the number of elements in payloads
+void iox_client_release_responses(iox_client_t const self,
+                                  const void* const* const payloads,
+                                  const uint64_t numberOfResponses);
+
 /// @brief release all responses which are stored in the chunk queue
 /// @param[in] self handle to the client
 void iox_client_release_queued_responses(iox_client_t const self);
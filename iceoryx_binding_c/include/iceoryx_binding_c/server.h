@@ -43,6 +43,9 @@ typedef struct
     /// @brief Sets whether the server blocks when the client response queue is full
     ENUM iox_ConsumerTooSlowPolicy clientTooSlowPolicy;
 
+    /// @brief maximum number of requests which can be held simultaneously, e.g. by multiple threads
+    uint64_t maxRequestsInFlight;
+
     /// @brief this value will be set exclusively by `iox_server_options_init` and is not supposed to be modified
     /// otherwise
     uint64_t initCheck;
@@ -91,6 +94,27 @@ ENUM iox_ServerRequestResult iox_server_take_request(iox_server_t const self, co
 /// @param[in] payload pointer to the user-payload of chunk which should be released
 void iox_server_release_request(iox_server_t const self, const void* const payload);
 
+/// @brief retrieve multiple received requests with one call
+/// @param[in] self handle to the server
+/// @param[in] payloads array of at least maxNumberOfRequests elements in which the pointers to the user-payloads of
+///            the requests are stored, the oldest request first
+/// @param[in] maxNumberOfRequests the maximum number of requests which are retrieved
+/// @param[in] numberOfRequests pointer in which the number of retrieved requests is stored
+/// @return if at least one request could be received it returns ServerRequestResult_SUCCESS otherwise
+///         an enum which describes the error
+ENUM iox_ServerRequestResult iox_server_take_requests(iox_server_t const self,
+                                                      const void** const payloads,
+                                                      const uint64_t maxNumberOfRequests,
+                                                      uint64_t* const numberOfRequests);
+
+/// @brief release multiple previously acquired requests (via iox_server_take_request or iox_server_take_requests)
+/// @param[in] self handle to the server
+/// @param[in] payloads array of pointers to the user-payloads of the requests which should be released
+/// @param[in] numberOfRequests the number of elements in payloads
+void iox_server_release_requests(iox_server_t const self,
+                                 const void* const* const payloads,
+                                 const uint64_t numberOfRequests);
+
 /// @brief allocates a response in the shared memory
 /// @param[in] self handle of the server
 /// @param[in] requestPayload pointer to the payload of the received request
@@ -111,6 +111,26 @@ ENUM iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void*
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload);
 
+/// @brief retrieve multiple received chunks with one call
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array of at least maxNumberOfChunks elements in which the pointers to the user-payloads
+///            of the chunks are stored, the oldest chunk first
+/// @param[in] maxNumberOfChunks the maximum number of chunks which are retrieved
+/// @param[in] numberOfChunks pointer in which the number of retrieved chunks is stored
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error; if maxNumberOfChunks is 0, no chunk is retrieved, numberOfChunks is set
+///         to 0 and ChunkReceiveResult_SUCCESS is returned
+ENUM iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t maxNumberOfChunks,
+                                                uint64_t* const numberOfChunks);
+
+/// @brief release multiple previously acquired chunks (via iox_sub_take_chunk or iox_sub_take_chunks)
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be released
+/// @param[in] numberOfChunks the number of elements in userPayloads
+void iox_sub_release_chunks(iox_sub_t const self, const void* const* const userPayloads, const uint64_t numberOfChunks);
+
 /// @brief release all chunks which are stored in the chunk queue
 /// @param[in] self handle to the subscriber
 void iox_sub_release_queued_chunks(iox_sub_t const self);
@@ -75,6 +75,14 @@ uint64_t iox_ws_size(iox_ws_t const self);
 /// @brief returns the maximum amount of events/states which can be registered at the waitset
 uint64_t iox_ws_capacity(iox_ws_t const self);
 
+/// @brief returns a file descriptor which becomes readable whenever the waitset is notified; it can be added to the
+///        epoll set of an external event loop which calls iox_ws_timed_wait with a timeout of zero when it is readable
+/// @param[in] self handle to the wait set
+/// @param[out] fileDescriptor the file descriptor, it is owned by the wait set and must not be read or closed
+/// @return WaitSetResult_SUCCESS or WaitSetResult_UNABLE_TO_CREATE_FILE_DESCRIPTOR, e.g. on a platform other than
+///         Linux
+ENUM iox_WaitSetResult iox_ws_get_file_descriptor(iox_ws_t const self, int* const fileDescriptor);
+
 /// @brief Non-reversible call. After this call iox_ws_wait() and iox_ws_timed_wait() do
 ///        not block any longer and never return triggered events/states. This
 ///        function can be used to manually initialize destruction and to wakeup
@@ -178,6 +178,39 @@ void iox_client_release_response(iox_client_t const self, const void* const payl
     self->releaseResponse(payload);
 }
 
+iox_ChunkReceiveResult iox_client_take_responses(iox_client_t const self,
+                                                 const void** const payloads,
+                                                 const uint64_t maxNumberOfResponses,
+                                                 uint64_t* const numberOfResponses)
+{
+    iox::cxx::Expects(self != nullptr);
+    iox::cxx::Expects(payloads != nullptr);
+    iox::cxx::Expects(numberOfResponses != nullptr);
+
+    *numberOfResponses = 0U;
+    auto result = self->takeMultiple(payloads, maxNumberOfResponses);
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.get_error());
+    }
+
+    *numberOfResponses = result.value();
+    return ChunkReceiveResult_SUCCESS;
+}
+
+void iox_client_release_responses(iox_client_t const self,
+                                  const void* const* const payloads,
+                                  const uint64_t numberOfResponses)
+{
+    iox::cxx::Expects(self != nullptr);
+    iox::cxx::Expects(payloads != nullptr || numberOfResponses == 0U);
+
+    for (uint64_t i = 0U; i < numberOfResponses; ++i)
+    {
+        self->releaseResponse(payloads[i]);
+    }
+}
+
 void iox_client_release_queued_responses(iox_client_t const self)
 {
     iox::cxx::Expects(self != nullptr);
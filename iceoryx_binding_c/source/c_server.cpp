@@ -43,6 +43,7 @@ void iox_server_options_init(iox_server_options_t* const options)
     options->offerOnCreate = serverOptions.offerOnCreate;
     options->requestQueueFullPolicy = cpp2c::queueFullPolicy(serverOptions.requestQueueFullPolicy);
     options->clientTooSlowPolicy = cpp2c::consumerTooSlowPolicy(serverOptions.clientTooSlowPolicy);
+    options->maxRequestsInFlight = serverOptions.maxRequestsInFlight;
     options->initCheck = SERVER_OPTIONS_INIT_CHECK_CONSTANT;
 }
 
@@ -73,6 +74,7 @@ iox_server_t iox_server_init(iox_server_storage_t* self,
         serverOptions.offerOnCreate = options->offerOnCreate;
         serverOptions.requestQueueFullPolicy = c2cpp::queueFullPolicy(options->requestQueueFullPolicy);
         serverOptions.clientTooSlowPolicy = c2cpp::consumerTooSlowPolicy(options->clientTooSlowPolicy);
+        serverOptions.maxRequestsInFlight = options->maxRequestsInFlight;
     }
 
     auto* me = new UntypedServer(ServiceDescription{IdString_t(TruncateToCapacity, service),
@@ -113,6 +115,38 @@ void iox_server_release_request(iox_server_t const self, const void* const paylo
     self->releaseRequest(payload);
 }
 
+iox_ServerRequestResult iox_server_take_requests(iox_server_t const self,
+                                                 const void** const payloads,
+                                                 const uint64_t maxNumberOfRequests,
+                                                 uint64_t* const numberOfRequests)
+{
+    iox::cxx::Expects(self != nullptr);
+    iox::cxx::Expects(payloads != nullptr);
+    iox::cxx::Expects(numberOfRequests != nullptr);
+
+    *numberOfRequests = 0U;
+    auto result = self->takeMultiple(payloads, maxNumberOfRequests);
+    if (result.has_error())
+    {
+        return cpp2c::serverRequestResult(result.get_error());
+    }
+    *numberOfRequests = result.value();
+    return ServerRequestResult_SUCCESS;
+}
+
+void iox_server_release_requests(iox_server_t const self,
+                                 const void* const* const payloads,
+                                 const uint64_t numberOfRequests)
+{
+    iox::cxx::Expects(self != nullptr);
+    iox::cxx::Expects(payloads != nullptr || numberOfRequests == 0U);
+
+    for (uint64_t i = 0U; i < numberOfRequests; ++i)
+    {
+        self->releaseRequest(payloads[i]);
+    }
+}
+
 iox_AllocationResult iox_server_loan_response(iox_server_t const self,
                                               const void* const requestPayload,
                                               void** const payload,
@@ -168,6 +168,44 @@ void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
     SubscriberPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t maxNumberOfChunks,
+                                           uint64_t* const numberOfChunks)
+{
+    iox::cxx::Expects(userPayloads != nullptr);
+    iox::cxx::Expects(numberOfChunks != nullptr);
+
+    *numberOfChunks = 0U;
+    if (maxNumberOfChunks == 0U)
+    {
+        return ChunkReceiveResult_SUCCESS;
+    }
+
+    auto result = SubscriberPortUser(self->m_portData)
+                      .tryGetChunks(maxNumberOfChunks, [&](const ChunkHeader* chunkHeader) {
+                          userPayloads[*numberOfChunks] = chunkHeader->userPayload();
+                          ++(*numberOfChunks);
+                      });
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.get_error());
+    }
+
+    return ChunkReceiveResult_SUCCESS;
+}
+
+void iox_sub_release_chunks(iox_sub_t const self, const void* const* const userPayloads, const uint64_t numberOfChunks)
+{
+    iox::cxx::Expects(userPayloads != nullptr || numberOfChunks == 0U);
+
+    SubscriberPortUser port(self->m_portData);
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        port.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+}
+
 void iox_sub_release_queued_chunks(iox_sub_t const self)
 {
     SubscriberPortUser(self->m_portData).releaseQueuedChunks();
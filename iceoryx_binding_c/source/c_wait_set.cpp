@@ -116,6 +116,20 @@ uint64_t iox_ws_capacity(iox_ws_t const self)
     return self->capacity();
 }
 
+iox_WaitSetResult iox_ws_get_file_descriptor(iox_ws_t const self, int* const fileDescriptor)
+{
+    iox::cxx::Expects(self != nullptr);
+    iox::cxx::Expects(fileDescriptor != nullptr);
+
+    auto result = self->getFileDescriptor();
+    if (result.has_error())
+    {
+        return cpp2c::waitSetResult(result.get_error());
+    }
+    *fileDescriptor = result.value();
+    return iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
 void iox_ws_mark_for_destruction(iox_ws_t const self)
 {
     iox::cxx::Expects(self != nullptr);
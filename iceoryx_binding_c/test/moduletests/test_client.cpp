@@ -453,6 +453,45 @@ TEST_F(iox_client_test, ReleasingResponseReleasesChunk)
     iox_client_deinit(sut);
 }
 
+TEST_F(iox_client_test, TakeResponsesReturnsNoChunkAvailableWhenNothingWasReceived)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9d4f2c6-0b3e-4871-b5a7-1e6c8d2f9b30");
+    prepareClientInit();
+    iox_client_t sut = iox_client_init(&sutStorage, SERVICE, INSTANCE, EVENT, nullptr);
+    connect();
+    const void* payloads[2U];
+    uint64_t numberOfResponses{42U};
+
+    EXPECT_THAT(iox_client_take_responses(sut, payloads, 2U, &numberOfResponses),
+                Eq(ChunkReceiveResult_NO_CHUNK_AVAILABLE));
+    EXPECT_THAT(numberOfResponses, Eq(0U));
+
+    iox_client_deinit(sut);
+}
+
+TEST_F(iox_client_test, TakeResponsesAndReleaseResponsesWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e7c5b19-d8f4-4a06-93c1-f0b6a4e8d275");
+    prepareClientInit();
+    iox_client_t sut = iox_client_init(&sutStorage, SERVICE, INSTANCE, EVENT, nullptr);
+    connect();
+    receiveChunk(1301);
+    receiveChunk(1302);
+    const void* payloads[3U];
+    uint64_t numberOfResponses{0U};
+
+    ASSERT_THAT(iox_client_take_responses(sut, payloads, 3U, &numberOfResponses), Eq(ChunkReceiveResult_SUCCESS));
+    ASSERT_THAT(numberOfResponses, Eq(2U));
+    EXPECT_THAT(*static_cast<const int64_t*>(payloads[0]), Eq(1301));
+    EXPECT_THAT(*static_cast<const int64_t*>(payloads[1]), Eq(1302));
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+    iox_client_release_responses(sut, payloads, numberOfResponses);
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    iox_client_deinit(sut);
+}
+
 TEST_F(iox_client_test, ReleasingQueuedResponsesReleasesEverything)
 {
     ::testing::Test::RecordProperty("TEST_ID", "45f34faf-dc39-4658-adf5-936e2a33c5df");
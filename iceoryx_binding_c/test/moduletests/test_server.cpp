@@ -18,6 +18,7 @@
 #include "iceoryx_hoofs/internal/relocatable_pointer/atomic_relocatable_pointer.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/popo/untyped_server.hpp"
@@ -81,7 +82,9 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        ASSERT_FALSE(ChunkDistributor<ServerChunkDistributorData_t>(&sutPort->m_chunkSenderData)
+                         .tryAddQueue(&clientResponseQueueData)
+                         .has_error());
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
@@ -155,6 +158,7 @@ TEST_F(iox_server_test, initializedOptionsToCPPDefaults)
                 Eq(cpp2c::queueFullPolicy(cppOptions.requestQueueFullPolicy)));
     EXPECT_THAT(initializedOptions.clientTooSlowPolicy,
                 Eq(cpp2c::consumerTooSlowPolicy(cppOptions.clientTooSlowPolicy)));
+    EXPECT_THAT(initializedOptions.maxRequestsInFlight, Eq(cppOptions.maxRequestsInFlight));
 }
 
 TEST_F(iox_server_test, InitializingServerWithNullptrOptionsGetsMiddlewareServerWithDefaultOptions)
@@ -178,6 +182,7 @@ TEST_F(iox_server_test, InitializingServerWithCustomOptionsWorks)
     options.offerOnCreate = false;
     options.requestQueueFullPolicy = QueueFullPolicy_BLOCK_PRODUCER;
     options.clientTooSlowPolicy = ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
+    options.maxRequestsInFlight = 16;
 
     ServerOptions cppOptions;
     cppOptions.requestQueueCapacity = options.requestQueueCapacity;
@@ -185,6 +190,7 @@ TEST_F(iox_server_test, InitializingServerWithCustomOptionsWorks)
     cppOptions.offerOnCreate = options.offerOnCreate;
     cppOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     cppOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    cppOptions.maxRequestsInFlight = options.maxRequestsInFlight;
 
     prepareServerInit(cppOptions);
 
@@ -246,6 +252,47 @@ TEST_F(iox_server_test, WhenOfferedAndRequestsPresentTakeSucceeds)
     iox_server_deinit(sut);
 }
 
+TEST_F(iox_server_test, WhenOfferedAndNoRequestsPresentTakeRequestsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5c2a0d8-3e9b-4716-8d4a-b7e1c6f29053");
+    prepareServerInit();
+    iox_server_t sut = iox_server_init(&sutStorage, SERVICE, INSTANCE, EVENT, nullptr);
+    iox_server_offer(sut);
+
+    const void* payloads[2U];
+    uint64_t numberOfRequests{42U};
+    EXPECT_THAT(iox_server_take_requests(sut, payloads, 2U, &numberOfRequests),
+                Eq(ServerRequestResult_NO_PENDING_REQUESTS));
+    EXPECT_THAT(numberOfRequests, Eq(0U));
+
+    iox_server_deinit(sut);
+}
+
+TEST_F(iox_server_test, WhenOfferedAndRequestsPresentTakeRequestsAndReleaseRequestsSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b87e1f4-a6d0-4c25-9f13-e84c2d0b7a59");
+    prepareServerInit();
+    iox_server_t sut = iox_server_init(&sutStorage, SERVICE, INSTANCE, EVENT, nullptr);
+    iox_server_offer(sut);
+    constexpr int64_t REQUEST_VALUE_1 = 1337;
+    constexpr int64_t REQUEST_VALUE_2 = 4711;
+    receiveRequest(REQUEST_VALUE_1);
+    receiveRequest(REQUEST_VALUE_2);
+
+    const void* payloads[3U];
+    uint64_t numberOfRequests{0U};
+    ASSERT_THAT(iox_server_take_requests(sut, payloads, 3U, &numberOfRequests), Eq(ServerRequestResult_SUCCESS));
+    ASSERT_THAT(numberOfRequests, Eq(2U));
+    EXPECT_THAT(*static_cast<const int64_t*>(payloads[0]), Eq(REQUEST_VALUE_1));
+    EXPECT_THAT(*static_cast<const int64_t*>(payloads[1]), Eq(REQUEST_VALUE_2));
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+    iox_server_release_requests(sut, payloads, numberOfRequests);
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    iox_server_deinit(sut);
+}
+
 TEST_F(iox_server_test, TakingToMuchRequestsInParallelLeadsToError)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b1175d14-0268-42d9-a174-97713e622200");
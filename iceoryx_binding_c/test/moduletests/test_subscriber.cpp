@@ -293,6 +293,72 @@ TEST_F(iox_sub_test, releaseChunkWorks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(iox_sub_test, takeChunksWithoutChunksFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a1e9c37-b4f2-4d06-8e7a-c2d5f9b13a68");
+    this->Subscribe(&m_portPtr);
+    const void* chunks[2U] = {nullptr, nullptr};
+    uint64_t numberOfChunks{42U};
+
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksProvidesAllAvailableChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0f4b862-1c7e-43a9-a5d3-6b8e2f07c914");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        *static_cast<uint64_t*>(sharedChunk.getUserPayload()) = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS + 1U] = {nullptr};
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 1U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunks[i]), Eq(i));
+    }
+}
+
+TEST_F(iox_sub_test, takeChunksWithZeroMaxNumberOfChunksTakesNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0967a5c1-7767-413e-b716-31cfccec8d7c");
+    this->Subscribe(&m_portPtr);
+    m_chunkPusher.push(getChunkFromMemoryManager());
+
+    const void* chunks[1U] = {nullptr};
+    uint64_t numberOfChunks{42U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 0U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+    EXPECT_THAT(chunks[0U], Eq(nullptr));
+    EXPECT_TRUE(iox_sub_has_chunks(m_sut));
+}
+
+TEST_F(iox_sub_test, releaseChunksWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "81b3e7d5-6f0a-4c92-b1e4-9d2c7a5f3e06");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{2U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS] = {nullptr};
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+    iox_sub_release_chunks(m_sut, chunks, numberOfChunks);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, releaseChunkQueuedChunksWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6e32b17f-7454-40fe-bf97-f742249fb7de");
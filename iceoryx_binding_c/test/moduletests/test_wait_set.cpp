@@ -41,6 +41,7 @@ extern "C" {
 #include "test.hpp"
 
 #include <atomic>
+#include <poll.h>
 #include <thread>
 
 namespace
@@ -328,6 +329,25 @@ TEST_F(iox_ws_test, SizeDecreasesWhenAttachedSubscriberEventIsDeinitialized)
     EXPECT_EQ(iox_ws_size(m_sut), 0U);
 }
 
+TEST_F(iox_ws_test, FileDescriptorBecomesReadableWhenUserTriggerIsTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c81c9b8-c116-4820-a2b6-09eab4e2206a");
+    int fileDescriptor{-1};
+    ASSERT_EQ(iox_ws_get_file_descriptor(m_sut, &fileDescriptor), iox_WaitSetResult::WaitSetResult_SUCCESS);
+    EXPECT_GE(fileDescriptor, 0);
+    ASSERT_EQ(iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[0U], 0U, NULL),
+              iox_WaitSetResult::WaitSetResult_SUCCESS);
+
+    iox_user_trigger_trigger(m_userTrigger[0U]);
+
+    pollfd pollFd{fileDescriptor, POLLIN, 0};
+    EXPECT_EQ(poll(&pollFd, 1U, 0), 1);
+    EXPECT_EQ(iox_ws_timed_wait(
+                  m_sut, m_timeout, m_eventInfoStorage, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements),
+              1U);
+    EXPECT_EQ(poll(&pollFd, 1U, 0), 0);
+}
+
 TEST_F(iox_ws_test, NumberOfTriggeredConditionsIsOneWhenOneWasTriggered)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b1fbf9fd-fbae-439d-94f5-41e5d9756fd2");
@@ -29,6 +29,7 @@ enum class Technology
     ALL,
     ICEORYX_CPP_API,
     ICEORYX_C_API,
+    ICEORYX_C_API_BATCH,
     POSIX_MESSAGE_QUEUE,
     UNIX_DOMAIN_SOCKET
 };
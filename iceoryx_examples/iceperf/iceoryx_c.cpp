@@ -19,7 +19,10 @@
 #include <chrono>
 #include <thread>
 
-IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
+IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName,
+                   const iox::capro::IdString_t& subscriberName,
+                   const bool useBatchApi) noexcept
+    : m_useBatchApi(useBatchApi)
 {
     iox_pub_options_t publisherOptions;
     iox_pub_options_init(&publisherOptions);
@@ -98,6 +101,11 @@ void IceoryxC::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag ru
 
 PerfTopic IceoryxC::receivePerfTopic() noexcept
 {
+    if (m_useBatchApi)
+    {
+        return receivePerfTopicBatch();
+    }
+
     bool hasReceivedSample{false};
     PerfTopic receivedSample;
 
@@ -114,3 +122,22 @@ PerfTopic IceoryxC::receivePerfTopic() noexcept
 
     return receivedSample;
 }
+
+PerfTopic IceoryxC::receivePerfTopicBatch() noexcept
+{
+    PerfTopic receivedSample;
+    const void* userPayloads[BATCH_SIZE];
+    uint64_t numberOfChunks{0U};
+
+    do
+    {
+        if (iox_sub_take_chunks(m_subscriber, userPayloads, BATCH_SIZE, &numberOfChunks) == ChunkReceiveResult_SUCCESS)
+        {
+            // the newest sample is the last one
+            receivedSample = *(static_cast<const PerfTopic*>(userPayloads[numberOfChunks - 1U]));
+            iox_sub_release_chunks(m_subscriber, userPayloads, numberOfChunks);
+        }
+    } while (numberOfChunks == 0U);
+
+    return receivedSample;
+}
@@ -27,7 +27,10 @@ extern "C" {
 class IceoryxC : public IcePerfBase
 {
   public:
-    IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+    /// @param[in] useBatchApi receive with iox_sub_take_chunks/iox_sub_release_chunks instead of the single chunk API
+    IceoryxC(const iox::capro::IdString_t& publisherName,
+             const iox::capro::IdString_t& subscriberName,
+             const bool useBatchApi = false) noexcept;
     ~IceoryxC();
     void initLeader() noexcept override;
     void initFollower() noexcept override;
@@ -37,11 +40,15 @@ class IceoryxC : public IcePerfBase
     void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
+    PerfTopic receivePerfTopicBatch() noexcept;
+
+    static constexpr uint64_t BATCH_SIZE{16U};
 
     iox_pub_storage_t m_publisherStorage;
     iox_sub_storage_t m_subscriberStorage;
     iox_pub_t m_publisher;
     iox_sub_t m_subscriber;
+    bool m_useBatchApi{false};
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
@@ -119,6 +119,13 @@ int IcePerfFollower::run() noexcept
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxc);
     }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API_BATCH)
+    {
+        std::cout << std::endl << "****** ICEORYX C API BATCH *******" << std::endl;
+        IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER, true);
+        doMeasurement(iceoryxc);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
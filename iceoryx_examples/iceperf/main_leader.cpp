@@ -54,6 +54,7 @@ int main(int argc, char* argv[])
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
+            std::cout << "                                          iceoryx-c-api-batch," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
@@ -94,6 +95,10 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_C_API;
             }
+            else if (strcmp(optarg, "iceoryx-c-api-batch") == 0)
+            {
+                settings.technology = Technology::ICEORYX_C_API_BATCH;
+            }
             else if (strcmp(optarg, "posix-message-queue") == 0)
             {
                 settings.technology = Technology::POSIX_MESSAGE_QUEUE;
@@ -105,7 +110,7 @@ int main(int argc, char* argv[])
             else
             {
                 std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                             "'iceoryx-c-api-batch', 'posix-message-queue' and 'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -68,13 +68,19 @@ class LoFFLi
     uint32_t m_size{0U};
     Index_t m_invalidIndex{0U};
     std::atomic<Node> m_head{{0U, 1U}};
+    /// @brief the indices starting at this one were never popped; they are handed out after the free-list is empty,
+    /// therefore init does not need to build the list over the whole capacity
+    std::atomic<Index_t> m_nextUnusedIndex{0U};
     iox::rp::RelativePointer<Index_t> m_nextFreeIndex;
 
+    bool popUnusedIndex(Index_t& index) noexcept;
+
   public:
     LoFFLi() noexcept = default;
     /// @todo: why init not in ctor
 
-    /// Initializes the lock-free free-list
+    /// Initializes the lock-free free-list; the runtime does not depend on the capacity since the indices are added to
+    /// the free-list when they are pushed for the first time
     /// @param [in] freeIndicesMemory pointer to a memory with the capacity calculated by requiredMemorySize()
     /// @param [in] capacity is the number of elements of the free-list; must be the same used at requiredMemorySize()
     void init(cxx::not_null<Index_t*> freeIndicesMemory, const uint32_t capacity) noexcept;
@@ -56,6 +56,9 @@ class BaseRelativePointer
     using const_ptr_t = const void* const;
     using offset_t = std::uintptr_t;
 
+    /// @brief the maximum number of segments which can be registered, including the reserved id 0
+    static constexpr uint64_t MAX_NUMBER_OF_SEGMENTS{10000U};
+
     /// @brief constructs a BaseRelativePointer pointing to the same pointee as ptr in a segment identified by id
     /// @param[in] ptr the pointer whose pointee shall be the same for this
     /// @param[in] id is the unique id of the segment
@@ -159,7 +162,7 @@ class BaseRelativePointer
 
     /// @brief returns the pointer repository
     /// @return the pointer repository
-    static PointerRepository<id_t, ptr_t>& getRepository() noexcept;
+    static PointerRepository<id_t, ptr_t, MAX_NUMBER_OF_SEGMENTS>& getRepository() noexcept;
 
     /// @brief get the offset from the start address of the segment and ptr
     /// @param[in] ptr is the pointer whose offset should be calculated
@@ -176,8 +179,19 @@ class BaseRelativePointer
   protected:
     id_t m_id{NULL_POINTER_ID};
     offset_t m_offset{NULL_POINTER_OFFSET};
+
+  private:
+    static constexpr uint64_t CACHE_LINE_SIZE{64U};
+
+    /// @brief flat copy of the base addresses in the PointerRepository which is used to resolve the relative pointers.
+    /// It is zero initialized at compile time, therefore no guard for a function local static is needed and
+    /// dereferencing a relative pointer compiles down to a load and an add. The entry of id 0 and of not registered
+    /// ids is 0, which corresponds to the nullptr base of the PointerRepository.
+    alignas(CACHE_LINE_SIZE) static offset_t s_segmentBaseAddresses[MAX_NUMBER_OF_SEGMENTS];
 };
 } // namespace rp
 } // namespace iox
 
+#include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.inl"
+
 #endif // IOX_HOOFS_RELOCATABLE_POINTER_BASE_RELATIVE_POINTER_HPP
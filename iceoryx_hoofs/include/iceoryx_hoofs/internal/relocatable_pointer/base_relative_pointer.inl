@@ -0,0 +1,72 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_RELOCATABLE_POINTER_BASE_RELATIVE_POINTER_INL
+#define IOX_HOOFS_RELOCATABLE_POINTER_BASE_RELATIVE_POINTER_INL
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.hpp"
+
+namespace iox
+{
+namespace rp
+{
+inline BaseRelativePointer::ptr_t BaseRelativePointer::get() const noexcept
+{
+    /// @note we need to compute it each time since the application
+    /// from where it's called might have changed (i.e. the lookup result is different)
+    return computeRawPtr();
+}
+
+inline BaseRelativePointer::ptr_t BaseRelativePointer::getBasePtr(const id_t id) noexcept
+{
+    // NOLINTNEXTLINE(performance-no-int-to-ptr) reliance on integers for offset computation by design
+    return reinterpret_cast<ptr_t>((id < MAX_NUMBER_OF_SEGMENTS) ? s_segmentBaseAddresses[id] : 0U);
+}
+
+inline BaseRelativePointer::offset_t BaseRelativePointer::getOffset(const id_t id, const_ptr_t ptr) noexcept
+{
+    if (id == NULL_POINTER_ID)
+    {
+        return NULL_POINTER_OFFSET;
+    }
+    auto* basePtr = getBasePtr(id);
+    return reinterpret_cast<offset_t>(ptr) - reinterpret_cast<offset_t>(basePtr);
+}
+
+inline BaseRelativePointer::ptr_t BaseRelativePointer::getPtr(const id_t id, const offset_t offset) noexcept
+{
+    if (offset == NULL_POINTER_OFFSET)
+    {
+        return nullptr;
+    }
+    auto* basePtr = getBasePtr(id);
+    // NOLINTNEXTLINE(performance-no-int-to-ptr) reliance on integers for offset computation by design
+    return reinterpret_cast<ptr_t>(offset + reinterpret_cast<offset_t>(basePtr));
+}
+
+inline BaseRelativePointer::offset_t BaseRelativePointer::computeOffset(ptr_t ptr) const noexcept
+{
+    return getOffset(m_id, ptr);
+}
+
+inline BaseRelativePointer::ptr_t BaseRelativePointer::computeRawPtr() const noexcept
+{
+    return getPtr(m_id, m_offset);
+}
+} // namespace rp
+} // namespace iox
+
+#endif // IOX_HOOFS_RELOCATABLE_POINTER_BASE_RELATIVE_POINTER_INL
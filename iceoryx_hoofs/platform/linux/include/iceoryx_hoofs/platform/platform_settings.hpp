@@ -30,7 +30,8 @@ namespace platform
 {
 constexpr uint64_t IOX_MAX_FILENAME_LENGTH = 255U;
 constexpr uint64_t IOX_MAX_PATH_LENGTH = 1023U;
-constexpr bool IOX_SHM_WRITE_ZEROS_ON_CREATION = true;
+/// the memory of a new shared memory object is reserved with iox_shm_reserve, the kernel guarantees zeroed pages
+constexpr bool IOX_SHM_WRITE_ZEROS_ON_CREATION = false;
 constexpr uint64_t IOX_MAX_SHM_NAME_LENGTH = PATH_MAX;
 constexpr const char IOX_PATH_SEPARATORS[] = "/";
 constexpr uint64_t IOX_UDS_SOCKET_MAX_MESSAGE_SIZE = 4096;
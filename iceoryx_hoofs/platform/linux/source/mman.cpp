@@ -16,6 +16,9 @@
 
 #include "iceoryx_hoofs/platform/mman.hpp"
 
+#include <cerrno>
+#include <fcntl.h>
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
@@ -27,3 +30,17 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_shm_reserve(int fd, off_t length)
+{
+    // the kernel allocates zeroed pages without mapping them into the process; posix_fallocate returns the error
+    // instead of setting errno
+    const int result = posix_fallocate(fd, 0, length);
+    if (result != 0)
+    {
+        errno = result;
+        return -1;
+    }
+    return 0;
+}
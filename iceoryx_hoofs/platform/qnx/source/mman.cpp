@@ -25,3 +25,9 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+int iox_shm_reserve(int, off_t)
+{
+    // the memory is reserved by writing zeros to it, see IOX_SHM_WRITE_ZEROS_ON_CREATION
+    return 0;
+}
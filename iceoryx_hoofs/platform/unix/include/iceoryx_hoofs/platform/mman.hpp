@@ -21,5 +21,9 @@
 
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
+/// @brief Reserves the memory of a newly created shared memory object, so that a lack of memory is reported here
+///        instead of with a SIGBUS on the first access
+/// @return 0 on success, -1 with errno set otherwise
+int iox_shm_reserve(int fd, off_t length);
 
 #endif // IOX_HOOFS_UNIX_PLATFORM_MMAN_HPP
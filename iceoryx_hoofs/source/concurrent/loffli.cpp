@@ -36,14 +36,10 @@ void LoFFLi::init(cxx::not_null<Index_t*> freeIndicesMemory, const uint32_t capa
     m_size = capacity;
     m_invalidIndex = m_size + 1;
 
-    if (m_nextFreeIndex != nullptr)
-    {
-        for (uint32_t i = 0; i < m_size + 1; i++)
-        {
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index is set by m_size
-            m_nextFreeIndex[i] = i + 1;
-        }
-    }
+    // the free-list starts empty and all indices are handed out by popUnusedIndex; this is equivalent to a free-list
+    // which contains all indices in ascending order
+    m_nextUnusedIndex.store(0U, std::memory_order_relaxed);
+    m_head.store({m_size, 1U}, std::memory_order_release);
 }
 
 bool LoFFLi::pop(Index_t& index) noexcept
@@ -56,7 +52,7 @@ bool LoFFLi::pop(Index_t& index) noexcept
         // we are empty if next points to an element with index of Size
         if (oldHead.indexToNextFreeIndex >= m_size)
         {
-            return false;
+            return popUnusedIndex(index);
         }
 
         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
@@ -82,6 +78,28 @@ bool LoFFLi::pop(Index_t& index) noexcept
     return true;
 }
 
+bool LoFFLi::popUnusedIndex(Index_t& index) noexcept
+{
+    Index_t unusedIndex = m_nextUnusedIndex.load(std::memory_order_relaxed);
+    do
+    {
+        if (unusedIndex >= m_size)
+        {
+            return false;
+        }
+    } while (!m_nextUnusedIndex.compare_exchange_weak(
+        unusedIndex, unusedIndex + 1U, std::memory_order_relaxed, std::memory_order_relaxed));
+
+    index = unusedIndex;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+    m_nextFreeIndex[index] = m_invalidIndex;
+
+    /// same synchronization with push as in pop
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return true;
+}
+
 bool LoFFLi::push(const Index_t index) noexcept
 {
     /// we synchronize with m_nextFreeIndex in pop to perform the validity check
@@ -89,8 +107,10 @@ bool LoFFLi::push(const Index_t index) noexcept
 
     /// we want to avoid double free's therefore we check if the index was acquired
     /// in pop and the push argument "index" is valid
+    /// the entries in m_nextFreeIndex of indices which were never popped are uninitialized, therefore these indices
+    /// are rejected before the entry is read
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
-    if (index >= m_size || m_nextFreeIndex[index] != m_invalidIndex)
+    if (index >= m_nextUnusedIndex.load(std::memory_order_relaxed) || m_nextFreeIndex[index] != m_invalidIndex)
     {
         return false;
     }
@@ -131,6 +131,12 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
         auto result = posixCall(ftruncate)(sharedMemoryFileHandle, static_cast<int64_t>(m_size))
                           .failureReturnValue(SharedMemory::INVALID_HANDLE)
                           .evaluate();
+        if (!result.has_error())
+        {
+            result = posixCall(iox_shm_reserve)(sharedMemoryFileHandle, static_cast<off_t>(m_size))
+                         .failureReturnValue(SharedMemory::INVALID_HANDLE)
+                         .evaluate();
+        }
         if (result.has_error())
         {
             printError();
@@ -151,7 +157,7 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
                               << "\". This may be a SharedMemory leak." << std::endl;
                 });
 
-            return cxx::error<SharedMemoryError>(SharedMemory::errnoToEnum(result->errnum));
+            return cxx::error<SharedMemoryError>(SharedMemory::errnoToEnum(result.get_error().errnum));
         }
     }
 
@@ -302,6 +308,7 @@ SharedMemoryError SharedMemory::errnoToEnum(const int32_t errnum) noexcept
         std::cerr << "Shared Memory does not exist." << std::endl;
         return SharedMemoryError::DOES_NOT_EXIST;
     case ENOMEM:
+    case ENOSPC:
         std::cerr << "Not enough memory available to create shared memory." << std::endl;
         return SharedMemoryError::NOT_ENOUGH_MEMORY_AVAILABLE;
     default:
@@ -21,6 +21,11 @@ namespace iox
 {
 namespace rp
 {
+constexpr uint64_t BaseRelativePointer::MAX_NUMBER_OF_SEGMENTS;
+constexpr uint64_t BaseRelativePointer::CACHE_LINE_SIZE;
+alignas(BaseRelativePointer::CACHE_LINE_SIZE) BaseRelativePointer::offset_t
+    BaseRelativePointer::s_segmentBaseAddresses[BaseRelativePointer::MAX_NUMBER_OF_SEGMENTS]{};
+
 BaseRelativePointer::BaseRelativePointer(ptr_t ptr, id_t id) noexcept
     : m_id(id)
     , m_offset(computeOffset(ptr))
@@ -82,13 +87,6 @@ BaseRelativePointer& BaseRelativePointer::operator=(BaseRelativePointer&& other)
     return *this;
 }
 
-BaseRelativePointer::ptr_t BaseRelativePointer::get() const noexcept
-{
-    /// @note we need to compute it each time since the application
-    /// from where it's called might have changed (i.e. the lookup result is different)
-    return computeRawPtr();
-}
-
 BaseRelativePointer::id_t BaseRelativePointer::getId() const noexcept
 {
     return m_id;
@@ -106,48 +104,45 @@ BaseRelativePointer::ptr_t BaseRelativePointer::getBasePtr() const noexcept
 
 BaseRelativePointer::id_t BaseRelativePointer::registerPtr(const ptr_t ptr, uint64_t size) noexcept
 {
-    return getRepository().registerPtr(ptr, size);
+    auto id = getRepository().registerPtr(ptr, size);
+    if (id < MAX_NUMBER_OF_SEGMENTS)
+    {
+        s_segmentBaseAddresses[id] = reinterpret_cast<offset_t>(ptr);
+    }
+    return id;
 }
 
 bool BaseRelativePointer::registerPtr(const id_t id, const ptr_t ptr, uint64_t size) noexcept
 {
-    return getRepository().registerPtr(id, ptr, size);
+    if (!getRepository().registerPtr(id, ptr, size))
+    {
+        return false;
+    }
+    // id 0 is reserved and always resolved relative to 0, even if it was registered
+    if (id != 0U)
+    {
+        s_segmentBaseAddresses[id] = reinterpret_cast<offset_t>(ptr);
+    }
+    return true;
 }
 
 bool BaseRelativePointer::unregisterPtr(const id_t id) noexcept
 {
-    return getRepository().unregisterPtr(id);
-}
-
-BaseRelativePointer::ptr_t BaseRelativePointer::getBasePtr(const id_t id) noexcept
-{
-    return getRepository().getBasePtr(id);
-}
-
-void BaseRelativePointer::unregisterAll() noexcept
-{
-    getRepository().unregisterAll();
-}
-
-BaseRelativePointer::offset_t BaseRelativePointer::getOffset(const id_t id, const_ptr_t ptr) noexcept
-{
-    if (id == NULL_POINTER_ID)
+    if (!getRepository().unregisterPtr(id))
     {
-        return NULL_POINTER_OFFSET;
+        return false;
     }
-    auto* basePtr = getBasePtr(id);
-    return reinterpret_cast<offset_t>(ptr) - reinterpret_cast<offset_t>(basePtr);
+    s_segmentBaseAddresses[id] = 0U;
+    return true;
 }
 
-BaseRelativePointer::ptr_t BaseRelativePointer::getPtr(const id_t id, const offset_t offset) noexcept
+void BaseRelativePointer::unregisterAll() noexcept
 {
-    if (offset == NULL_POINTER_OFFSET)
+    getRepository().unregisterAll();
+    for (auto& baseAddress : s_segmentBaseAddresses)
     {
-        return nullptr;
+        baseAddress = 0U;
     }
-    auto* basePtr = getBasePtr(id);
-    // NOLINTNEXTLINE(performance-no-int-to-ptr) reliance on integers for offset computation by design
-    return reinterpret_cast<ptr_t>(offset + reinterpret_cast<offset_t>(basePtr));
 }
 
 BaseRelativePointer::id_t BaseRelativePointer::searchId(ptr_t ptr) noexcept
@@ -164,20 +159,12 @@ bool BaseRelativePointer::isValid(id_t id) noexcept
     return getRepository().isValid(id);
 }
 
-PointerRepository<BaseRelativePointer::id_t, BaseRelativePointer::ptr_t>& BaseRelativePointer::getRepository() noexcept
+PointerRepository<BaseRelativePointer::id_t, BaseRelativePointer::ptr_t, BaseRelativePointer::MAX_NUMBER_OF_SEGMENTS>&
+BaseRelativePointer::getRepository() noexcept
 {
-    static PointerRepository<id_t, ptr_t> repository;
+    static PointerRepository<id_t, ptr_t, MAX_NUMBER_OF_SEGMENTS> repository;
     return repository;
 }
 
-BaseRelativePointer::offset_t BaseRelativePointer::computeOffset(ptr_t ptr) const noexcept
-{
-    return getOffset(m_id, ptr);
-}
-
-BaseRelativePointer::ptr_t BaseRelativePointer::computeRawPtr() const noexcept
-{
-    return getPtr(m_id, m_offset);
-}
 } // namespace rp
 } // namespace iox
@@ -205,6 +205,49 @@ TYPED_TEST(LoFFLi_test, PushWhenFull)
     EXPECT_THAT(this->m_loffli.push(indexPush), Eq(false));
 }
 
+TYPED_TEST(LoFFLi_test, PushNeverPoppedIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abf0416d-4bdd-4bcf-bb31-abf328aeeffd");
+    uint32_t index;
+    ASSERT_TRUE(this->m_loffli.pop(index));
+    ASSERT_TRUE(this->m_loffli.pop(index));
+
+    EXPECT_THAT(this->m_loffli.push(index + 1), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(Size - 1), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopReturnsPushedIndicesBeforeUnusedIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b7a3aac-d8c2-44bf-a04f-705e76dbe0c6");
+    uint32_t index0;
+    uint32_t index1;
+    ASSERT_TRUE(this->m_loffli.pop(index0));
+    ASSERT_TRUE(this->m_loffli.pop(index1));
+    ASSERT_TRUE(this->m_loffli.push(index0));
+
+    uint32_t index;
+    ASSERT_TRUE(this->m_loffli.pop(index));
+    EXPECT_THAT(index, Eq(index0));
+    ASSERT_TRUE(this->m_loffli.pop(index));
+    EXPECT_THAT(index, Eq(2U));
+}
+
+TYPED_TEST(LoFFLi_test, InitDoesNotTouchIndexMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1a7615a0-4f74-42e4-89a5-2583f0881bfd");
+    using LoFFLiIndex_t = typename TestFixture::LoFFLiIndex_t;
+    constexpr LoFFLiIndex_t SENTINEL{0xC0FFEEU};
+    std::fill(std::begin(this->m_memoryLoFFLi), std::end(this->m_memoryLoFFLi), SENTINEL);
+
+    decltype(this->m_loffli) loFFLi;
+    loFFLi.init(this->m_memoryLoFFLi, Size);
+
+    for (auto entry : this->m_memoryLoFFLi)
+    {
+        EXPECT_THAT(entry, Eq(SENTINEL));
+    }
+}
+
 TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
 {
     ::testing::Test::RecordProperty("TEST_ID", "34f5b48a-a30a-4dd1-81d6-7c963c005f1b");
@@ -488,4 +488,51 @@ TYPED_TEST(RelativePointer_test, defaultConstructedRelativePtrIsNull)
     EXPECT_EQ(rp2, nullptr);
 }
 
+TYPED_TEST(RelativePointer_test, basePointerIsResetAfterUnregister)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11ec60b1-1cc0-4f17-bcc1-83242d84353c");
+    auto ptr0 = this->partitionPtr(0);
+    auto ptr1 = this->partitionPtr(1);
+
+    ASSERT_TRUE(BaseRelativePointer::registerPtr(1, ptr0));
+    ASSERT_TRUE(BaseRelativePointer::registerPtr(2, ptr1));
+
+    EXPECT_TRUE(BaseRelativePointer::unregisterPtr(1));
+    EXPECT_EQ(BaseRelativePointer::getBasePtr(1), nullptr);
+    EXPECT_EQ(BaseRelativePointer::getBasePtr(2), ptr1);
+
+    BaseRelativePointer::unregisterAll();
+    EXPECT_EQ(BaseRelativePointer::getBasePtr(2), nullptr);
+}
+
+TYPED_TEST(RelativePointer_test, relativePointerIsResolvedWithTheCurrentlyRegisteredBasePointer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4e30f30-c473-4b27-8c79-2a8430529a15");
+    auto ptr0 = this->partitionPtr(0);
+    auto ptr1 = this->partitionPtr(1);
+    constexpr uint64_t OFFSET{128U};
+
+    ASSERT_TRUE(BaseRelativePointer::registerPtr(1, ptr0, SHARED_MEMORY_SIZE));
+    RelativePointer<TypeParam> sut(reinterpret_cast<TypeParam*>(ptr0 + OFFSET), 1);
+    EXPECT_EQ(sut.get(), reinterpret_cast<TypeParam*>(ptr0 + OFFSET));
+
+    // simulates the mapping of the segment to a different address, like in another process
+    ASSERT_TRUE(BaseRelativePointer::unregisterPtr(1));
+    ASSERT_TRUE(BaseRelativePointer::registerPtr(1, ptr1, SHARED_MEMORY_SIZE));
+    EXPECT_EQ(sut.get(), reinterpret_cast<TypeParam*>(ptr1 + OFFSET));
+}
+
+TYPED_TEST(RelativePointer_test, idWithoutSegmentIsResolvedRelativeToZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8eb36f34-20d4-4efb-bdda-635a16a22317");
+    auto ptr = reinterpret_cast<TypeParam*>(this->partitionPtr(0));
+
+    RelativePointer<TypeParam> reservedId(ptr, 0U);
+    RelativePointer<TypeParam> idOutOfRange(reinterpret_cast<BaseRelativePointer::offset_t>(ptr),
+                                            BaseRelativePointer::MAX_NUMBER_OF_SEGMENTS);
+
+    EXPECT_EQ(reservedId.get(), ptr);
+    EXPECT_EQ(idOutOfRange.get(), ptr);
+}
+
 } // namespace
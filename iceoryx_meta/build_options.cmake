@@ -30,10 +30,13 @@ option(DOWNLOAD_TOML_LIB "Download cpptoml via the CMake ExternalProject module"
 option(EXAMPLES "Build all iceoryx examples" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
+option(RECORD_REPLAY "Builds the iox-record and iox-replay tools to record topics to disk and to replay them" OFF)
 option(ROUDI_ENVIRONMENT "Build RouDi Environment for testing, is enabled when building tests" OFF)
 option(SANITIZE "Build with sanitizers" OFF)
+option(TAKE_LATENCY_HISTOGRAM "Records the latency from publish to take of every subscriber for the port introspection" OFF)
 option(TEST_WITH_ADDITIONAL_USER "Build Test with additional user accounts for testing access control" OFF)
 option(TOML_CONFIG "TOML support for RouDi with dynamic configuration" ON)
+option(TRACE_EXPORT "Builds the iox-trace-export tool which converts chunk traces to the Chrome trace format" OFF)
 
 set(CMAKE_EXPORT_COMPILE_COMMANDS ON) # "Create compile_commands.json file"
 
@@ -41,6 +44,8 @@ if(BUILD_ALL)
   set(EXAMPLES ON)
   set(BUILD_TEST ON)
   set(INTROSPECTION ON)
+  set(RECORD_REPLAY ON)
+  set(TRACE_EXPORT ON)
   set(BINDING_C ON)
   set(DDS_GATEWAY ON)
 endif()
@@ -86,8 +91,11 @@ function(show_config_options)
   message("          EXAMPLES.............................: " ${EXAMPLES})
   message("          INTROSPECTION........................: " ${INTROSPECTION})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
+  message("          RECORD_REPLAY........................: " ${RECORD_REPLAY})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
   message("          SANITIZE.............................: " ${SANITIZE})
+  message("          TAKE_LATENCY_HISTOGRAM...............: " ${TAKE_LATENCY_HISTOGRAM})
   message("          TEST_WITH_ADDITIONAL_USER ...........: " ${TEST_WITH_ADDITIONAL_USER})
   message("          TOML_CONFIG..........................: " ${TOML_CONFIG})
+  message("          TRACE_EXPORT.........................: " ${TRACE_EXPORT})
 endfunction()
@@ -62,6 +62,44 @@ if(NOT IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY)
 endif()
 message(STATUS "[i] IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY:" ${IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY})
 
+# the inline queue is disabled with a capacity of 0, therefore 0 is a valid value
+if(NOT DEFINED IOX_MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY)
+    set(IOX_MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY 0)
+endif()
+message(STATUS "[i] IOX_MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY:" ${IOX_MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY})
+
+if(TAKE_LATENCY_HISTOGRAM)
+    set(IOX_TAKE_LATENCY_HISTOGRAM true)
+else()
+    set(IOX_TAKE_LATENCY_HISTOGRAM false)
+endif()
+message(STATUS "[i] IOX_TAKE_LATENCY_HISTOGRAM:" ${IOX_TAKE_LATENCY_HISTOGRAM})
+
+if(NOT IOX_MAX_SERVERS)
+    set(IOX_MAX_SERVERS ${IOX_MAX_PUBLISHERS})
+endif()
+message(STATUS "[i] IOX_MAX_SERVERS:" ${IOX_MAX_SERVERS})
+
+if(NOT IOX_MAX_CLIENTS)
+    set(IOX_MAX_CLIENTS ${IOX_MAX_SUBSCRIBERS})
+endif()
+message(STATUS "[i] IOX_MAX_CLIENTS:" ${IOX_MAX_CLIENTS})
+
+if(NOT IOX_MAX_REQUEST_QUEUE_CAPACITY)
+    set(IOX_MAX_REQUEST_QUEUE_CAPACITY 1024)
+endif()
+message(STATUS "[i] IOX_MAX_REQUEST_QUEUE_CAPACITY:" ${IOX_MAX_REQUEST_QUEUE_CAPACITY})
+
+if(NOT IOX_MAX_RESPONSE_QUEUE_CAPACITY)
+    set(IOX_MAX_RESPONSE_QUEUE_CAPACITY 16)
+endif()
+message(STATUS "[i] IOX_MAX_RESPONSE_QUEUE_CAPACITY:" ${IOX_MAX_RESPONSE_QUEUE_CAPACITY})
+
+if(NOT IOX_MAX_REQUESTS_IN_FLIGHT_PER_CLIENT)
+    set(IOX_MAX_REQUESTS_IN_FLIGHT_PER_CLIENT 64)
+endif()
+message(STATUS "[i] IOX_MAX_REQUESTS_IN_FLIGHT_PER_CLIENT:" ${IOX_MAX_REQUESTS_IN_FLIGHT_PER_CLIENT})
+
 # note: don't change IOX_INTERNAL_MAX_NUMBER_OF_NOTIFIERS value because it could break the C-Binding
 #if(NOT IOX_MAX_NUMBER_OF_NOTIFIERS)
 set(IOX_INTERNAL_MAX_NUMBER_OF_NOTIFIERS 256)
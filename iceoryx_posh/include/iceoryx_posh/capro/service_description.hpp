@@ -93,6 +93,10 @@ class ServiceDescription
         uint32_t data[CLASS_HASH_ELEMENT_COUNT];
     };
 
+    /// @brief 32-bit key of a service, instance or event string; equal strings have equal keys in every process
+    /// @note the key is a comparison shortcut only, it is stored in addition to the string and does not replace it
+    using StringKey_t = uint32_t;
+
     /// @brief default C'tor
     ServiceDescription() noexcept;
     ServiceDescription(const ServiceDescription&) noexcept = default;
@@ -143,6 +147,19 @@ class ServiceDescription
     const IdString_t& getEventIDString() const noexcept;
     ///@}
 
+    ///@{
+    /// Getters for the keys of the string IDs
+    StringKey_t getServiceKey() const noexcept;
+    StringKey_t getInstanceKey() const noexcept;
+    StringKey_t getEventKey() const noexcept;
+    ///@}
+
+    /// @brief Calculates the key of a service, instance or event string. The keys are compared before the strings,
+    ///        only strings with equal keys are compared character by character
+    /// @param[in] idString the string to calculate the key for
+    /// @return the key of the string
+    static StringKey_t createStringKey(const IdString_t& idString) noexcept;
+
     ///@{
     /// Getter for class hash
     ClassHash getClassHash() const noexcept;
@@ -159,6 +176,12 @@ class ServiceDescription
     /// @brief string representation of the event
     IdString_t m_eventString;
 
+    /// @brief keys of the strings which are calculated whenever the strings are set; they only speed up comparisons
+    /// and add 12 bytes to every ServiceDescription since the strings are still stored
+    StringKey_t m_serviceKey{0U};
+    StringKey_t m_instanceKey{0U};
+    StringKey_t m_eventKey{0U};
+
     /// @brief 128-Bit class hash (32-Bit * 4)
     ClassHash m_classHash{0, 0, 0, 0};
 
@@ -65,6 +65,14 @@ constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+// Inline samples, i.e. small user-payloads which are copied into the subscriber queue instead of using a chunk; with
+// an inline queue capacity of 0 the subscribers have no inline queue and all samples are transferred by chunks
+constexpr uint32_t MAX_INLINE_USER_PAYLOAD_SIZE = 56U;
+constexpr uint32_t MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY = build::IOX_MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY;
+constexpr uint32_t MAX_INLINE_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY = 16U;
+// Every subscriber, client and server port records the latency from publish to take in a histogram of 1 KiB in the
+// management segment if this is enabled; without it the port introspection reports no take latencies
+constexpr bool TAKE_LATENCY_HISTOGRAM = build::IOX_TAKE_LATENCY_HISTOGRAM;
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
@@ -84,16 +92,26 @@ constexpr uint32_t MAX_INTERFACE_CAPRO_FIFO_SIZE = MAX_PUBLISHERS;
 constexpr uint32_t MAX_CHANNEL_NUMBER = MAX_PUBLISHERS + MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_GATEWAY_SERVICES = 2 * MAX_CHANNEL_NUMBER;
 // Client
-constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_SUBSCRIBERS; /// @todo
+constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_CLIENTS;
 constexpr uint32_t MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY = 4U;
 constexpr uint32_t MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY = 16U;
-constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = 16U;
+constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = build::IOX_MAX_RESPONSE_QUEUE_CAPACITY;
+/// @brief the default of ClientOptions::responseQueueCapacity; an AsyncClient requests a larger response queue for its
+/// requests in flight
+constexpr uint32_t DEFAULT_RESPONSE_QUEUE_CAPACITY =
+    (MAX_RESPONSE_QUEUE_CAPACITY < 16U) ? MAX_RESPONSE_QUEUE_CAPACITY : 16U;
+/// @brief upper bound for ClientOptions::maxRequestsInFlight, i.e. the capacity of the pending requests of an
+/// AsyncClient; the pending requests are process local, therefore it is independent of MAX_RESPONSE_QUEUE_CAPACITY
+constexpr uint32_t MAX_REQUESTS_IN_FLIGHT_PER_CLIENT = build::IOX_MAX_REQUESTS_IN_FLIGHT_PER_CLIENT;
 // Server
-constexpr uint32_t MAX_SERVERS = build::IOX_MAX_PUBLISHERS; /// @todo
+constexpr uint32_t MAX_SERVERS = build::IOX_MAX_SERVERS;
 constexpr uint32_t MAX_CLIENTS_PER_SERVER = 256U;
+/// @brief default for ServerOptions::maxRequestsInFlight
 constexpr uint32_t MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY = 4U;
-constexpr uint32_t MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY = MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
-constexpr uint32_t MAX_REQUEST_QUEUE_CAPACITY = 1024;
+/// @brief upper bound for ServerOptions::maxRequestsInFlight, i.e. the capacity for requests held by a server
+constexpr uint32_t MAX_REQUESTS_IN_FLIGHT_PER_SERVER = 32U;
+constexpr uint32_t MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY = MAX_REQUESTS_IN_FLIGHT_PER_SERVER;
+constexpr uint32_t MAX_REQUEST_QUEUE_CAPACITY = build::IOX_MAX_REQUEST_QUEUE_CAPACITY;
 // Waitset
 namespace popo
 {
@@ -106,6 +124,10 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+/// @brief the number of FileDescriptorTrigger and TimerTrigger which can be attached to a WaitSet or Listener
+constexpr uint32_t MAX_NUMBER_OF_IO_TRIGGERS = 256U;
+/// @brief the default upper bound for the delay of a notification with QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS
+constexpr units::Duration DEFAULT_MAX_NOTIFICATION_DELAY = units::Duration::fromMilliseconds(10U);
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -192,6 +214,7 @@ struct DefaultChunkDistributorConfig
 struct DefaultChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY;
 };
 
 // alias for cxx::string
@@ -0,0 +1,79 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_CHUNK_LAYOUT_CACHE_HPP
+#define IOX_POSH_MEPOO_CHUNK_LAYOUT_CACHE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief The ChunkLayoutCache stores the ChunkSettings and a ChunkHeader of the last requested chunk layout. Since
+/// typed publishers always request the same layout, the ChunkSettings calculation is done only once and subsequent
+/// ChunkHeader are initialized by copying the cached ChunkHeader instead of running the offset calculations.
+/// @note the cache is located in the shared memory and therefore contains no pointer; it is not thread-safe and
+/// intended to be used only from the runtime context, like the UsedChunkList
+class ChunkLayoutCache
+{
+  public:
+    ChunkLayoutCache() noexcept = default;
+
+    /// @brief Returns the ChunkSettings for the provided parameters. The ChunkSettings are only created if the
+    /// parameters differ from the previous call, which also invalidates the cached ChunkHeader
+    /// @param[in] userPayloadSize is the size of the user-payload
+    /// @param[in] userPayloadAlignment is the alignment of the user-payload
+    /// @param[in] userHeaderSize is the size of the user-header
+    /// @param[in] userHeaderAlignment is the alignment for the user-header
+    /// @return the ChunkSettings or the error of ChunkSettings::create
+    cxx::expected<ChunkSettings, ChunkSettings::Error> getChunkSettings(const uint32_t userPayloadSize,
+                                                                       const uint32_t userPayloadAlignment,
+                                                                       const uint32_t userHeaderSize,
+                                                                       const uint32_t userHeaderAlignment) noexcept;
+
+    /// @brief Caches a ChunkHeader which was constructed with the ChunkSettings of the last getChunkSettings call.
+    /// The ChunkHeader is only cached if its layout does not depend on the address of the chunk, i.e. there is no
+    /// user-header and the user-payload is adjacent to the ChunkHeader. An already cached ChunkHeader is kept.
+    /// @param[in] chunkHeader to cache
+    void cacheChunkHeader(const ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief Initializes a ChunkHeader by copying the cached one
+    /// @param[in] chunk is the memory of the chunk the ChunkHeader shall be initialized for
+    /// @param[in] chunkSize is the size of the chunk
+    /// @return the initialized ChunkHeader or a nullptr if there is no cached ChunkHeader for this chunk size; in
+    /// this case the ChunkHeader must be constructed
+    ChunkHeader* tryInitializeChunkHeader(void* const chunk, const uint32_t chunkSize) const noexcept;
+
+  private:
+    uint32_t m_userPayloadSize{0U};
+    uint32_t m_userPayloadAlignment{0U};
+    uint32_t m_userHeaderSize{0U};
+    uint32_t m_userHeaderAlignment{0U};
+    cxx::optional<ChunkSettings> m_chunkSettings;
+
+    bool m_hasCachedChunkHeader{false};
+    alignas(alignof(ChunkHeader)) uint8_t m_cachedChunkHeader[sizeof(ChunkHeader)];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_LAYOUT_CACHE_HPP
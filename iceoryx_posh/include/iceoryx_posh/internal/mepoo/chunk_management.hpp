@@ -37,15 +37,13 @@ struct ChunkManagement
     using referenceCounterBase_t = uint64_t;
     using referenceCounter_t = std::atomic<referenceCounterBase_t>;
 
-    ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
-                    const cxx::not_null<MemPool*> mempool,
-                    const cxx::not_null<MemPool*> chunkManagementPool) noexcept;
+    ChunkManagement(const cxx::not_null<base_t*> chunkHeader, const cxx::not_null<MemPool*> mempool) noexcept;
 
     iox::rp::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
-    /// @todo optimization: check if this can be replaced by an offset relative to the this pointer
+    /// @brief the MemPool which owns the chunk; the ChunkManagement is located in the parallel array of this MemPool
+    /// at the index of the chunk and does not need to be released separately
     iox::rp::RelativePointer<MemPool> m_mempool;
-    iox::rp::RelativePointer<MemPool> m_chunkManagementPool;
 };
 } // namespace mepoo
 } // namespace iox
@@ -0,0 +1,170 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_INLINE_CHUNK_HPP
+#define IOX_POSH_MEPOO_INLINE_CHUNK_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief An InlineChunk carries a small chunk by value instead of referencing a chunk from the mempools. It is stored
+/// directly in the cells of a chunk queue and has therefore neither a ChunkManagement nor a reference counter. The
+/// ChunkHeader is copied together with the user-payload, therefore only chunks without user-header and a user-payload
+/// alignment not larger than the ChunkHeader alignment are eligible, since the user-payload offset must stay valid
+/// when the chunk is copied to a different address with the same alignment.
+struct InlineChunk
+{
+    static constexpr uint32_t CHUNK_SIZE{static_cast<uint32_t>(sizeof(ChunkHeader)) + MAX_INLINE_USER_PAYLOAD_SIZE};
+
+    /// the number of shared chunks which were pushed to the chunk queue before this chunk; it is set by the chunk
+    /// queue and used to provide inline and shared chunks in the order of their arrival
+    uint64_t m_queuePosition{0U};
+    alignas(alignof(ChunkHeader)) uint8_t m_chunk[CHUNK_SIZE];
+};
+
+/// @brief The InlineChunkSlots provide the memory for chunks which are transferred as InlineChunk. On the sender side
+/// a slot is loaned to the user like a chunk from a mempool and on the receiver side an InlineChunk is unpacked into a
+/// slot before it is passed to the user. This keeps the ChunkHeader based API for the user and avoids the mempool
+/// round-trip. Since the slots do not own any shared memory chunk, there is nothing to clean up if the user process
+/// terminates unexpectedly.
+/// @note this class is not thread-safe and intended to be used only from the runtime context, like the UsedChunkList
+template <uint32_t Capacity>
+class InlineChunkSlots
+{
+    static_assert(Capacity > 0U, "InlineChunkSlots Capacity must be larger than 0!");
+    static_assert(Capacity <= 64U, "InlineChunkSlots Capacity must not exceed 64!");
+
+  public:
+    /// @brief the chunk size of a slot, including the ChunkHeader
+    static constexpr uint32_t SLOT_SIZE{InlineChunk::CHUNK_SIZE};
+
+    InlineChunkSlots() noexcept = default;
+
+    InlineChunkSlots(const InlineChunkSlots&) = delete;
+    InlineChunkSlots(InlineChunkSlots&&) = delete;
+    InlineChunkSlots& operator=(const InlineChunkSlots&) = delete;
+    InlineChunkSlots& operator=(InlineChunkSlots&&) = delete;
+    ~InlineChunkSlots() noexcept = default;
+
+    /// @brief Checks whether a chunk with the provided settings can be transferred as InlineChunk
+    /// @param[in] chunkSettings of the chunk
+    /// @return true if there is no user-header and the user-payload fits into an InlineChunk, false otherwise
+    static bool fits(const ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Acquires a free slot and constructs a ChunkHeader with the provided settings in it
+    /// @param[in] chunkSettings of the chunk; they must fit into a slot
+    /// @return the ChunkHeader of the slot or a nullptr if there is no free slot
+    ChunkHeader* tryAcquire(const ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Acquires a free slot and unpacks the provided InlineChunk into it
+    /// @param[in] inlineChunk which shall be unpacked
+    /// @return the ChunkHeader of the slot or a nullptr if there is no free slot
+    ChunkHeader* tryAcquire(const InlineChunk& inlineChunk) noexcept;
+
+    /// @brief Checks whether a slot is available
+    /// @return true if there is at least one free slot, false otherwise
+    bool hasFreeSlot() const noexcept;
+
+    /// @brief Checks whether a ChunkHeader belongs to one of the acquired slots
+    /// @param[in] chunkHeader to check
+    /// @return true if the ChunkHeader is located in an acquired slot, false otherwise
+    bool contains(const ChunkHeader* const chunkHeader) const noexcept;
+
+    /// @brief Releases the slot of a ChunkHeader
+    /// @param[in] chunkHeader of the slot to release
+    /// @return true if the ChunkHeader was located in an acquired slot, false otherwise
+    bool release(const ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief Releases all slots
+    void releaseAll() noexcept;
+
+    /// @brief Packs the ChunkHeader and the user-payload of a chunk into an InlineChunk
+    /// @param[in] chunkHeader of the chunk; the chunk must fit into an InlineChunk
+    /// @param[out] inlineChunk which is filled with the data of the slot
+    static void pack(const ChunkHeader& chunkHeader, InlineChunk& inlineChunk) noexcept;
+
+  private:
+    cxx::optional<uint32_t> acquireSlotIndex() noexcept;
+    cxx::optional<uint32_t> slotIndexOf(const ChunkHeader* const chunkHeader) const noexcept;
+
+  private:
+    uint64_t m_acquiredSlots{0U};
+    alignas(alignof(ChunkHeader)) uint8_t m_slots[Capacity][SLOT_SIZE];
+};
+
+/// @brief The InlineChunkSlots without capacity are used by ports which never transfer InlineChunks, like the client and
+/// server ports. They take no memory for slots and never provide one.
+template <>
+class InlineChunkSlots<0U>
+{
+  public:
+    static constexpr uint32_t SLOT_SIZE{InlineChunk::CHUNK_SIZE};
+
+    static bool fits(const ChunkSettings&) noexcept
+    {
+        return false;
+    }
+
+    ChunkHeader* tryAcquire(const ChunkSettings&) noexcept
+    {
+        return nullptr;
+    }
+
+    ChunkHeader* tryAcquire(const InlineChunk&) noexcept
+    {
+        return nullptr;
+    }
+
+    bool hasFreeSlot() const noexcept
+    {
+        return false;
+    }
+
+    bool contains(const ChunkHeader* const) const noexcept
+    {
+        return false;
+    }
+
+    bool release(const ChunkHeader* const) noexcept
+    {
+        return false;
+    }
+
+    void releaseAll() noexcept
+    {
+    }
+
+    /// @note is never called since no slot can be acquired
+    static void pack(const ChunkHeader&, InlineChunk&) noexcept
+    {
+    }
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#include "iceoryx_posh/internal/mepoo/inline_chunk.inl"
+
+#endif // IOX_POSH_MEPOO_INLINE_CHUNK_HPP
@@ -0,0 +1,143 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_INLINE_CHUNK_INL
+#define IOX_POSH_MEPOO_INLINE_CHUNK_INL
+
+#include "iceoryx_posh/internal/mepoo/inline_chunk.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace iox
+{
+namespace mepoo
+{
+template <uint32_t Capacity>
+constexpr uint32_t InlineChunkSlots<Capacity>::SLOT_SIZE;
+
+template <uint32_t Capacity>
+inline bool InlineChunkSlots<Capacity>::fits(const ChunkSettings& chunkSettings) noexcept
+{
+    return chunkSettings.userHeaderSize() == 0U && chunkSettings.userPayloadSize() <= MAX_INLINE_USER_PAYLOAD_SIZE
+           && chunkSettings.userPayloadAlignment() <= alignof(ChunkHeader)
+           && chunkSettings.requiredChunkSize() <= SLOT_SIZE;
+}
+
+template <uint32_t Capacity>
+inline ChunkHeader* InlineChunkSlots<Capacity>::tryAcquire(const ChunkSettings& chunkSettings) noexcept
+{
+    cxx::Expects(fits(chunkSettings));
+
+    auto slotIndex = acquireSlotIndex();
+    if (!slotIndex.has_value())
+    {
+        return nullptr;
+    }
+
+    return new (&m_slots[slotIndex.value()][0]) ChunkHeader(SLOT_SIZE, chunkSettings);
+}
+
+template <uint32_t Capacity>
+inline ChunkHeader* InlineChunkSlots<Capacity>::tryAcquire(const InlineChunk& inlineChunk) noexcept
+{
+    auto slotIndex = acquireSlotIndex();
+    if (!slotIndex.has_value())
+    {
+        return nullptr;
+    }
+
+    std::memcpy(&m_slots[slotIndex.value()][0], &inlineChunk.m_chunk[0], SLOT_SIZE);
+    return reinterpret_cast<ChunkHeader*>(&m_slots[slotIndex.value()][0]);
+}
+
+template <uint32_t Capacity>
+inline bool InlineChunkSlots<Capacity>::hasFreeSlot() const noexcept
+{
+    constexpr uint64_t ALL_SLOTS_ACQUIRED{(Capacity == 64U) ? ~0ULL : ((1ULL << Capacity) - 1U)};
+    return m_acquiredSlots != ALL_SLOTS_ACQUIRED;
+}
+
+template <uint32_t Capacity>
+inline bool InlineChunkSlots<Capacity>::contains(const ChunkHeader* const chunkHeader) const noexcept
+{
+    auto slotIndex = slotIndexOf(chunkHeader);
+    return slotIndex.has_value() && ((m_acquiredSlots & (1ULL << slotIndex.value())) != 0U);
+}
+
+template <uint32_t Capacity>
+inline bool InlineChunkSlots<Capacity>::release(const ChunkHeader* const chunkHeader) noexcept
+{
+    if (!contains(chunkHeader))
+    {
+        return false;
+    }
+
+    m_acquiredSlots &= ~(1ULL << slotIndexOf(chunkHeader).value());
+    return true;
+}
+
+template <uint32_t Capacity>
+inline void InlineChunkSlots<Capacity>::releaseAll() noexcept
+{
+    m_acquiredSlots = 0U;
+}
+
+template <uint32_t Capacity>
+inline void InlineChunkSlots<Capacity>::pack(const ChunkHeader& chunkHeader, InlineChunk& inlineChunk) noexcept
+{
+    const auto usedSizeOfChunk = chunkHeader.usedSizeOfChunk();
+    // the chunk size must match the slots the InlineChunk is unpacked into
+    cxx::Expects(chunkHeader.userHeaderSize() == 0U && chunkHeader.chunkSize() == SLOT_SIZE);
+
+    std::memcpy(&inlineChunk.m_chunk[0], &chunkHeader, usedSizeOfChunk);
+}
+
+template <uint32_t Capacity>
+inline cxx::optional<uint32_t> InlineChunkSlots<Capacity>::acquireSlotIndex() noexcept
+{
+    for (uint32_t slotIndex = 0U; slotIndex < Capacity; ++slotIndex)
+    {
+        const uint64_t slotMask = 1ULL << slotIndex;
+        if ((m_acquiredSlots & slotMask) == 0U)
+        {
+            m_acquiredSlots |= slotMask;
+            return slotIndex;
+        }
+    }
+    return cxx::nullopt;
+}
+
+template <uint32_t Capacity>
+inline cxx::optional<uint32_t> InlineChunkSlots<Capacity>::slotIndexOf(const ChunkHeader* const chunkHeader) const
+    noexcept
+{
+    const auto address = reinterpret_cast<uint64_t>(chunkHeader);
+    const auto begin = reinterpret_cast<uint64_t>(&m_slots[0][0]);
+    const auto end = begin + static_cast<uint64_t>(Capacity) * SLOT_SIZE;
+
+    if (address < begin || address >= end || ((address - begin) % SLOT_SIZE) != 0U)
+    {
+        return cxx::nullopt;
+    }
+
+    return static_cast<uint32_t>((address - begin) / SLOT_SIZE);
+}
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_INLINE_CHUNK_INL
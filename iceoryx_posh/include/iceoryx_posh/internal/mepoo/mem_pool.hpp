@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <atomic>
@@ -69,11 +70,24 @@ class MemPool
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Returns the ChunkManagement of a chunk. The ChunkManagement is located in an array parallel to the chunk
+    /// memory at the index of the chunk, therefore it is acquired and released together with the chunk.
+    /// @param[in] chunk which was acquired from this MemPool
+    /// @return the pointer to the ChunkManagement of the chunk; the ChunkManagement must be constructed by the caller
+    ChunkManagement* getChunkManagement(const void* chunk) noexcept;
+
+    /// @brief Calculates the memory which is required from the management allocator
+    /// @param[in] numberOfChunks of the MemPool
+    /// @return the memory size for the free list indices and the ChunkManagement array
+    static uint64_t requiredManagementMemorySize(const uint32_t numberOfChunks) noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
+    uint32_t indexOfChunk(const void* chunk) const noexcept;
 
     rp::RelativePointer<uint8_t> m_rawMemory;
+    rp::RelativePointer<ChunkManagement> m_chunkManagements;
 
     uint32_t m_chunkSize{0U};
     /// needs to be 32 bit since loffli supports only 32 bit numbers
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_layout_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
@@ -69,6 +70,13 @@ class MemoryManager
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk from the mempools and initializes the ChunkHeader from the ChunkLayoutCache if possible
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkLayoutCache which provided the chunkSettings
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings,
+                                               const ChunkLayoutCache& chunkLayoutCache) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -85,14 +93,13 @@ class MemoryManager
                     posix::Allocator& chunkMemoryAllocator,
                     const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
-    void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
+    cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings,
+                                               const ChunkLayoutCache* const chunkLayoutCache) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
-    uint32_t m_totalNumberOfChunks{0};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
-    cxx::vector<MemPool, 1> m_chunkManagementPool;
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
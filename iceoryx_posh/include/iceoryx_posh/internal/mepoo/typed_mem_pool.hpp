@@ -71,7 +71,6 @@ class TypedMemPool
 
   private:
     MemPool m_memPool;
-    MemPool m_chunkManagementPool;
 };
 } // namespace mepoo
 } // namespace iox
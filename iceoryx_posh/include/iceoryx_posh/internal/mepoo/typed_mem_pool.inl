@@ -31,7 +31,6 @@ inline TypedMemPool<T>::TypedMemPool(const cxx::greater_or_equal<uint32_t, 1> nu
                                      posix::Allocator& managementAllocator,
                                      posix::Allocator& chunkMemoryAllocator) noexcept
     : m_memPool(static_cast<uint32_t>(requiredChunkSize()), numberOfChunks, managementAllocator, chunkMemoryAllocator)
-    , m_chunkManagementPool(sizeof(ChunkManagement), numberOfChunks, managementAllocator, managementAllocator)
 {
 }
 
@@ -44,19 +43,12 @@ inline cxx::expected<ChunkManagement*, TypedMemPoolError> TypedMemPool<T>::acqui
         return cxx::error<TypedMemPoolError>(TypedMemPoolError::OutOfChunks);
     }
 
-    ChunkManagement* chunkManagement = static_cast<ChunkManagement*>(m_chunkManagementPool.getChunk());
-    if (chunkManagement == nullptr)
-    {
-        errorHandler(PoshError::MEPOO__TYPED_MEMPOOL_HAS_INCONSISTENT_STATE);
-        return cxx::error<TypedMemPoolError>(TypedMemPoolError::FatalErrorReachedInconsistentState);
-    }
-
     auto chunkSettingsResult = mepoo::ChunkSettings::create(sizeof(T), alignof(T));
     // this is safe since we use correct values for size and alignment
     auto& chunkSettings = chunkSettingsResult.value();
 
     new (chunkHeader) ChunkHeader(m_memPool.getChunkSize(), chunkSettings);
-    new (chunkManagement) ChunkManagement(chunkHeader, &m_memPool, &m_chunkManagementPool);
+    auto chunkManagement = new (m_memPool.getChunkManagement(chunkHeader)) ChunkManagement(chunkHeader, &m_memPool);
 
     return cxx::success<ChunkManagement*>(chunkManagement);
 }
@@ -136,12 +128,7 @@ inline uint64_t TypedMemPool<T>::requiredChunkSize() noexcept
 template <typename T>
 inline uint64_t TypedMemPool<T>::requiredManagementMemorySize(const uint64_t f_numberOfChunks) noexcept
 {
-    uint64_t memorySizeForManagementPoolChunks =
-        cxx::align(f_numberOfChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    uint64_t memorySizeForIndices = MemPool::freeList_t::requiredIndexMemorySize(f_numberOfChunks);
-    uint64_t memorySizeForIndicesOfManangementAndDataMemPools =
-        2 * cxx::align(static_cast<uint64_t>(memorySizeForIndices), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    return memorySizeForManagementPoolChunks + memorySizeForIndicesOfManangementAndDataMemPools;
+    return MemPool::requiredManagementMemorySize(static_cast<uint32_t>(f_numberOfChunks));
 }
 
 template <typename T>
@@ -0,0 +1,178 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_IMPL_HPP
+#define IOX_POSH_POPO_ASYNC_CLIENT_IMPL_HPP
+
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/stack.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/client_impl.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+enum class AsyncClientSendError
+{
+    TOO_MANY_REQUESTS_IN_FLIGHT,
+    NO_CONNECT_REQUESTED,
+    SERVER_NOT_AVAILABLE,
+    INVALID_REQUEST,
+};
+
+/// @brief Converts the AsyncClientSendError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const AsyncClientSendError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with std::ostream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline std::ostream& operator<<(std::ostream& stream, AsyncClientSendError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncClientSendError value) noexcept;
+} // namespace popo
+
+namespace cxx
+{
+template <>
+constexpr popo::AsyncClientSendError
+from<popo::ClientSendError, popo::AsyncClientSendError>(const popo::ClientSendError value) noexcept;
+} // namespace cxx
+
+namespace popo
+{
+/// @brief The AsyncClientImpl class extends the typed client API with pipelined requests. Each request sent with
+/// 'sendAsync' is tagged with a unique sequence ID and the corresponding response is passed to the callback which was
+/// provided along with the request once 'dispatchResponses' is called, e.g. by a Listener.
+/// @note Not intended for public usage! Use the `AsyncClient` instead!
+/// @note A pending request whose response was lost, e.g. to a response queue overflow, would occupy its slot until it
+/// is cancelled. Therefore pending requests expire after the response timeout and, when 'dispatchResponses' detects a
+/// response queue overflow, all pending requests which were sent before the newest dispatched response expire too,
+/// since a server answers the requests of a client in order.
+/// @note 'sendAsync', 'cancel', 'expireRequests' and 'dispatchResponses' can be called concurrently, e.g. from a worker
+/// thread and the Listener thread. Only one thread must call 'dispatchResponses' at a time. The callbacks are called
+/// without any internal lock being held, therefore 'sendAsync' can be called from within a callback.
+template <typename Req, typename Res, typename BaseClientT = BaseClient<>>
+class AsyncClientImpl : public ClientImpl<Req, Res, BaseClientT>
+{
+    using Impl = ClientImpl<Req, Res, BaseClientT>;
+
+  public:
+    using ResponseCallback = cxx::function<void(Response<const Res>&)>;
+
+    static constexpr uint32_t MAX_REQUESTS_IN_FLIGHT{MAX_REQUESTS_IN_FLIGHT_PER_CLIENT};
+    static constexpr int64_t INVALID_SEQUENCE_ID{-1};
+    static constexpr units::Duration NO_RESPONSE_TIMEOUT{units::Duration::max()};
+
+    /// @brief Constructor for an async client
+    /// @param[in] service is the ServiceDescription for the new client
+    /// @param[in] clientOptions like the queue capacity and the number of requests in flight; the response queue
+    /// capacity is raised to the number of requests in flight if it is smaller, at most to MAX_RESPONSE_QUEUE_CAPACITY
+    /// @param[in] responseTimeout after which a pending request expires and its response will be discarded
+    explicit AsyncClientImpl(const capro::ServiceDescription& service,
+                             const ClientOptions& clientOptions = {},
+                             const units::Duration responseTimeout = NO_RESPONSE_TIMEOUT) noexcept;
+    virtual ~AsyncClientImpl() noexcept = default;
+
+    AsyncClientImpl(const AsyncClientImpl&) = delete;
+    AsyncClientImpl(AsyncClientImpl&&) = delete;
+    AsyncClientImpl& operator=(const AsyncClientImpl&) = delete;
+    AsyncClientImpl& operator=(AsyncClientImpl&&) = delete;
+
+    /// @brief Sends the given Request and registers the callback for the corresponding Response
+    /// @param[in] request to send; the sequence ID of the request is overwritten
+    /// @param[in] callback which is called with the Response by 'dispatchResponses'
+    /// @return the sequence ID of the request which can be used to cancel it or an error if the request could not be
+    /// sent, e.g. when ClientOptions::maxRequestsInFlight requests are already pending
+    cxx::expected<int64_t, AsyncClientSendError> sendAsync(Request<Req>&& request,
+                                                           const ResponseCallback& callback) noexcept;
+
+    /// @brief Takes all available Responses and calls the callback of the corresponding request. Responses without a
+    /// pending request, e.g. of a cancelled request, are released.
+    /// @return the number of callbacks which were called
+    uint64_t dispatchResponses() noexcept;
+
+    /// @brief Removes the pending request with the given sequence ID; its response will be discarded
+    /// @param[in] sequenceId which was returned by 'sendAsync'
+    /// @return true if the request was pending, otherwise false
+    bool cancel(const int64_t sequenceId) noexcept;
+
+    /// @brief Removes the pending requests whose response timeout has passed; their responses will be discarded
+    /// @return the number of expired requests
+    /// @note this is also done by 'dispatchResponses' and by 'sendAsync' if no request can be sent otherwise
+    uint64_t expireRequests() noexcept;
+
+    /// @brief Get the number of requests which were sent but whose response was not yet dispatched
+    /// @return the number of pending requests
+    uint64_t numberOfRequestsInFlight() const noexcept;
+
+    /// @brief Get the maximum number of pending requests
+    /// @return the maximum number of pending requests, i.e. ClientOptions::maxRequestsInFlight limited by
+    /// MAX_REQUESTS_IN_FLIGHT
+    uint64_t maxRequestsInFlight() const noexcept;
+
+  protected:
+    using BaseClientT::port;
+
+  private:
+    using Clock_t = std::chrono::steady_clock;
+
+    struct PendingRequest
+    {
+        int64_t sequenceId{INVALID_SEQUENCE_ID};
+        ResponseCallback callback;
+        Clock_t::time_point deadline;
+    };
+
+    static ClientOptions withResponseQueueForRequestsInFlight(const ClientOptions& clientOptions) noexcept;
+
+    /// @note must be called with m_pendingMutex being locked
+    void releaseSlot(const uint32_t slot) noexcept;
+
+    /// @brief Removes the pending requests which were sent before the given one
+    uint64_t expireRequestsSentBefore(const int64_t sequenceId) noexcept;
+
+    /// @note the slot of a pending request is encoded in the lower digits of its sequence ID which allows a lookup
+    /// without search; the upper digits make the sequence ID unique
+    static uint32_t slotOf(const int64_t sequenceId) noexcept;
+
+    mutable std::mutex m_pendingMutex;
+    PendingRequest m_pendingRequests[MAX_REQUESTS_IN_FLIGHT];
+    cxx::stack<uint32_t, MAX_REQUESTS_IN_FLIGHT> m_freeSlots;
+    uint64_t m_maxRequestsInFlight{0U};
+    units::Duration m_responseTimeout{NO_RESPONSE_TIMEOUT};
+    int64_t m_sequenceCounter{1};
+};
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/async_client_impl.inl"
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_IMPL_HPP
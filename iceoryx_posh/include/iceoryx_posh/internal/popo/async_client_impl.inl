@@ -0,0 +1,307 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_IMPL_INL
+#define IOX_POSH_POPO_ASYNC_CLIENT_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/async_client_impl.hpp"
+
+namespace iox
+{
+namespace cxx
+{
+template <>
+constexpr popo::AsyncClientSendError
+from<popo::ClientSendError, popo::AsyncClientSendError>(const popo::ClientSendError value) noexcept
+{
+    switch (value)
+    {
+    case popo::ClientSendError::NO_CONNECT_REQUESTED:
+        return popo::AsyncClientSendError::NO_CONNECT_REQUESTED;
+    case popo::ClientSendError::SERVER_NOT_AVAILABLE:
+        return popo::AsyncClientSendError::SERVER_NOT_AVAILABLE;
+    case popo::ClientSendError::INVALID_REQUEST:
+        return popo::AsyncClientSendError::INVALID_REQUEST;
+    }
+    return popo::AsyncClientSendError::INVALID_REQUEST;
+}
+} // namespace cxx
+
+namespace popo
+{
+inline constexpr const char* asStringLiteral(const AsyncClientSendError value) noexcept
+{
+    switch (value)
+    {
+    case AsyncClientSendError::TOO_MANY_REQUESTS_IN_FLIGHT:
+        return "AsyncClientSendError::TOO_MANY_REQUESTS_IN_FLIGHT";
+    case AsyncClientSendError::NO_CONNECT_REQUESTED:
+        return "AsyncClientSendError::NO_CONNECT_REQUESTED";
+    case AsyncClientSendError::SERVER_NOT_AVAILABLE:
+        return "AsyncClientSendError::SERVER_NOT_AVAILABLE";
+    case AsyncClientSendError::INVALID_REQUEST:
+        return "AsyncClientSendError::INVALID_REQUEST";
+    }
+
+    return "[Undefined AsyncClientSendError]";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, AsyncClientSendError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncClientSendError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+constexpr uint32_t AsyncClientImpl<Req, Res, BaseClientT>::MAX_REQUESTS_IN_FLIGHT;
+template <typename Req, typename Res, typename BaseClientT>
+constexpr int64_t AsyncClientImpl<Req, Res, BaseClientT>::INVALID_SEQUENCE_ID;
+template <typename Req, typename Res, typename BaseClientT>
+constexpr units::Duration AsyncClientImpl<Req, Res, BaseClientT>::NO_RESPONSE_TIMEOUT;
+
+template <typename Req, typename Res, typename BaseClientT>
+AsyncClientImpl<Req, Res, BaseClientT>::AsyncClientImpl(const capro::ServiceDescription& service,
+                                                        const ClientOptions& clientOptions,
+                                                        const units::Duration responseTimeout) noexcept
+    : Impl(service, withResponseQueueForRequestsInFlight(clientOptions))
+    , m_maxRequestsInFlight(algorithm::min(clientOptions.maxRequestsInFlight,
+                                           static_cast<uint64_t>(MAX_REQUESTS_IN_FLIGHT)))
+    , m_responseTimeout(responseTimeout)
+{
+    if (clientOptions.maxRequestsInFlight > MAX_REQUESTS_IN_FLIGHT)
+    {
+        LogWarn() << "Requested " << clientOptions.maxRequestsInFlight
+                  << " requests in flight but the AsyncClient supports only " << MAX_REQUESTS_IN_FLIGHT
+                  << "! Limiting to " << MAX_REQUESTS_IN_FLIGHT << ".";
+    }
+
+    // the slots are handed out in ascending order
+    for (uint64_t i = m_maxRequestsInFlight; i > 0U; --i)
+    {
+        m_freeSlots.push(static_cast<uint32_t>(i - 1U));
+    }
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline ClientOptions AsyncClientImpl<Req, Res, BaseClientT>::withResponseQueueForRequestsInFlight(
+    const ClientOptions& clientOptions) noexcept
+{
+    // each request in flight needs space for its response, otherwise the responses are discarded; the response queue
+    // in the shared memory is limited to MAX_RESPONSE_QUEUE_CAPACITY though
+    auto options = clientOptions;
+    const auto maxRequestsInFlight =
+        algorithm::min(clientOptions.maxRequestsInFlight, static_cast<uint64_t>(MAX_REQUESTS_IN_FLIGHT));
+    options.responseQueueCapacity = algorithm::max(
+        options.responseQueueCapacity,
+        algorithm::min(maxRequestsInFlight, static_cast<uint64_t>(MAX_RESPONSE_QUEUE_CAPACITY)));
+    return options;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint32_t AsyncClientImpl<Req, Res, BaseClientT>::slotOf(const int64_t sequenceId) noexcept
+{
+    return static_cast<uint32_t>(static_cast<uint64_t>(sequenceId) % MAX_REQUESTS_IN_FLIGHT);
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline cxx::expected<int64_t, AsyncClientSendError>
+AsyncClientImpl<Req, Res, BaseClientT>::sendAsync(Request<Req>&& request, const ResponseCallback& callback) noexcept
+{
+    if (numberOfRequestsInFlight() == m_maxRequestsInFlight)
+    {
+        expireRequests();
+    }
+
+    int64_t sequenceId{INVALID_SEQUENCE_ID};
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        auto slot = m_freeSlots.pop();
+        if (!slot.has_value())
+        {
+            // the request goes out of scope and releases its chunk
+            return cxx::error<AsyncClientSendError>(AsyncClientSendError::TOO_MANY_REQUESTS_IN_FLIGHT);
+        }
+        sequenceId = m_sequenceCounter * static_cast<int64_t>(MAX_REQUESTS_IN_FLIGHT) + static_cast<int64_t>(*slot);
+        ++m_sequenceCounter;
+
+        // the pending request must be registered before sending since the response might be dispatched concurrently
+        auto& pendingRequest = m_pendingRequests[*slot];
+        pendingRequest.sequenceId = sequenceId;
+        pendingRequest.callback = callback;
+        if (m_responseTimeout != NO_RESPONSE_TIMEOUT)
+        {
+            pendingRequest.deadline = Clock_t::now() + std::chrono::nanoseconds(m_responseTimeout.toNanoseconds());
+        }
+    }
+
+    request.getRequestHeader().setSequenceId(sequenceId);
+    auto result = Impl::send(std::move(request));
+    if (result.has_error())
+    {
+        cancel(sequenceId);
+        return cxx::error<AsyncClientSendError>(cxx::into<AsyncClientSendError>(result.get_error()));
+    }
+
+    return cxx::success<int64_t>(sequenceId);
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::dispatchResponses() noexcept
+{
+    expireRequests();
+
+    uint64_t numberOfDispatchedResponses{0U};
+    int64_t newestSequenceId{INVALID_SEQUENCE_ID};
+    while (true)
+    {
+        auto result = Impl::take();
+        if (result.has_error())
+        {
+            break;
+        }
+        auto& response = result.value();
+
+        const auto sequenceId = response.getResponseHeader().getSequenceId();
+        newestSequenceId = algorithm::max(newestSequenceId, sequenceId);
+        ResponseCallback callback;
+        if (sequenceId >= static_cast<int64_t>(MAX_REQUESTS_IN_FLIGHT))
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            const auto slot = slotOf(sequenceId);
+            auto& pendingRequest = m_pendingRequests[slot];
+            if (pendingRequest.sequenceId == sequenceId)
+            {
+                callback.swap(pendingRequest.callback);
+                releaseSlot(slot);
+            }
+        }
+
+        // the callback is called without the lock being held in order to allow sending new requests from the callback
+        if (callback)
+        {
+            callback(response);
+            ++numberOfDispatchedResponses;
+        }
+    }
+
+    if (port().hasLostResponsesSinceLastCall())
+    {
+        const auto numberOfExpiredRequests = expireRequestsSentBefore(newestSequenceId);
+        if (numberOfExpiredRequests > 0U)
+        {
+            LogWarn() << "The response queue overflowed! " << numberOfExpiredRequests
+                      << " pending requests expired since their responses were discarded.";
+        }
+    }
+
+    return numberOfDispatchedResponses;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline bool AsyncClientImpl<Req, Res, BaseClientT>::cancel(const int64_t sequenceId) noexcept
+{
+    if (sequenceId < static_cast<int64_t>(MAX_REQUESTS_IN_FLIGHT))
+    {
+        return false;
+    }
+
+    ResponseCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        const auto slot = slotOf(sequenceId);
+        auto& pendingRequest = m_pendingRequests[slot];
+        if (pendingRequest.sequenceId != sequenceId)
+        {
+            return false;
+        }
+        callback.swap(pendingRequest.callback);
+        releaseSlot(slot);
+    }
+    return true;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::expireRequests() noexcept
+{
+    if (m_responseTimeout == NO_RESPONSE_TIMEOUT)
+    {
+        return 0U;
+    }
+
+    const auto now = Clock_t::now();
+    uint64_t numberOfExpiredRequests{0U};
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    for (uint32_t slot = 0U; slot < m_maxRequestsInFlight; ++slot)
+    {
+        const auto& pendingRequest = m_pendingRequests[slot];
+        if (pendingRequest.sequenceId != INVALID_SEQUENCE_ID && pendingRequest.deadline <= now)
+        {
+            releaseSlot(slot);
+            ++numberOfExpiredRequests;
+        }
+    }
+    return numberOfExpiredRequests;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::expireRequestsSentBefore(const int64_t sequenceId) noexcept
+{
+    uint64_t numberOfExpiredRequests{0U};
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    for (uint32_t slot = 0U; slot < m_maxRequestsInFlight; ++slot)
+    {
+        const auto& pendingRequest = m_pendingRequests[slot];
+        if (pendingRequest.sequenceId != INVALID_SEQUENCE_ID && pendingRequest.sequenceId < sequenceId)
+        {
+            releaseSlot(slot);
+            ++numberOfExpiredRequests;
+        }
+    }
+    return numberOfExpiredRequests;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline void AsyncClientImpl<Req, Res, BaseClientT>::releaseSlot(const uint32_t slot) noexcept
+{
+    auto& pendingRequest = m_pendingRequests[slot];
+    ResponseCallback().swap(pendingRequest.callback);
+    pendingRequest.sequenceId = INVALID_SEQUENCE_ID;
+    m_freeSlots.push(slot);
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::numberOfRequestsInFlight() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    return m_maxRequestsInFlight - m_freeSlots.size();
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::maxRequestsInFlight() const noexcept
+{
+    return m_maxRequestsInFlight;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_IMPL_INL
@@ -17,14 +17,18 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 
-#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
 
 namespace iox
 {
@@ -59,6 +63,11 @@ enum class ChunkDistributorError
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
 /// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
 /// A perfect job for our future selves
+///
+/// About Blocking:
+/// With ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER a delivery to a full queue with QueueFullPolicy::BLOCK_PRODUCER
+/// sleeps on the semaphore of the queue until the consumer takes a chunk, the queue is removed or the
+/// m_waitForConsumerTimeout has passed. The lock is not held while sleeping.
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -102,21 +111,36 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks to all the stored chunk queues with one pass over the queues. Every
+    /// queue receives the chunks in the provided order and its consumer is notified only once for all the chunks. The
+    /// chunks will be added to the chunk history
+    /// @param[in] chunks is a pointer to the first SharedChunk to be delivered
+    /// @param[in] numberOfChunks is the number of SharedChunks to be delivered
+    /// @return the number of queues the chunks were delivered to
+    uint64_t deliverToAllStoredQueues(const mepoo::SharedChunk* const chunks, const uint64_t numberOfChunks) noexcept;
+
+    /// @brief Deliver the provided inline chunk to all the stored chunk queues. Since an inline chunk is copied into
+    /// the queues, it will NOT be added to the chunk history
+    /// @param[in] chunk is the InlineChunk to be delivered
+    /// @return the number of queues the chunk was delivered to
+    uint64_t deliverInlineToAllStoredQueues(const mepoo::InlineChunk& chunk) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
-    /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId
+    /// @param[in] lastKnownQueueIndex is the slot handle used for a fast lookup of the queue with uniqueQueueId
     /// @param[in] chunk is the SharedChunk to be delivered
     /// @return ChunkDistributorError if the queue was not found
     cxx::expected<ChunkDistributorError> deliverToQueue(const cxx::UniqueId uniqueQueueId,
                                                         const uint32_t lastKnownQueueIndex,
                                                         mepoo::SharedChunk chunk) noexcept;
 
-    /// @brief Lookup for the index of a queue with a specific cxx::UniqueId
+    /// @brief Lookup for the slot index of a queue with a specific cxx::UniqueId. The slot index of a queue does not
+    /// change as long as the queue is stored and can therefore be used as handle for the queue
     /// @param[in] uniqueQueueId is the unique ID of the queue to query the index
-    /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId; if the queue is not
-    /// found at the index, the queue is searched by iteration over all stored queues
-    /// @return the index of the queue with uniqueQueueId or cxx::nullopt if the queue was not found
+    /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId without taking the
+    /// lock; if the queue is not found at the index, the queue is searched by iteration over all slots
+    /// @return the slot index of the queue with uniqueQueueId or cxx::nullopt if the queue was not found
     cxx::optional<uint32_t> getQueueIndex(const cxx::UniqueId uniqueQueueId,
                                           const uint32_t lastKnownQueueIndex) const noexcept;
 
@@ -144,6 +168,37 @@ class ChunkDistributor
     MemberType_t* getMembers() noexcept;
 
     bool pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
+    bool pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue, const mepoo::InlineChunk& chunk) noexcept;
+
+  private:
+    using QueueSlot_t = typename MemberType_t::QueueSlot;
+
+    /// @brief the upper bound for waiting until the producers stopped waiting for space in a removed queue; a woken up
+    /// producer leaves immediately, only a producer which died while it was waiting never does
+    static constexpr units::Duration MAX_WAITING_TIME_FOR_LEAVING_PRODUCERS{units::Duration::fromSeconds(1U)};
+
+    template <typename ChunkType>
+    uint64_t deliverToAllStoredQueuesWithoutHistory(const ChunkType& chunk) noexcept;
+
+    /// @brief must be called with the lock held
+    bool isQueueStored(const rp::RelativePointer<ChunkQueueData_t>& queue) const noexcept;
+
+    /// @brief sleeps until the consumer of the queue took a chunk, the queue was removed or the timeout has passed;
+    /// returns immediately if the queue is not stored or not full anymore. Must be called without the lock held
+    void waitForSpaceInQueue(const rp::RelativePointer<ChunkQueueData_t>& queue,
+                             const bool waitForInlineQueue,
+                             const units::Duration& timeout) noexcept;
+
+    /// @brief the part of m_waitForConsumerTimeout which is left for a wait which started at waitStart
+    units::Duration remainingTimeToWait(const std::chrono::steady_clock::time_point& waitStart) const noexcept;
+
+    /// @brief must be called with the lock held when a queue is removed; new producers do not find the queue in the
+    /// slot anymore and the handles of the queue become invalid
+    static void invalidateQueueSlot(QueueSlot_t& slot) noexcept;
+
+    /// @brief must be called without the lock after the slot of the removed queue was invalidated; wakes up the
+    /// producers which wait for space in the queue and returns when they stopped accessing the queue
+    static void releaseProducersWaitingForSpace(QueueSlot_t& slot, ChunkQueueData_t* const queue) noexcept;
 
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
@@ -23,6 +23,9 @@ namespace iox
 {
 namespace popo
 {
+template <typename ChunkDistributorDataType>
+constexpr units::Duration ChunkDistributor<ChunkDistributorDataType>::MAX_WAITING_TIME_FOR_LEAVING_PRODUCERS;
+
 template <typename ChunkDistributorDataType>
 inline ChunkDistributor<ChunkDistributorDataType>::ChunkDistributor(
     cxx::not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept
@@ -64,6 +67,32 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
             // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
             getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
 
+            // there is a free slot since the slots and the queue container have the same capacity; a slot whose
+            // removed queue still has producers waiting for space is only taken if there is no other free slot
+            QueueSlot_t* freeSlot{nullptr};
+            for (auto& slot : getMembers()->m_queueSlots)
+            {
+                if (slot.m_uniqueQueueId.load(std::memory_order_relaxed) == MemberType_t::INVALID_UNIQUE_QUEUE_ID)
+                {
+                    const bool hasWaitingProducers =
+                        slot.m_numberOfWaitingProducers.load(std::memory_order_acquire) > 0U;
+                    if (freeSlot == nullptr || !hasWaitingProducers)
+                    {
+                        freeSlot = &slot;
+                    }
+                    if (!hasWaitingProducers)
+                    {
+                        break;
+                    }
+                }
+            }
+            // the remaining producers did not leave within MAX_WAITING_TIME_FOR_LEAVING_PRODUCERS and are considered
+            // dead, otherwise the slot would stay blocked for every queue it is assigned to
+            freeSlot->m_numberOfWaitingProducers.store(0U, std::memory_order_relaxed);
+            freeSlot->m_queue = rp::RelativePointer<ChunkQueueData_t>(queueToAdd);
+            freeSlot->m_uniqueQueueId.store(static_cast<uint64_t>(freeSlot->m_queue->m_uniqueId),
+                                            std::memory_order_release);
+
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
             if (requestedHistory > getMembers()->m_historyCapacity)
@@ -100,28 +129,66 @@ template <typename ChunkDistributorDataType>
 inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(
     cxx::not_null<ChunkQueueData_t* const> queueToRemove) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
-    const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
-    if (iter != getMembers()->m_queues.end())
+    QueueSlot_t* removedSlot{nullptr};
     {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
+        if (iter == getMembers()->m_queues.end())
+        {
+            return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+        }
         // PRQA S 3804 1 # we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
 
-        return cxx::success<void>();
+        for (auto& slot : getMembers()->m_queueSlots)
+        {
+            if (slot.m_queue == queueToRemove)
+            {
+                removedSlot = &slot;
+                invalidateQueueSlot(slot);
+                break;
+            }
+        }
     }
-    else
+
+    // the waiting producers are released without the lock, otherwise every delivery would be blocked until they left
+    if (removedSlot != nullptr)
     {
-        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+        releaseProducersWaitingForSpace(*removedSlot, queueToRemove);
     }
+
+    return cxx::success<void>();
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    struct RemovedQueue
+    {
+        QueueSlot_t* m_slot{nullptr};
+        ChunkQueueData_t* m_queue{nullptr};
+    };
+    cxx::vector<RemovedQueue, ChunkDistributorDataType::ChunkDistributorDataProperties_t::MAX_QUEUES> removedQueues;
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        getMembers()->m_queues.clear();
+
+        for (auto& slot : getMembers()->m_queueSlots)
+        {
+            if (slot.m_queue)
+            {
+                removedQueues.emplace_back(RemovedQueue{&slot, slot.m_queue.get()});
+            }
+            invalidateQueueSlot(slot);
+        }
+    }
 
-    getMembers()->m_queues.clear();
+    for (auto& removedQueue : removedQueues)
+    {
+        releaseProducersWaitingForSpace(*removedQueue.m_slot, removedQueue.m_queue);
+    }
 }
 
 template <typename ChunkDistributorDataType>
@@ -134,6 +201,133 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
+{
+    auto numberOfQueuesTheChunkWasDeliveredTo = deliverToAllStoredQueuesWithoutHistory(chunk);
+
+    addToHistoryWithoutDelivery(chunk);
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(
+    const mepoo::SharedChunk* const chunks, const uint64_t numberOfChunks) noexcept
+{
+    if (numberOfChunks == 0U)
+    {
+        return 0U;
+    }
+
+    /// @brief a blocking queue which was full and still waits for the chunks starting with m_nextChunk
+    struct PendingQueue
+    {
+        rp::RelativePointer<ChunkQueueData_t> m_queue;
+        uint64_t m_nextChunk{0U};
+    };
+
+    // pushes the chunks starting with nextChunk until the queue is full and notifies the consumer once; returns the
+    // index of the first chunk which was not delivered
+    auto pushChunksToQueue = [&](ChunkQueueData_t* const queue, const bool isBlockingQueue, uint64_t nextChunk) {
+        ChunkQueuePusher_t pusher(queue);
+        for (; nextChunk < numberOfChunks; ++nextChunk)
+        {
+            if (!pusher.pushWithoutNotification(chunks[nextChunk]))
+            {
+                if (isBlockingQueue)
+                {
+                    break;
+                }
+                pusher.lostAChunk();
+            }
+        }
+        pusher.notify();
+        return nextChunk;
+    };
+
+    uint64_t numberOfQueuesTheChunksWereDeliveredTo{0U};
+    cxx::vector<PendingQueue, ChunkDistributorDataType::ChunkDistributorDataProperties_t::MAX_QUEUES> pendingQueues;
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+        for (auto& queue : getMembers()->m_queues)
+        {
+            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            auto nextChunk = pushChunksToQueue(queue.get(), isBlockingQueue, 0U);
+            if (nextChunk == numberOfChunks)
+            {
+                ++numberOfQueuesTheChunksWereDeliveredTo;
+            }
+            else
+            {
+                pendingQueues.emplace_back(PendingQueue{queue, nextChunk});
+            }
+        }
+    }
+
+    // sleep until the consumers made space for the remaining chunks; the consumers of the pending queues were already
+    // notified. Since the chunks must be delivered to every pending queue, it is sufficient to wait for one of them
+    const auto waitStart = std::chrono::steady_clock::now();
+    while (!pendingQueues.empty())
+    {
+        const auto remainingTime = remainingTimeToWait(waitStart);
+        const bool hasTimedOut = (remainingTime == units::Duration::zero());
+        if (!hasTimedOut)
+        {
+            waitForSpaceInQueue(pendingQueues.front().m_queue, false, remainingTime);
+        }
+
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        for (uint64_t i = pendingQueues.size(); i > 0U; --i)
+        {
+            auto& pendingQueue = pendingQueues[i - 1U];
+            // it is possible that since the last iteration some subscriber have already unsubscribed and the chunks
+            // must not be delivered to dead queues
+            bool isStillStored = isQueueStored(pendingQueue.m_queue);
+            if (isStillStored)
+            {
+                pendingQueue.m_nextChunk =
+                    pushChunksToQueue(pendingQueue.m_queue.get(), true, pendingQueue.m_nextChunk);
+                if (pendingQueue.m_nextChunk == numberOfChunks)
+                {
+                    ++numberOfQueuesTheChunksWereDeliveredTo;
+                }
+                else if (hasTimedOut)
+                {
+                    ChunkQueuePusher_t(pendingQueue.m_queue.get()).lostAChunk();
+                }
+            }
+            if (!isStillStored || pendingQueue.m_nextChunk == numberOfChunks || hasTimedOut)
+            {
+                pendingQueues.erase(pendingQueues.begin() + (i - 1U));
+            }
+        }
+    }
+
+    // chunks which would immediately be removed from the history again are not added
+    const auto historyCapacity = getMembers()->m_historyCapacity;
+    for (uint64_t i = (numberOfChunks > historyCapacity) ? numberOfChunks - historyCapacity : 0U; i < numberOfChunks;
+         ++i)
+    {
+        addToHistoryWithoutDelivery(chunks[i]);
+    }
+
+    return numberOfQueuesTheChunksWereDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverInlineToAllStoredQueues(const mepoo::InlineChunk& chunk) noexcept
+{
+    return deliverToAllStoredQueuesWithoutHistory(chunk);
+}
+
+template <typename ChunkDistributorDataType>
+template <typename ChunkType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueuesWithoutHistory(const ChunkType& chunk) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
@@ -165,48 +359,44 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
         }
     }
 
-    // busy waiting until every queue is served
-    cxx::internal::adaptive_wait adaptiveWait;
+    // sleep until the consumers made space in the remaining queues; since the chunk must be delivered to every
+    // remaining queue, it is sufficient to wait for one of them
+    constexpr bool IS_INLINE_CHUNK{std::is_same<ChunkType, mepoo::InlineChunk>::value};
+    const auto waitStart = std::chrono::steady_clock::now();
     while (!remainingQueues.empty())
     {
-        adaptiveWait.wait();
+        const auto remainingTime = remainingTimeToWait(waitStart);
+        const bool hasTimedOut = (remainingTime == units::Duration::zero());
+        if (!hasTimedOut)
         {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end());
-            std::sort(remainingQueues.begin(), remainingQueues.end());
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin());
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+            waitForSpaceInQueue(remainingQueues.front(), IS_INLINE_CHUNK, remainingTime);
+        }
+
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        for (uint64_t i = remainingQueues.size(); i > 0U; --i)
+        {
+            auto& queue = remainingQueues[i - 1U];
+            // it is possible that since the last iteration some subscriber have already unsubscribed and the chunk
+            // must not be delivered to dead queues
+            bool isStillStored = isQueueStored(queue);
+            bool isDelivered = isStillStored && pushToQueue(queue.get(), chunk);
+            if (isDelivered)
             {
-                if (pushToQueue(remainingQueues[i].get(), chunk))
-                {
-                    remainingQueues.erase(remainingQueues.begin() + i);
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                }
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+            }
+            else if (isStillStored && hasTimedOut)
+            {
+                ChunkQueuePusher_t(queue.get()).lostAChunk();
+            }
 
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
-                {
-                    break;
-                }
+            if (!isStillStored || isDelivered || hasTimedOut)
+            {
+                remainingQueues.erase(remainingQueues.begin() + (i - 1U));
             }
         }
     }
 
-    addToHistoryWithoutDelivery(chunk);
-
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
@@ -217,45 +407,152 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(cxx::not_nul
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
+                                                                    const mepoo::InlineChunk& chunk) noexcept
+{
+    return ChunkQueuePusher_t(queue).push(chunk);
+}
+
 template <typename ChunkDistributorDataType>
 inline cxx::expected<ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const cxx::UniqueId uniqueQueueId,
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk IOX_MAYBE_UNUSED) noexcept
 {
-    bool retry{false};
-    do
+    const auto waitStart = std::chrono::steady_clock::now();
+    while (true)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto remainingTime = remainingTimeToWait(waitStart);
+        rp::RelativePointer<ChunkQueueData_t> blockedQueue;
+        {
+            typename MemberType_t::LockGuard_t lock(*getMembers());
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+            auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
 
-        if (!queueIndex.has_value())
-        {
-            return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
-        }
+            if (!queueIndex.has_value())
+            {
+                return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+            // the lock is held, therefore the slot cannot be released after the queue index was obtained
+            auto& queue = getMembers()->m_queueSlots[queueIndex.value()].m_queue;
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
-        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            bool isBlockingQueue =
+                (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
-        {
-            if (isBlockingQueue)
+            if (pushToQueue(queue.get(), chunk))
             {
-                retry = true;
+                return cxx::success<>();
             }
-            else
+
+            if (!isBlockingQueue || remainingTime == units::Duration::zero())
             {
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
+                return cxx::success<>();
             }
+
+            blockedQueue = queue;
         }
-    } while (retry);
 
-    return cxx::success<>();
+        waitForSpaceInQueue(blockedQueue, false, remainingTime);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isQueueStored(
+    const rp::RelativePointer<ChunkQueueData_t>& queue) const noexcept
+{
+    const auto& queues = getMembers()->m_queues;
+    return std::find(queues.begin(), queues.end(), queue) != queues.end();
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::waitForSpaceInQueue(const rp::RelativePointer<ChunkQueueData_t>& queue,
+                                                                const bool waitForInlineQueue,
+                                                                const units::Duration& timeout) noexcept
+{
+    ChunkQueuePusher_t pusher(queue.get());
+    QueueSlot_t* slot{nullptr};
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        // the queue must not be accessed when it was already removed since its memory might have been released
+        for (auto& queueSlot : getMembers()->m_queueSlots)
+        {
+            if (queueSlot.m_queue == queue)
+            {
+                slot = &queueSlot;
+                break;
+            }
+        }
+        if (slot == nullptr)
+        {
+            return;
+        }
+
+        // the registration must precede the check, otherwise a chunk which is taken in between would not wake us up;
+        // a removal of the queue wakes us up, too, and waits until we stopped accessing the queue
+        slot->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_relaxed);
+        pusher.registerWaitingProducer();
+        const bool isFull = waitForInlineQueue ? pusher.isInlineQueueFull() : pusher.isFull();
+        if (!isFull)
+        {
+            pusher.unregisterWaitingProducer();
+            slot->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    pusher.waitForSpace(timeout);
+    pusher.unregisterWaitingProducer();
+    // the queue must not be accessed after this since a removal might release it
+    slot->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline units::Duration ChunkDistributor<ChunkDistributorDataType>::remainingTimeToWait(
+    const std::chrono::steady_clock::time_point& waitStart) const noexcept
+{
+    if (getMembers()->m_waitForConsumerTimeout == units::Duration::max())
+    {
+        return units::Duration::max();
+    }
+
+    const units::Duration elapsedTime{
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - waitStart)};
+    return getMembers()->m_waitForConsumerTimeout - elapsedTime;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::invalidateQueueSlot(QueueSlot_t& slot) noexcept
+{
+    slot.m_uniqueQueueId.store(MemberType_t::INVALID_UNIQUE_QUEUE_ID, std::memory_order_release);
+    slot.m_queue = nullptr;
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::releaseProducersWaitingForSpace(QueueSlot_t& slot,
+                                                                            ChunkQueueData_t* const queue) noexcept
+{
+    // the wakeup is repeated since producers of other distributors might consume the posts of the queue semaphore
+    cxx::internal::adaptive_wait adaptiveWait;
+    const auto waitStart = std::chrono::steady_clock::now();
+    while (slot.m_numberOfWaitingProducers.load(std::memory_order_acquire) > 0U)
+    {
+        if (units::Duration(std::chrono::steady_clock::now() - waitStart) >= MAX_WAITING_TIME_FOR_LEAVING_PRODUCERS)
+        {
+            LogWarn() << "A producer did not stop waiting for space in a removed queue. It might have died.";
+            return;
+        }
+        ChunkQueuePusher_t(queue).wakeUpWaitingProducers();
+        adaptiveWait.wait();
+    }
 }
 
 template <typename ChunkDistributorDataType>
@@ -263,19 +560,22 @@ inline cxx::optional<uint32_t>
 ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const cxx::UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
-    auto& queues = getMembers()->m_queues;
+    auto& slots = getMembers()->m_queueSlots;
+    const auto uniqueId = static_cast<uint64_t>(uniqueQueueId);
 
-    if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
+    // fast path without lock; the handle is valid as long as the slot holds the queue with the same unique ID
+    if (lastKnownQueueIndex < ChunkDistributorDataType::ChunkDistributorDataProperties_t::MAX_QUEUES
+        && slots[lastKnownQueueIndex].m_uniqueQueueId.load(std::memory_order_acquire) == uniqueId)
     {
         return lastKnownQueueIndex;
     }
 
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
     uint32_t index{0};
-    for (auto& queue : queues)
+    for (auto& slot : slots)
     {
-        if (queue->m_uniqueId == uniqueQueueId)
+        if (slot.m_uniqueQueueId.load(std::memory_order_relaxed) == uniqueId)
         {
             return index;
         }
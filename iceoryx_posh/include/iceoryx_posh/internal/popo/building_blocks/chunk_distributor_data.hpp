@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
@@ -28,6 +29,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -52,6 +54,22 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
+    /// @brief cxx::UniqueId starts with 1, therefore 0 marks a free slot
+    static constexpr uint64_t INVALID_UNIQUE_QUEUE_ID{0U};
+    /// @brief A stored queue keeps its slot until it is removed, therefore the slot index is a stable handle which
+    /// can be used for a fast lookup of the queue, e.g. by deliverToQueue. The handle is validated with the
+    /// cxx::UniqueId of the queue which is never reused and therefore works like a generation counter for the slot.
+    /// The ID is atomic to be able to validate a handle without taking the lock.
+    struct QueueSlot
+    {
+        rp::RelativePointer<ChunkQueueData_t> m_queue;
+        std::atomic<uint64_t> m_uniqueQueueId{INVALID_UNIQUE_QUEUE_ID};
+        /// @brief the producers which wait for space in the queue; they access the queue without the lock, therefore
+        /// the queue is only released when no producer waits anymore
+        std::atomic<uint64_t> m_numberOfWaitingProducers{0U};
+    };
+    QueueSlot m_queueSlots[ChunkDistributorDataProperties_t::MAX_QUEUES];
+
     /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
@@ -60,6 +78,9 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+    /// @brief the maximum time a delivery waits for space in a queue with QueueFullPolicy::BLOCK_PRODUCER; the chunk
+    /// is lost for the queue when the timeout has passed
+    units::Duration m_waitForConsumerTimeout{units::Duration::max()};
 };
 
 } // namespace popo
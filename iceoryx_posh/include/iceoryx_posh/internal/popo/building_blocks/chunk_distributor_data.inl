@@ -30,6 +30,10 @@ constexpr T min(const T left, const T right) noexcept
     return (left < right) ? left : right;
 }
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint64_t
+    ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::INVALID_UNIQUE_QUEUE_ID;
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
     const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
@@ -20,19 +20,145 @@
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/inline_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <mutex>
+#include <type_traits>
 
 namespace iox
 {
 namespace popo
 {
+/// @brief Takes the place of the inline queue in chunk queues which never transfer InlineChunks, like the ones of the
+/// client and server ports, so that they do not pay for its memory. Every push is rejected.
+class NoInlineChunkQueue
+{
+  public:
+    explicit NoInlineChunkQueue(const cxx::VariantQueueTypes) noexcept
+    {
+    }
+
+    cxx::optional<mepoo::InlineChunk> push(const mepoo::InlineChunk& inlineChunk) noexcept
+    {
+        return inlineChunk;
+    }
+
+    cxx::optional<mepoo::InlineChunk> pop() noexcept
+    {
+        return cxx::nullopt;
+    }
+
+    const mepoo::InlineChunk* peek() noexcept
+    {
+        return nullptr;
+    }
+
+    bool empty() const noexcept
+    {
+        return true;
+    }
+
+    uint64_t size() noexcept
+    {
+        return 0U;
+    }
+
+    bool isFull() noexcept
+    {
+        return true;
+    }
+
+    uint64_t capacity() const noexcept
+    {
+        return 0U;
+    }
+
+    bool setCapacity(const uint64_t newCapacity) noexcept
+    {
+        return newCapacity == 0U;
+    }
+};
+
+/// @brief The queue for InlineChunks of the chunk queues which can take them. Since the lock-free queues cannot look at
+/// their oldest element, the consumer moves it to a front slot with peek, in order to decide whether the inline chunk
+/// or the oldest shared chunk arrived first.
+/// @note push and isFull are used by the producers, all other methods only by the consumer
+template <uint64_t Capacity>
+class InlineChunkQueue
+{
+  public:
+    explicit InlineChunkQueue(const cxx::VariantQueueTypes queueType) noexcept
+        : m_queue(queueType)
+    {
+    }
+
+    cxx::optional<mepoo::InlineChunk> push(const mepoo::InlineChunk& inlineChunk) noexcept
+    {
+        return m_queue.push(inlineChunk);
+    }
+
+    cxx::optional<mepoo::InlineChunk> pop() noexcept
+    {
+        if (m_front.has_value())
+        {
+            auto front = m_front;
+            m_front.reset();
+            return front;
+        }
+        return m_queue.pop();
+    }
+
+    /// @brief provides the oldest InlineChunk without removing it from the queue
+    /// @return the oldest InlineChunk or a nullptr if the queue is empty
+    const mepoo::InlineChunk* peek() noexcept
+    {
+        if (!m_front.has_value())
+        {
+            m_front = m_queue.pop();
+        }
+        return m_front.has_value() ? &m_front.value() : nullptr;
+    }
+
+    bool empty() const noexcept
+    {
+        return !m_front.has_value() && m_queue.empty();
+    }
+
+    uint64_t size() noexcept
+    {
+        return m_queue.size() + (m_front.has_value() ? 1U : 0U);
+    }
+
+    /// @brief the front slot is not taken into account, since it is owned by the consumer
+    bool isFull() noexcept
+    {
+        return m_queue.size() >= m_queue.capacity();
+    }
+
+    uint64_t capacity() const noexcept
+    {
+        return m_queue.capacity();
+    }
+
+    bool setCapacity(const uint64_t newCapacity) noexcept
+    {
+        return m_queue.setCapacity(newCapacity);
+    }
+
+  private:
+    cxx::VariantQueue<mepoo::InlineChunk, Capacity> m_queue;
+    cxx::optional<mepoo::InlineChunk> m_front;
+};
+
 template <typename ChunkQueueDataProperties, typename LockingPolicy>
 struct ChunkQueueData : public LockingPolicy
 {
@@ -40,17 +166,50 @@ struct ChunkQueueData : public LockingPolicy
     using LockGuard_t = std::lock_guard<const ThisType_t>;
     using ChunkQueueDataProperties_t = ChunkQueueDataProperties;
 
+    /// @note the pushes of all producers are serialized with the lock, therefore a single producer queueType can be
+    /// used even if multiple producers are connected
     ChunkQueueData(const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept;
 
     cxx::UniqueId m_uniqueId{};
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
+    static constexpr uint64_t MAX_INLINE_CAPACITY = ChunkQueueDataProperties_t::MAX_INLINE_QUEUE_CAPACITY;
+    using InlineQueue_t = typename std::conditional<(MAX_INLINE_CAPACITY > 0U),
+                                                    InlineChunkQueue<MAX_INLINE_CAPACITY>,
+                                                    NoInlineChunkQueue>::type;
+    InlineQueue_t m_inlineQueue;
+    /// @brief The shared chunks which were pushed, protected by the lock, and the ones which left the queue by a pop,
+    /// an overflow or a clear. An inline chunk is the next one in order if all shared chunks which were pushed before
+    /// it have left the queue. Both are only maintained if there is an inline queue.
+    uint64_t m_numberOfPushedChunks{0U};
+    std::atomic<uint64_t> m_numberOfRemovedChunks{0U};
     std::atomic_bool m_queueHasLostChunks{false};
 
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief The notification policy is set by the consumer before the queue is connected to any producer
+    QueueNotificationPolicy m_notificationPolicy{QueueNotificationPolicy::ON_EVERY_CHUNK};
+    uint64_t m_notificationThreshold{1U};
+    units::Duration m_minNotificationInterval{units::Duration::fromNanoseconds(0U)};
+    units::Duration m_maxNotificationDelay{DEFAULT_MAX_NOTIFICATION_DELAY};
+    /// @brief The state of the notification policy which is shared by all producers; the members which are not atomic
+    /// are protected by the lock
+    std::atomic_bool m_hasPendingNotification{false};
+    std::atomic<uint64_t> m_chunksSinceLastNotification{0U};
+    units::Duration m_lastNotificationTime{units::Duration::fromNanoseconds(0U)};
+
+    /// @brief Back-pressure channel for producers which wait for space in a full queue. The consumer posts the
+    /// semaphore when it takes a chunk while producers are registered as waiting
+    posix::Semaphore m_spaceAvailableSemaphore = std::move(
+        posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0U)
+            .or_else([](posix::SemaphoreError&) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+            })
+            .value());
+    std::atomic<uint64_t> m_numberOfWaitingProducers{0U};
 };
 
 } // namespace popo
@@ -25,6 +25,7 @@ template <typename ChunkQueueProperties, typename LockingPolicy>
 inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
     const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept
     : m_queue(queueType)
+    , m_inlineQueue(queueType)
     , m_queueFullPolicy(policy)
 {
 }
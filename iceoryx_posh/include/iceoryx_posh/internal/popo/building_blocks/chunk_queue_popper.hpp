@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
@@ -50,6 +51,15 @@ class ChunkQueuePopper
     /// @return optional for a shared chunk that is set if the queue is not empty
     cxx::optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop an inline chunk from the chunk queue
+    /// @return optional for an inline chunk that is set if the inline queue is not empty
+    cxx::optional<mepoo::InlineChunk> tryPopInline() noexcept;
+
+    /// @brief checks whether the oldest inline chunk arrived before the oldest shared chunk, in order to pop the
+    /// chunks in the order of their arrival
+    /// @return true if there is an inline chunk and all shared chunks which arrived before it have left the queue
+    bool isInlineChunkNext() noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -63,7 +73,7 @@ class ChunkQueuePopper
     /// @return queue size
     uint64_t size() noexcept;
 
-    /// @brief set the capacity of the queue
+    /// @brief set the capacity of the queue; the capacity of the inline queue is limited to MAX_INLINE_CAPACITY
     /// @param[in] newCapacity valid values are 0 < newCapacity < MAX_SUBSCRIBER_QUEUE_CAPACITY
     /// @pre it is important that no pop or push calls occur during this call
     /// @concurrent not thread safe
@@ -92,11 +102,21 @@ class ChunkQueuePopper
     /// @return true if condition variable is set, false if not
     bool isConditionVariableSet() const noexcept;
 
+    /// @brief Must be called by the consumer when it found the queue empty. With the
+    /// QueueNotificationPolicy::ON_EMPTY_TO_NON_EMPTY the next pushed chunk leads to a notification again
+    void rearmNotification() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief signals the producers which wait for space in the queue, if there are any
+    void wakeUpWaitingProducers() noexcept;
+
+    /// @brief counts a shared chunk which left the queue for the order of inline and shared chunks
+    void chunkRemoved() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
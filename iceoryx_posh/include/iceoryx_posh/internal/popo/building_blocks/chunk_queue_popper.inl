@@ -53,6 +53,8 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        chunkRemoved();
+        wakeUpWaitingProducers();
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -72,6 +74,47 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     }
 }
 
+template <typename ChunkQueueDataType>
+inline cxx::optional<mepoo::InlineChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPopInline() noexcept
+{
+    auto inlineChunk = getMembers()->m_inlineQueue.pop();
+    if (inlineChunk.has_value())
+    {
+        wakeUpWaitingProducers();
+    }
+    return inlineChunk;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::isInlineChunkNext() noexcept
+{
+    const mepoo::InlineChunk* inlineChunk = getMembers()->m_inlineQueue.peek();
+    return inlineChunk != nullptr
+           && inlineChunk->m_queuePosition
+                  <= getMembers()->m_numberOfRemovedChunks.load(std::memory_order_acquire);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::chunkRemoved() noexcept
+{
+    constexpr bool HAS_INLINE_QUEUE{MemberType_t::MAX_INLINE_CAPACITY > 0U};
+    if (HAS_INLINE_QUEUE)
+    {
+        getMembers()->m_numberOfRemovedChunks.fetch_add(1U, std::memory_order_release);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::wakeUpWaitingProducers() noexcept
+{
+    // pairs with the fence in ChunkQueuePusher::registerWaitingProducer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed) > 0U)
+    {
+        ChunkQueuePusher<MemberType_t>(getMembers()).wakeUpWaitingProducers();
+    }
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -86,19 +129,21 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::empty() const noexcept
 {
-    return getMembers()->m_queue.empty();
+    return getMembers()->m_queue.empty() && getMembers()->m_inlineQueue.empty();
 }
 
 template <typename ChunkQueueDataType>
 inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::size() noexcept
 {
-    return getMembers()->m_queue.size();
+    return getMembers()->m_queue.size() + getMembers()->m_inlineQueue.size();
 }
 
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::setCapacity(const uint64_t newCapacity) noexcept
 {
     getMembers()->m_queue.setCapacity(newCapacity);
+    constexpr uint64_t MAX_INLINE_CAPACITY{MemberType_t::MAX_INLINE_CAPACITY};
+    getMembers()->m_inlineQueue.setCapacity((newCapacity < MAX_INLINE_CAPACITY) ? newCapacity : MAX_INLINE_CAPACITY);
 }
 
 template <typename ChunkQueueDataType>
@@ -118,9 +163,16 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
 {
     while (auto maybeUnmanagedChunk = getMembers()->m_queue.pop())
     {
+        chunkRemoved();
         // PRQA S 4117 4 # d'tor of SharedChunk will release the memory, so RAII has the side effect here
         maybeUnmanagedChunk.value().releaseToSharedChunk();
     }
+
+    while (getMembers()->m_inlineQueue.pop())
+    {
+    }
+
+    wakeUpWaitingProducers();
 }
 
 template <typename ChunkQueueDataType>
@@ -148,6 +200,23 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const
     return getMembers()->m_conditionVariableDataPtr;
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::rearmNotification() noexcept
+{
+    if (getMembers()->m_notificationPolicy != QueueNotificationPolicy::ON_EMPTY_TO_NON_EMPTY)
+    {
+        return;
+    }
+
+    // the exchange synchronizes with the producer which set the flag and makes its chunks visible for the check
+    // below; a producer might have skipped the notification of a chunk which was pushed after the queue was found empty
+    IOX_DISCARD_RESULT(getMembers()->m_hasPendingNotification.exchange(false, std::memory_order_acq_rel));
+    if (!empty())
+    {
+        ChunkQueuePusher<MemberType_t>(getMembers()).notify();
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
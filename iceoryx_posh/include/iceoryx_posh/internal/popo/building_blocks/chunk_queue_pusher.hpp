@@ -21,8 +21,11 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace popo
@@ -31,6 +34,9 @@ namespace popo
 /// Together with the ChunkDistributor and ChunkQueuePopper the ChunkQueuePusher builds the infrastructure
 /// to exchange memory chunks between different data producers and consumers that could be located in different
 /// processes. A ChunkQueuePusher is the part of the chunk queue that is knwon by the ChunkDistributor
+/// @note The chunks are pushed while the lock of the chunk queue is held. Since the producers are serialized, a queue
+/// with a single producer variant can be used even if multiple producers are connected; the lock is uncontended as
+/// long as only one producer is connected
 template <typename ChunkQueueDataType>
 class ChunkQueuePusher
 {
@@ -50,13 +56,70 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying the consumer; this allows to push multiple chunks
+    /// and notify the consumer only once afterwards
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief push a new inline chunk to the chunk queue
+    /// @param[in] inlineChunk which is copied into the queue
+    /// @return false if a queue overflow occurred, otherwise true
+    bool push(const mepoo::InlineChunk& inlineChunk) noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief notify the consumer of the chunk queue, if a condition variable is attached and the notification is due
+    /// according to the QueueNotificationPolicy of the chunk queue
+    void notify() noexcept;
+
+    /// @brief checks whether the queue for shared chunks is full
+    /// @return true if a push would overflow the queue, otherwise false
+    bool isFull() noexcept;
+
+    /// @brief checks whether the queue for inline chunks is full
+    /// @return true if a push would overflow the inline queue, otherwise false
+    bool isInlineQueueFull() noexcept;
+
+    /// @brief registers a producer which waits for space in the queue; as long as producers are registered the
+    /// consumer signals them whenever it takes a chunk. The fill level must be checked after the registration to not
+    /// miss a chunk which was taken concurrently
+    void registerWaitingProducer() noexcept;
+
+    /// @brief removes the registration of registerWaitingProducer
+    void unregisterWaitingProducer() noexcept;
+
+    /// @brief wakes up all the producers which are registered as waiting for space
+    void wakeUpWaitingProducers() noexcept;
+
+    /// @brief sleeps until the consumer took a chunk, the producers were woken up or the timeout has passed; the
+    /// caller must have called registerWaitingProducer before
+    /// @param[in] timeout is the maximum time to sleep; units::Duration::max() sleeps without a timeout
+    void waitForSpace(const units::Duration& timeout) noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    /// @brief pushes the chunk into the queue; must be called while the lock is held
+    bool pushUnlocked(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief notifies the consumer if the notification is due; must be called while the lock is held
+    void notifyUnlocked() noexcept;
+
+    /// @brief updates the state of the QueueNotificationPolicy for a pushed chunk
+    void chunkPushed() noexcept;
+
+    /// @brief counts a pushed shared chunk and an overwritten one for the order of inline and shared chunks; must be
+    /// called while the lock is held
+    void countPushedChunk(mepoo::SharedChunk& chunk, cxx::optional<mepoo::ShmSafeUnmanagedChunk>& pushRet) noexcept;
+
+    /// @brief decides with the QueueNotificationPolicy whether the consumer shall be notified; must be called while
+    /// the lock is held
+    bool isNotificationDue() noexcept;
+
   private:
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
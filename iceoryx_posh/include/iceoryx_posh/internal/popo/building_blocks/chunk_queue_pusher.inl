@@ -46,8 +46,35 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
 {
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    bool hasQueueOverflow = !pushUnlocked(chunk);
+
+    notifyUnlocked();
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    return pushUnlocked(chunk);
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushUnlocked(mepoo::SharedChunk chunk) noexcept
+{
+    ChunkTrace::trace(
+        ChunkTraceEventType::PUSH, static_cast<uint64_t>(getMembers()->m_uniqueId), chunk.getChunkHeader());
+    chunkPushed();
+
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
+    constexpr bool HAS_INLINE_QUEUE{MemberType_t::MAX_INLINE_CAPACITY > 0U};
+    if (HAS_INLINE_QUEUE)
+    {
+        countPushedChunk(chunk, pushRet);
+    }
 
     // drop the chunk if one is returned by an overflow
     if (pushRet.has_value())
@@ -57,17 +84,186 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::push(const mepoo::InlineChunk& inlineChunk) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    ChunkTrace::trace(ChunkTraceEventType::PUSH,
+                      static_cast<uint64_t>(getMembers()->m_uniqueId),
+                      reinterpret_cast<const mepoo::ChunkHeader*>(&inlineChunk.m_chunk[0]));
+    chunkPushed();
+
+    auto queuedChunk = inlineChunk;
+    queuedChunk.m_queuePosition = getMembers()->m_numberOfPushedChunks;
+    // an inline chunk returned by an overflow owns no shared memory and can simply be dropped
+    bool hasQueueOverflow = getMembers()->m_inlineQueue.push(queuedChunk).has_value();
+
+    notifyUnlocked();
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void
+ChunkQueuePusher<ChunkQueueDataType>::countPushedChunk(mepoo::SharedChunk& chunk,
+                                                       cxx::optional<mepoo::ShmSafeUnmanagedChunk>& pushRet) noexcept
+{
+    // a full FiFo returns the pushed chunk itself, which therefore never entered the queue
+    if (pushRet.has_value() && pushRet.value().getChunkHeader() == chunk.getChunkHeader())
+    {
+        return;
+    }
+
+    ++getMembers()->m_numberOfPushedChunks;
+    if (pushRet.has_value())
+    {
+        // the oldest chunk was overwritten and left the queue
+        getMembers()->m_numberOfRemovedChunks.fetch_add(1U, std::memory_order_release);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    notifyUnlocked();
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notifyUnlocked() noexcept
+{
+    if (!getMembers()->m_conditionVariableDataPtr)
+    {
+        return;
+    }
+
+    ConditionNotifier notifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                               *getMembers()->m_conditionVariableNotificationIndex);
+    if (isNotificationDue())
+    {
+        notifier.notify();
+        return;
+    }
+
+    // a skipped notification is deferred to a deadline, therefore the last chunks of a burst are notified without
+    // waiting for the next chunk
+    switch (getMembers()->m_notificationPolicy)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+    case QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS:
+        notifier.deferNotification(units::Duration(std::chrono::steady_clock::now().time_since_epoch())
+                                   + getMembers()->m_maxNotificationDelay);
+        break;
+    case QueueNotificationPolicy::AFTER_MIN_INTERVAL:
+        notifier.deferNotification(getMembers()->m_lastNotificationTime + getMembers()->m_minNotificationInterval);
+        break;
+    case QueueNotificationPolicy::ON_EVERY_CHUNK:
+    case QueueNotificationPolicy::ON_EMPTY_TO_NON_EMPTY:
+        // the consumer rearms the notification when it finds the queue empty
+        break;
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::chunkPushed() noexcept
+{
+    if (getMembers()->m_notificationPolicy == QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS)
+    {
+        getMembers()->m_chunksSinceLastNotification.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::isNotificationDue() noexcept
+{
+    switch (getMembers()->m_notificationPolicy)
+    {
+    case QueueNotificationPolicy::ON_EVERY_CHUNK:
+        return true;
+    case QueueNotificationPolicy::ON_EMPTY_TO_NON_EMPTY:
+        // the flag is reset by the consumer when it found the queue empty
+        return !getMembers()->m_hasPendingNotification.exchange(true, std::memory_order_acq_rel);
+    case QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS:
+    {
+        auto numberOfChunks = getMembers()->m_chunksSinceLastNotification.load(std::memory_order_relaxed);
+        if (numberOfChunks < getMembers()->m_notificationThreshold)
+        {
+            return false;
+        }
+        // chunks which are pushed concurrently are counted for the next notification
+        getMembers()->m_chunksSinceLastNotification.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+        return true;
+    }
+    case QueueNotificationPolicy::AFTER_MIN_INTERVAL:
+    {
+        // the steady clock is system wide and can therefore be shared by producers in different processes
+        auto now = units::Duration(std::chrono::steady_clock::now().time_since_epoch());
+        auto& lastNotificationTime = getMembers()->m_lastNotificationTime;
+        bool wasNotifiedBefore = (lastNotificationTime != units::Duration::fromNanoseconds(0U));
+        if (wasNotifiedBefore && now - lastNotificationTime < getMembers()->m_minNotificationInterval)
         {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
+            return false;
         }
+        lastNotificationTime = now;
+        return true;
+    }
     }
 
-    return !hasQueueOverflow;
+    return true;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::isFull() noexcept
+{
+    return getMembers()->m_queue.size() >= getMembers()->m_queue.capacity();
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::isInlineQueueFull() noexcept
+{
+    return getMembers()->m_inlineQueue.isFull();
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::registerWaitingProducer() noexcept
+{
+    getMembers()->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_seq_cst);
+    // pairs with the fence of the consumer in ChunkQueuePopper::wakeUpWaitingProducers; either the consumer sees the
+    // registration or the producer sees the chunk which was taken
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::unregisterWaitingProducer() noexcept
+{
+    getMembers()->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::wakeUpWaitingProducers() noexcept
+{
+    const auto numberOfWaitingProducers = getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < numberOfWaitingProducers; ++i)
+    {
+        getMembers()->m_spaceAvailableSemaphore.post().or_else([](auto) {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_SPACE_AVAILABLE_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+        });
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::waitForSpace(const units::Duration& timeout) noexcept
+{
+    // a post which was not consumed by a waiting producer leads to a spurious wakeup which is handled by the caller
+    const bool hasSemaphoreError = (timeout == units::Duration::max())
+                                       ? getMembers()->m_spaceAvailableSemaphore.wait().has_error()
+                                       : getMembers()->m_spaceAvailableSemaphore.timedWait(timeout).has_error();
+    if (hasSemaphoreError)
+    {
+        errorHandler(PoshError::POPO__CHUNK_QUEUE_SPACE_AVAILABLE_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+    }
 }
 
 template <typename ChunkQueueDataType>
@@ -17,13 +17,18 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RECEIVER_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RECEIVER_HPP
 
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace popo
@@ -74,11 +79,23 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
 
     /// @brief Tries to get the next received chunk. If there is a new one the ChunkHeader of this new chunk is received
     /// The ownerhip of the SharedChunk remains in the ChunkReceiver for being able to cleanup if the user process
-    /// disappears
+    /// disappears. Inline and shared chunks are provided in the order of their arrival and count both against the
+    /// number of chunks which can be held
     /// @return New chunk header, ChunkReceiveResult on error
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get up to maxNumberOfChunks received chunks with one call. The chunks are provided in the same
+    /// order as with subsequent calls to tryGet. At most as many chunks are taken from the queue as can be held, the
+    /// remaining chunks stay in the queue.
+    /// @param[in] maxNumberOfChunks, the maximum number of chunks to get
+    /// @param[in] onChunk, is called with the ChunkHeader of each received chunk
+    /// @return the number of received chunks, ChunkReceiveResult if not a single chunk could be received; if
+    /// maxNumberOfChunks is 0, no chunk is taken and 0 is returned
+    cxx::expected<uint64_t, ChunkReceiveResult>
+    tryGetMultiple(const uint64_t maxNumberOfChunks,
+                   const cxx::function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -91,6 +108,18 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
+
+    /// @brief Tries to get the next inline chunk and unpacks it into an inline chunk slot
+    /// @return New chunk header, ChunkReceiveResult on error or if there are no new inline chunks
+    cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetInline() noexcept;
+
+    /// @brief Takes the next inline chunk for an entry which was reserved in the list of used chunks. The reservation
+    /// is kept until the inline chunk is released and cancelled if no inline chunk is taken
+    /// @return New chunk header, ChunkReceiveResult on error or if there are no new inline chunks
+    cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeReservedInlineChunk() noexcept;
+
+    /// @brief Records the time since the chunk was published in the take latency histogram if it has a timestamp
+    void recordTakeLatency(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 };
 
 } // namespace popo
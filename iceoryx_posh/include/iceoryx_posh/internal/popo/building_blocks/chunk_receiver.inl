@@ -75,46 +75,211 @@ template <typename ChunkReceiverDataType>
 inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
 ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
 {
-    auto popRet = this->tryPop();
+    // inline and shared chunks are provided in the order of their arrival
+    if (!this->isInlineChunkNext())
+    {
+        auto popRet = this->tryPop();
+
+        if (popRet.has_value())
+        {
+            auto sharedChunk = *popRet;
+
+            // if the application holds too many chunks, don't provide more
+            if (getMembers()->m_chunksInUse.insert(sharedChunk))
+            {
+                ChunkTrace::trace(ChunkTraceEventType::TAKE,
+                                  static_cast<uint64_t>(getMembers()->m_uniqueId),
+                                  sharedChunk.getChunkHeader());
+                recordTakeLatency(sharedChunk.getChunkHeader());
+                return cxx::success<const mepoo::ChunkHeader*>(
+                    const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
+            }
+            else
+            {
+                // release the chunk
+                sharedChunk = nullptr;
+                return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+            }
+        }
+    }
+
+    auto getRet = tryGetInline();
+    if (getRet.has_error() && getRet.get_error() == ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+    {
+        this->rearmNotification();
+    }
+    return getRet;
+}
+
+template <typename ChunkReceiverDataType>
+inline cxx::expected<uint64_t, ChunkReceiveResult> ChunkReceiver<ChunkReceiverDataType>::tryGetMultiple(
+    const uint64_t maxNumberOfChunks, const cxx::function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept
+{
+    if (maxNumberOfChunks == 0U)
+    {
+        return cxx::success<uint64_t>(0U);
+    }
+
+    auto& members = *getMembers();
 
-    if (popRet.has_value())
+    // only as many chunks are popped as entries are reserved in the list of used chunks, so no popped chunk has to be
+    // dropped; an inline chunk keeps its entry reserved until it is released
+    uint32_t numberOfReservedChunks = members.m_chunksInUse.reserve(static_cast<uint32_t>(
+        algorithm::min(maxNumberOfChunks, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()))));
+    uint64_t numberOfChunks{0U};
+    while (numberOfReservedChunks > 0U)
     {
-        auto sharedChunk = *popRet;
+        // like with tryGet, inline and shared chunks are provided in the order of their arrival
+        if (!this->isInlineChunkNext())
+        {
+            auto popRet = this->tryPop();
+            if (popRet.has_value())
+            {
+                const mepoo::ChunkHeader* chunkHeader = popRet->getChunkHeader();
+                members.m_chunksInUse.insertReserved(*popRet);
+                --numberOfReservedChunks;
+                ChunkTrace::trace(ChunkTraceEventType::TAKE, static_cast<uint64_t>(members.m_uniqueId), chunkHeader);
+                recordTakeLatency(chunkHeader);
+                onChunk(chunkHeader);
+                ++numberOfChunks;
+                continue;
+            }
+        }
 
-        // if the application holds too many chunks, don't provide more
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
+        if (members.m_inlineQueue.empty())
+        {
+            break;
+        }
+        --numberOfReservedChunks;
+        auto getRet = takeReservedInlineChunk();
+        if (getRet.has_error())
         {
-            return cxx::success<const mepoo::ChunkHeader*>(
-                const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
+            break;
         }
-        else
+        onChunk(getRet.value());
+        ++numberOfChunks;
+    }
+    members.m_chunksInUse.cancelReservation(numberOfReservedChunks);
+
+    if (numberOfChunks == 0U)
+    {
+        if (this->empty())
         {
-            // release the chunk
-            sharedChunk = nullptr;
-            return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+            this->rearmNotification();
+            return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
         }
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    return cxx::success<uint64_t>(numberOfChunks);
+}
+
+template <typename ChunkReceiverDataType>
+inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetInline() noexcept
+{
+    if (getMembers()->m_inlineQueue.empty())
+    {
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    // an inline chunk counts against the chunks which can be held like a shared chunk
+    if (getMembers()->m_chunksInUse.reserve(1U) == 0U)
+    {
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    return takeReservedInlineChunk();
+}
+
+template <typename ChunkReceiverDataType>
+inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::takeReservedInlineChunk() noexcept
+{
+    auto& inlineChunksInUse = getMembers()->m_inlineChunksInUse;
+
+    // the inline chunk stays in the queue if the application holds too many chunks, since there is no need to
+    // release anything
+    if (!inlineChunksInUse.hasFreeSlot())
+    {
+        getMembers()->m_chunksInUse.cancelReservation(1U);
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    auto popRet = this->tryPopInline();
+    if (!popRet.has_value())
+    {
+        getMembers()->m_chunksInUse.cancelReservation(1U);
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    const mepoo::ChunkHeader* chunkHeader = inlineChunksInUse.tryAcquire(popRet.value());
+    if (chunkHeader->chunkHeaderVersion() != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        LogError() << "Received inline chunk with CHUNK_HEADER_VERSION '" << chunkHeader->chunkHeaderVersion()
+                   << "' but expected '" << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
+        errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                     ErrorLevel::SEVERE);
+        inlineChunksInUse.release(chunkHeader);
+        getMembers()->m_chunksInUse.cancelReservation(1U);
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
     }
-    return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+
+    ChunkTrace::trace(ChunkTraceEventType::TAKE, static_cast<uint64_t>(getMembers()->m_uniqueId), chunkHeader);
+    recordTakeLatency(chunkHeader);
+    return cxx::success<const mepoo::ChunkHeader*>(chunkHeader);
 }
 
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    // the slot of a released inline chunk is not overwritten until the next take, so it can still be traced
+    if (getMembers()->m_inlineChunksInUse.release(chunkHeader))
+    {
+        getMembers()->m_chunksInUse.cancelReservation(1U);
+        ChunkTrace::trace(ChunkTraceEventType::RELEASE, static_cast<uint64_t>(getMembers()->m_uniqueId), chunkHeader);
+        return;
+    }
+
     mepoo::SharedChunk chunk(nullptr);
     // PRQA S 4127 1 # d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
     if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk)) // PRQA S 4127
     {
         errorHandler(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, ErrorLevel::SEVERE);
     }
+    else
+    {
+        ChunkTrace::trace(ChunkTraceEventType::RELEASE, static_cast<uint64_t>(getMembers()->m_uniqueId), chunkHeader);
+    }
 }
 
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_inlineChunksInUse.releaseAll();
     this->clear();
 }
 
+template <typename ChunkReceiverDataType>
+inline void
+ChunkReceiver<ChunkReceiverDataType>::recordTakeLatency(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    const uint64_t publishTimestamp = chunkHeader->publishTimestamp();
+    if (!TAKE_LATENCY_HISTOGRAM || publishTimestamp == mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP)
+    {
+        return;
+    }
+
+    const auto now = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+    // the steady clock is system wide; a timestamp from the future can only stem from a foreign clock and is ignored
+    if (now >= publishTimestamp)
+    {
+        getMembers()->m_takeLatencyHistogram.record(now - publishTimestamp);
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
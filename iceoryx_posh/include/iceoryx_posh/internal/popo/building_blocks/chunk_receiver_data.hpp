@@ -19,16 +19,24 @@
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/inline_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
+#include <type_traits>
+
 namespace iox
 {
 namespace popo
 {
-template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
+/// @tparam UsedChunkListType is the list which keeps track of the chunks held by the user; the ConcurrentUsedChunkList
+/// can be used if multiple threads receive chunks simultaneously
+template <uint32_t MaxChunksHeldSimultaneously,
+          typename ChunkQueueDataType,
+          template <uint32_t> class UsedChunkListType = UsedChunkList>
 struct ChunkReceiverData : public ChunkQueueDataType
 {
     explicit ChunkReceiverData(const cxx::VariantQueueTypes queueType,
@@ -43,7 +51,22 @@ struct ChunkReceiverData : public ChunkQueueDataType
     /// to the user if they already have the allowed MaxChunksHeldSimultaneously. But then the user
     /// has to return one to not brake the contract. This is aligned with AUTOSAR Adaptive ara::com
     static constexpr uint32_t MAX_CHUNKS_IN_USE = MaxChunksHeldSimultaneously + 1U;
-    UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
+    UsedChunkListType<MAX_CHUNKS_IN_USE> m_chunksInUse;
+
+    /// inline chunks are unpacked into these slots before they are passed to the user; there are no slots if the
+    /// chunk queue cannot take inline chunks
+    static constexpr uint32_t MAX_INLINE_CHUNKS_IN_USE =
+        (ChunkQueueDataType::MAX_INLINE_CAPACITY == 0U) ? 0U
+        : (MAX_CHUNKS_IN_USE < MAX_INLINE_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY)
+            ? MAX_CHUNKS_IN_USE
+            : MAX_INLINE_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+    mepoo::InlineChunkSlots<MAX_INLINE_CHUNKS_IN_USE> m_inlineChunksInUse;
+
+    /// latency from publish to take of the chunks with a publish timestamp; read by the port introspection and only
+    /// recorded with TAKE_LATENCY_HISTOGRAM
+    using TakeLatencyHistogram_t =
+        typename std::conditional<TAKE_LATENCY_HISTOGRAM, LatencyHistogram, NoLatencyHistogram>::type;
+    TakeLatencyHistogram_t m_takeLatencyHistogram;
 };
 
 } // namespace popo
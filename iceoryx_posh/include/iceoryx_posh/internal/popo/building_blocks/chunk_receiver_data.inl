@@ -21,8 +21,10 @@ namespace iox
 {
 namespace popo
 {
-template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
-inline ChunkReceiverData<MaxChunksHeldSimultaneously, ChunkQueueDataType>::ChunkReceiverData(
+template <uint32_t MaxChunksHeldSimultaneously,
+          typename ChunkQueueDataType,
+          template <uint32_t> class UsedChunkListType>
+inline ChunkReceiverData<MaxChunksHeldSimultaneously, ChunkQueueDataType, UsedChunkListType>::ChunkReceiverData(
     const cxx::VariantQueueTypes queueType,
     const QueueFullPolicy queueFullPolicy,
     const mepoo::MemoryInfo& memoryInfo) noexcept
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_HPP
 
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
@@ -25,9 +26,12 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace popo
@@ -90,7 +94,8 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     ~ChunkSender() noexcept = default;
 
     /// @brief allocate a chunk, the ownership of the SharedChunk remains in the ChunkSender for being able to cleanup
-    /// if the user process disappears
+    /// if the user process disappears; if inline chunks are enabled and the chunk fits into an InlineChunk, an inline
+    /// chunk slot is used instead of a chunk from the mempools
     /// @param[in] originId, the unique id of the entity which requested this allocate
     /// @param[in] userPayloadSize, size of the user-payload without additional headers
     /// @param[in] userPayloadAlignment, alignment of the user-payload
@@ -116,6 +121,14 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks to all connected ChunkQueuePopper. The chunks are delivered in the
+    /// provided order with one pass over the queues and every ChunkQueuePopper is notified only once
+    /// @param[in] chunkHeaders, pointer to an array of pointers to the ChunkHeaders to send; the ownership of the
+    /// chunks is transferred to this method
+    /// @param[in] numberOfChunks, the number of ChunkHeaders in the array
+    /// @return the number of receiver the chunks were send to
+    uint64_t send(mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -147,6 +160,15 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Copies a chunk from the inline chunk slots into the chunk queues and releases the slot
+    /// @param[in] chunkHeader of the acquired inline chunk slot that shall be send
+    /// @return the number of receiver the chunk was send to
+    uint64_t sendInline(mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief Sets the sequence number and, if enabled, the publish timestamp of a chunk which is about to be sent
+    /// @param[in] chunkHeader of the chunk that shall be send
+    void stampChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
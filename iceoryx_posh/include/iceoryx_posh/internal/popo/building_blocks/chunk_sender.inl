@@ -106,8 +106,10 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     //   - there is a valid chunk
     //   - there is no other owner
     //   - the new user-payload still fits in it
+    // the layout is calculated only once for publishers which always request the same layout, like typed publishers
+    auto& chunkLayoutCache = getMembers()->m_chunkLayoutCache;
     const auto chunkSettingsResult =
-        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+        chunkLayoutCache.getChunkSettings(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
     if (chunkSettingsResult.has_error())
     {
         return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
@@ -116,6 +118,19 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     const auto& chunkSettings = chunkSettingsResult.value();
     const uint32_t requiredChunkSize = chunkSettings.requiredChunkSize();
 
+    // small chunks are transferred by copy through the chunk queues and do not need a chunk from the mempools
+    if (getMembers()->m_useInlineChunks && MemberType_t::InlineChunkSlots_t::fits(chunkSettings))
+    {
+        auto chunkHeader = getMembers()->m_inlineChunks.tryAcquire(chunkSettings);
+        if (chunkHeader == nullptr)
+        {
+            return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+        }
+        chunkHeader->setOriginId(originId);
+        ChunkTrace::trace(ChunkTraceEventType::LOAN, static_cast<uint64_t>(originId), chunkHeader);
+        return cxx::success<mepoo::ChunkHeader*>(chunkHeader);
+    }
+
     auto& lastChunkUnmanaged = getMembers()->m_lastChunkUnmanaged;
     mepoo::ChunkHeader* lastChunkChunkHeader =
         lastChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastChunkUnmanaged.getChunkHeader() : nullptr;
@@ -127,7 +142,11 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         {
             auto chunkSize = lastChunkChunkHeader->chunkSize();
             lastChunkChunkHeader->~ChunkHeader();
-            new (lastChunkChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
+            if (chunkLayoutCache.tryInitializeChunkHeader(lastChunkChunkHeader, chunkSize) == nullptr)
+            {
+                new (lastChunkChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
+            }
+            ChunkTrace::trace(ChunkTraceEventType::LOAN, static_cast<uint64_t>(originId), lastChunkChunkHeader);
             return cxx::success<mepoo::ChunkHeader*>(lastChunkChunkHeader);
         }
         else
@@ -139,7 +158,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, chunkLayoutCache);
 
         if (!getChunkResult.has_error())
         {
@@ -149,7 +168,10 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
             if (getMembers()->m_chunksInUse.insert(chunk))
             {
                 // END of critical section
+                // the ChunkHeader is cached before any field is set, to get the state after the construction
+                chunkLayoutCache.cacheChunkHeader(*chunk.getChunkHeader());
                 chunk.getChunkHeader()->setOriginId(originId);
+                ChunkTrace::trace(ChunkTraceEventType::LOAN, static_cast<uint64_t>(originId), chunk.getChunkHeader());
                 return cxx::success<mepoo::ChunkHeader*>(chunk.getChunkHeader());
             }
             else
@@ -170,17 +192,32 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (getMembers()->m_inlineChunks.release(chunkHeader))
+    {
+        ChunkTrace::trace(ChunkTraceEventType::DISCARD, static_cast<uint64_t>(chunkHeader->originId()), chunkHeader);
+        return;
+    }
+
     mepoo::SharedChunk chunk(nullptr);
     // PRQA S 4127 1 # d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
     if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         errorHandler(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER, ErrorLevel::SEVERE);
     }
+    else
+    {
+        ChunkTrace::trace(ChunkTraceEventType::DISCARD, static_cast<uint64_t>(chunkHeader->originId()), chunkHeader);
+    }
 }
 
 template <typename ChunkSenderDataType>
 inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (getMembers()->m_inlineChunks.contains(chunkHeader))
+    {
+        return sendInline(chunkHeader);
+    }
+
     uint64_t numberOfReceiverTheChunkWasDelivered{0};
     mepoo::SharedChunk chunk(nullptr);
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
@@ -196,6 +233,55 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const* const chunkHeaders,
+                                                       const uint64_t numberOfChunks) noexcept
+{
+    uint64_t numberOfReceiverTheChunksWereDelivered{0};
+    cxx::vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+
+    auto deliverCollectedChunks = [&] {
+        if (chunks.empty())
+        {
+            return;
+        }
+        numberOfReceiverTheChunksWereDelivered = algorithm::max(
+            numberOfReceiverTheChunksWereDelivered, this->deliverToAllStoredQueues(chunks.data(), chunks.size()));
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+        chunks.clear();
+    };
+
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto chunkHeader = chunkHeaders[i];
+        if (getMembers()->m_inlineChunks.contains(chunkHeader))
+        {
+            // the previously collected chunks must be delivered first to preserve the order
+            deliverCollectedChunks();
+            numberOfReceiverTheChunksWereDelivered =
+                algorithm::max(numberOfReceiverTheChunksWereDelivered, sendInline(chunkHeader));
+            continue;
+        }
+
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeader, chunk))
+        {
+            if (chunks.size() == chunks.capacity())
+            {
+                deliverCollectedChunks();
+            }
+            chunks.emplace_back(std::move(chunk));
+        }
+    }
+    deliverCollectedChunks();
+    // END of critical section
+
+    return numberOfReceiverTheChunksWereDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const cxx::UniqueId uniqueQueueId,
@@ -220,6 +306,14 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (getMembers()->m_inlineChunks.contains(chunkHeader))
+    {
+        // inline chunks are only used without history; the chunk is consumed like it would have been sent
+        stampChunk(chunkHeader);
+        getMembers()->m_inlineChunks.release(chunkHeader);
+        return;
+    }
+
     mepoo::SharedChunk chunk(nullptr);
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
     if (getChunkReadyForSend(chunkHeader, chunk))
@@ -249,6 +343,7 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_inlineChunks.releaseAll();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
 }
@@ -259,7 +354,7 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
 {
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
-        chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        stampChunk(chunk.getChunkHeader());
         return true;
     }
     else
@@ -269,6 +364,33 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendInline(mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    stampChunk(chunkHeader);
+
+    mepoo::InlineChunk inlineChunk;
+    MemberType_t::InlineChunkSlots_t::pack(*chunkHeader, inlineChunk);
+    getMembers()->m_inlineChunks.release(chunkHeader);
+
+    return this->deliverInlineToAllStoredQueues(inlineChunk);
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::stampChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    chunkHeader->setSequenceNumber(getMembers()->m_sequenceNumber++);
+
+    if (getMembers()->m_stampPublishTimestamp)
+    {
+        chunkHeader->setPublishTimestamp(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch())
+                .count()));
+    }
+
+    ChunkTrace::trace(ChunkTraceEventType::PUBLISH, static_cast<uint64_t>(chunkHeader->originId()), chunkHeader);
+}
+
 } // namespace popo
 } // namespace iox
 
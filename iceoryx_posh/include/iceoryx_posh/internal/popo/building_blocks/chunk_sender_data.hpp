@@ -19,6 +19,8 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_layout_cache.hpp"
+#include "iceoryx_posh/internal/mepoo/inline_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
@@ -35,15 +37,28 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(cxx::not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const bool useInlineChunks = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
+    /// @brief the slots are only provided if the connected chunk queues can take InlineChunks
+    using InlineChunkSlots_t =
+        mepoo::InlineChunkSlots<(ChunkDistributorDataType::ChunkQueueData_t::MAX_INLINE_CAPACITY > 0U)
+                                    ? MaxChunksAllocatedSimultaneously
+                                    : 0U>;
+
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
 
     const rp::RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    mepoo::ChunkLayoutCache m_chunkLayoutCache;
+    const bool m_useInlineChunks{false};
+    InlineChunkSlots_t m_inlineChunks;
+    /// the publish timestamp costs a clock read per chunk, therefore it is only set on request
+    bool m_stampPublishTimestamp{false};
 };
 
 } // namespace popo
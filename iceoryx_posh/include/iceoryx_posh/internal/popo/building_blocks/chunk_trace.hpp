@@ -0,0 +1,155 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRACE_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRACE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The steps in the lifecycle of a chunk which are traced
+enum class ChunkTraceEventType : uint32_t
+{
+    /// @brief a publisher loaned the chunk; the id is the one of the publisher port
+    LOAN,
+    /// @brief a publisher published the chunk; the id is the one of the publisher port
+    PUBLISH,
+    /// @brief the chunk was pushed to a chunk queue; the id is the one of the chunk queue
+    PUSH,
+    /// @brief a subscriber took the chunk from its chunk queue; the id is the one of the chunk queue
+    TAKE,
+    /// @brief a subscriber released the chunk; the id is the one of the chunk queue
+    RELEASE,
+    /// @brief a publisher released a loaned chunk without publishing it; the id is the one of the publisher port
+    DISCARD,
+};
+
+inline constexpr const char* asStringLiteral(const ChunkTraceEventType value) noexcept;
+
+/// @brief A single entry of a ChunkTraceRing
+struct ChunkTraceEvent
+{
+    /// @brief the value of position while a writer owns the event
+    static constexpr uint64_t POSITION_BUSY{std::numeric_limits<uint64_t>::max()};
+
+    /// @brief the position of the event in the ring plus one, written last; 0 marks an event which was never written
+    /// and POSITION_BUSY an event which is written. A writer claims the event by exchanging the position with
+    /// POSITION_BUSY, a reader discards the event if the value changed while it was read
+    std::atomic<uint64_t> position{0U};
+    /// @brief the time of the event in nanoseconds of the steady clock, which is shared by all processes
+    uint64_t timestamp{0U};
+    /// @brief the unique id of the publisher port or of the chunk queue, depending on the ChunkTraceEventType
+    uint64_t id{0U};
+    /// @brief the shared memory segment id in the upper 16 bit and the offset of the ChunkHeader in the segment in
+    /// the lower 48 bit; it identifies a chunk across processes. Chunks outside of a registered segment, like
+    /// inline chunks, have segment id 0 and their process local address as offset.
+    uint64_t chunk{0U};
+    /// @brief the ChunkHeader::sequenceNumber; is only meaningful after the chunk was published
+    uint64_t sequenceNumber{0U};
+    ChunkTraceEventType type{ChunkTraceEventType::LOAN};
+    uint32_t reserved{0U};
+};
+
+/// @brief The head of the shared memory of a trace ring; it is followed by 'capacity' ChunkTraceEvents. The ring is
+/// written by all threads of a process without locks; when it is full the oldest events are overwritten.
+struct ChunkTraceRing
+{
+    static constexpr uint32_t VERSION{1U};
+    static constexpr uint64_t SEGMENT_ID_SHIFT{48U};
+
+    uint32_t version{VERSION};
+    uint32_t eventSize{static_cast<uint32_t>(sizeof(ChunkTraceEvent))};
+    /// @brief a power of two
+    uint64_t capacity{0U};
+    uint64_t pid{0U};
+    RuntimeName_t runtimeName;
+    /// @brief the number of events which were written so far; the next event is written at writeIndex % capacity
+    std::atomic<uint64_t> writeIndex{0U};
+
+    ChunkTraceEvent* events() noexcept;
+    const ChunkTraceEvent* events() const noexcept;
+
+    /// @brief the size of the shared memory for a ring with the given capacity
+    static uint64_t requiredMemorySize(const uint64_t capacity) noexcept;
+};
+
+constexpr const char CHUNK_TRACE_SHM_PREFIX[] = "iox_trace_";
+/// @brief the runtime enables the chunk trace with this capacity if the environment variable is set
+constexpr const char CHUNK_TRACE_CAPACITY_ENV_VARIABLE[] = "IOX_CHUNK_TRACE_CAPACITY";
+/// @brief the upper bound for the capacity of a trace ring; a ring of this capacity occupies 48 MiB of shared memory
+constexpr uint64_t MAX_CHUNK_TRACE_CAPACITY{1U << 20U};
+
+enum class ChunkTraceError
+{
+    INVALID_CAPACITY,
+    ALREADY_ENABLED,
+    UNABLE_TO_CREATE_SHARED_MEMORY,
+};
+
+/// @brief The chunk trace writes the lifecycle events of all chunks which pass the ChunkSender, ChunkQueuePusher and
+/// ChunkReceiver of a process into a ChunkTraceRing in the shared memory named CHUNK_TRACE_SHM_PREFIX + runtime name.
+/// The ring can be exported by iox-trace-export while the process runs or after it terminated, since the shared
+/// memory is only removed by disable().
+/// @note when the trace is disabled, every hook costs a single load and branch
+class ChunkTrace
+{
+  public:
+    /// @brief creates the trace ring and starts tracing
+    /// @param[in] runtimeName is part of the shared memory name and stored in the ring
+    /// @param[in] capacity of the ring in events; must be a power of two and not larger than MAX_CHUNK_TRACE_CAPACITY
+    /// @return ChunkTraceError if the ring could not be created or the trace is already enabled
+    static cxx::expected<ChunkTraceError> enable(const RuntimeName_t& runtimeName, const uint64_t capacity) noexcept;
+
+    /// @brief stops tracing and removes the trace ring
+    /// @note must not be called concurrently to ports which send or receive chunks
+    static void disable() noexcept;
+
+    static bool isEnabled() noexcept;
+
+    /// @brief records an event if the trace is enabled
+    /// @param[in] type of the event
+    /// @param[in] id of the publisher port or the chunk queue
+    /// @param[in] chunkHeader of the chunk
+    static void
+    trace(const ChunkTraceEventType type, const uint64_t id, const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief the name of the shared memory of the trace ring of a runtime
+    static posix::SharedMemory::Name_t shmName(const RuntimeName_t& runtimeName) noexcept;
+
+  private:
+    static void write(ChunkTraceRing& ring,
+                      const ChunkTraceEventType type,
+                      const uint64_t id,
+                      const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    static std::atomic<ChunkTraceRing*> m_ring;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.inl"
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRACE_HPP
@@ -0,0 +1,61 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRACE_INL
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRACE_INL
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
+
+namespace iox
+{
+namespace popo
+{
+inline constexpr const char* asStringLiteral(const ChunkTraceEventType value) noexcept
+{
+    switch (value)
+    {
+    case ChunkTraceEventType::LOAN:
+        return "loan";
+    case ChunkTraceEventType::PUBLISH:
+        return "publish";
+    case ChunkTraceEventType::PUSH:
+        return "push";
+    case ChunkTraceEventType::TAKE:
+        return "take";
+    case ChunkTraceEventType::RELEASE:
+        return "release";
+    case ChunkTraceEventType::DISCARD:
+        return "discard";
+    }
+
+    return "[Undefined ChunkTraceEventType]";
+}
+
+inline void ChunkTrace::trace(const ChunkTraceEventType type,
+                              const uint64_t id,
+                              const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    // the only cost of a disabled trace; the event itself is written out of line
+    auto ring = m_ring.load(std::memory_order_acquire);
+    if (ring != nullptr)
+    {
+        write(*ring, type, id, chunkHeader);
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRACE_INL
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_FILE_DESCRIPTOR_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_FILE_DESCRIPTOR_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class ConditionFileDescriptorError
+{
+    NOT_SUPPORTED,
+    UNABLE_TO_CREATE_SOCKET,
+};
+
+/// @brief The ConditionFileDescriptor is a file descriptor which becomes readable whenever a ConditionNotifier
+/// notifies its ConditionVariableData. It can be added to the epoll set of an external event loop.
+/// @details The shared memory semaphore of the condition variable cannot be polled and a file descriptor cannot be
+/// shared with the notifiers, which live in other processes. Therefore the ConditionFileDescriptor binds a datagram
+/// socket to a file next to the unix domain sockets of the runtimes and stores its id in the ConditionVariableData.
+/// Every notifier sends a single byte to this file. The file is accessible for the user and the group of the waiter
+/// only. Only one byte is sent until the waiter calls reset, so that the socket buffer cannot fill up.
+/// @note Only available on Linux. A notifier costs one atomic load when no ConditionFileDescriptor is created.
+class ConditionFileDescriptor
+{
+  public:
+    /// @brief creates the socket and enables the signaling for the condition variable
+    /// @param[in] condVarData the condition variable which is signaled; must outlive the ConditionFileDescriptor
+    /// @return ConditionFileDescriptorError if the socket could not be created
+    static cxx::expected<ConditionFileDescriptor, ConditionFileDescriptorError>
+    create(ConditionVariableData& condVarData) noexcept;
+
+    ConditionFileDescriptor(const ConditionFileDescriptor&) = delete;
+    ConditionFileDescriptor(ConditionFileDescriptor&& rhs) noexcept;
+    ConditionFileDescriptor& operator=(const ConditionFileDescriptor&) = delete;
+    ConditionFileDescriptor& operator=(ConditionFileDescriptor&& rhs) noexcept;
+
+    /// @brief disables the signaling, closes the socket and removes its file
+    ~ConditionFileDescriptor() noexcept;
+
+    /// @brief the file descriptor is owned by the ConditionFileDescriptor and is only valid during its lifetime
+    int32_t getFileDescriptor() const noexcept;
+
+    /// @brief discards the pending signals; must be called by the waiter before it collects the notifications of
+    /// the condition variable, otherwise a notification which arrives in between is not signaled
+    void reset() noexcept;
+
+    /// @brief signals the ConditionFileDescriptor of the condition variable if there is one and it was not signaled
+    /// since the last reset; the signaling is disabled when the socket of the waiter is gone
+    /// @param[in] condVarData the condition variable which was notified
+    static void signal(ConditionVariableData& condVarData) noexcept;
+
+  private:
+    ConditionFileDescriptor(ConditionVariableData& condVarData,
+                            const int32_t fileDescriptor,
+                            const uint64_t id) noexcept;
+    void destroy() noexcept;
+
+  private:
+    ConditionVariableData* m_condVarDataPtr{nullptr};
+    int32_t m_fileDescriptor{-1};
+    uint64_t m_id{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_FILE_DESCRIPTOR_HPP
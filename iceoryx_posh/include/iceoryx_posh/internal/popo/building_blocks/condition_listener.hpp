@@ -19,7 +19,9 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/io_reactor.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
 
 namespace iox
 {
@@ -31,7 +33,13 @@ class ConditionListener
   public:
     using NotificationVector_t = cxx::vector<cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @param[in] condVarData the condition variable to wait on
+    /// @param[in] waitOptions defines whether wait() and timedWait() block, poll or poll before blocking
+    /// @param[in] ioReactor of the owner; while it watches file descriptors, wait() and timedWait() block in it
+    /// instead of the semaphore, it must outlive the ConditionListener
+    explicit ConditionListener(ConditionVariableData& condVarData,
+                               const WaitOptions& waitOptions = {},
+                               IoReactor* const ioReactor = nullptr) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -50,7 +58,8 @@ class ConditionListener
 
     /// @brief returns a sorted vector of indices of active notifications; blocking if ConditionVariableData was
     /// not notified unless destroy() was called before. The indices of active notifications are
-    /// never empty unless destroy() was called, then it's always empty.
+    /// never empty unless destroy() was called, then it's always empty. Deferred notifications are activated
+    /// when their deadline has passed.
     ///
     /// @return a sorted vector of active notifications
     NotificationVector_t wait() noexcept;
@@ -71,12 +80,39 @@ class ConditionListener
   private:
     void reset(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
+    bool hasActiveNotifications() const noexcept;
+
+    /// @brief the time until the earliest deferred notification is due
+    /// @return zero if it is overdue and units::Duration::max() if no notification is deferred
+    units::Duration timeUntilDeferredNotifications() const noexcept;
+
+    /// @brief turns the deferred notifications into active notifications once the deadline has passed
+    void activateDueDeferredNotifications() noexcept;
+
+    /// @brief polls according to the WaitStrategy and blocks afterwards until timeToWait has passed or the
+    /// semaphore is posted
+    void waitFor(const units::Duration& timeToWait, const PoshError semaphoreError) noexcept;
+
+    /// @brief like waitFor but blocks in the IoReactor, which also calls the callbacks of the ready file descriptors
+    void waitForIo(const units::Duration& timeToWait) noexcept;
+
+    bool hasIoWatches() const noexcept;
+
+    /// @brief the part of the timeToWait which is spent polling according to the WaitStrategy
+    units::Duration pollDuration(const units::Duration& timeToWait) const noexcept;
+
+    /// @brief polls the notifications until one is active or deferred notifications are due, destroy() was called
+    /// or timeToPoll has passed
+    /// @return true if a notification is active or due or destroy() was called, false when timeToPoll has passed
+    bool pollForNotifications(const units::Duration& timeToPoll) const noexcept;
 
     NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    WaitOptions m_waitOptions;
+    IoReactor* m_ioReactor{nullptr};
 };
 
 } // namespace popo
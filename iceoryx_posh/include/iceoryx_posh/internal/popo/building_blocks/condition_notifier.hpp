@@ -41,6 +41,11 @@ class ConditionNotifier
     /// @brief If threads are waiting on the condition variable, this call unblocks one of the waiting threads
     void notify() noexcept;
 
+    /// @brief Defers the notification to a deadline. A listener which waits in wait() or timedWait() activates the
+    /// notification at the latest when the deadline has passed, a notify() before makes it obsolete
+    /// @param[in] deadline the time since the epoch of the steady clock
+    void deferNotification(const units::Duration& deadline) noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
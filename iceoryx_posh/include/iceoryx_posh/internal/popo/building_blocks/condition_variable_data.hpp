@@ -22,6 +22,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <atomic>
+#include <limits>
 
 namespace iox
 {
@@ -29,6 +30,9 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    /// @brief the value of m_deferredNotificationDeadline when no notification is deferred
+    static constexpr uint64_t NO_DEFERRED_NOTIFICATION{std::numeric_limits<uint64_t>::max()};
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -48,6 +52,15 @@ struct ConditionVariableData
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
     std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief notifications which were deferred by a notifier; a waiting listener activates them at the latest when
+    /// m_deferredNotificationDeadline has passed
+    std::atomic_bool m_deferredNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief the earliest deadline of the deferred notifications in nanoseconds of the steady clock
+    std::atomic<uint64_t> m_deferredNotificationDeadline{NO_DEFERRED_NOTIFICATION};
+    /// @brief the id of the ConditionFileDescriptor which is signaled on every notification; 0 if there is none
+    std::atomic<uint64_t> m_fileDescriptorId{0U};
+    /// @brief true if the ConditionFileDescriptor was signaled and not yet reset
+    std::atomic_bool m_fileDescriptorSignaled{false};
 };
 
 } // namespace popo
@@ -0,0 +1,107 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A histogram of latencies in nanoseconds which lives in the shared memory. The buckets grow logarithmically,
+/// every power of two is split into 2^SUB_BUCKET_BITS buckets, which bounds the relative error of a bucket to 25%.
+/// Latencies beyond the range of the last bucket are counted in the last bucket.
+/// @note record is wait-free and can be called concurrently to the snapshots; a snapshot is not atomic over all
+/// buckets which is irrelevant for statistics
+class LatencyHistogram
+{
+  public:
+    static constexpr uint64_t SUB_BUCKET_BITS{2U};
+    static constexpr uint64_t NUMBER_OF_SUB_BUCKETS{1U << SUB_BUCKET_BITS};
+    /// @brief with 2 sub bucket bits the last bucket starts at about 7.5 s
+    static constexpr uint64_t NUMBER_OF_BUCKETS{128U};
+
+    /// @brief a copy of the bucket counters to evaluate them in the process space of the reader
+    struct Snapshot
+    {
+        uint64_t counts[NUMBER_OF_BUCKETS]{};
+
+        /// @brief the number of samples in all buckets
+        uint64_t numberOfSamples() const noexcept;
+
+        /// @brief returns the upper bound of the bucket which contains the given percentile
+        /// @param[in] percentile in the range of [0, 100]
+        /// @return the latency in nanoseconds or 0 if the snapshot is empty
+        uint64_t percentile(const double percentile) const noexcept;
+
+        /// @brief returns the upper bound of the highest bucket with samples or 0 if the snapshot is empty
+        uint64_t max() const noexcept;
+    };
+
+    LatencyHistogram() noexcept;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+    ~LatencyHistogram() noexcept = default;
+
+    /// @brief counts the latency in its bucket
+    void record(const uint64_t latencyInNs) noexcept;
+
+    Snapshot snapshot() const noexcept;
+
+    /// @brief takes a snapshot and resets the buckets which it contains; a sample which is recorded concurrently is
+    /// either part of the snapshot or stays in the histogram
+    /// @note is meant for a single reader, like the port introspection, which evaluates the samples per interval
+    Snapshot snapshotAndReset() noexcept;
+
+    /// @brief the bucket which counts the given latency
+    static uint64_t bucketIndex(const uint64_t latencyInNs) noexcept;
+
+    /// @brief the largest latency which is counted in the given bucket
+    static uint64_t bucketUpperBound(const uint64_t index) noexcept;
+
+  private:
+    std::atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS];
+};
+
+/// @brief Takes the place of the LatencyHistogram when the take latencies are not recorded, so that the ports do not
+/// pay for its memory. Every snapshot is empty.
+class NoLatencyHistogram
+{
+  public:
+    void record(const uint64_t) noexcept
+    {
+    }
+
+    LatencyHistogram::Snapshot snapshot() const noexcept
+    {
+        return LatencyHistogram::Snapshot();
+    }
+
+    LatencyHistogram::Snapshot snapshotAndReset() noexcept
+    {
+        return LatencyHistogram::Snapshot();
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
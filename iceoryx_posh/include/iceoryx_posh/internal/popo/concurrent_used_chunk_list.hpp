@@ -0,0 +1,109 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_CONCURRENT_USED_CHUNK_LIST_HPP
+#define IOX_POSH_POPO_CONCURRENT_USED_CHUNK_LIST_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The ConcurrentUsedChunkList keeps track of the chunks currently in use by the application like the
+///        UsedChunkList, but can be accessed by multiple threads of the application simultaneously. Each entry is a
+///        64 bit atomic which is claimed and released with a compare-and-swap, therefore RouDi can always access the
+///        list for the cleanup without torn reads. The number of chunks which can be stored is limited at runtime by
+///        a limit up to the Capacity.
+template <uint32_t Capacity>
+class ConcurrentUsedChunkList
+{
+    static_assert(Capacity > 0, "ConcurrentUsedChunkList Capacity must be larger than 0!");
+
+  public:
+    /// @brief Constructs a default ConcurrentUsedChunkList with the limit set to Capacity
+    ConcurrentUsedChunkList() noexcept;
+
+    ConcurrentUsedChunkList(const ConcurrentUsedChunkList&) = delete;
+    ConcurrentUsedChunkList(ConcurrentUsedChunkList&&) = delete;
+    ConcurrentUsedChunkList& operator=(const ConcurrentUsedChunkList&) = delete;
+    ConcurrentUsedChunkList& operator=(ConcurrentUsedChunkList&&) = delete;
+    ~ConcurrentUsedChunkList() noexcept = default;
+
+    /// @brief Sets the maximum number of chunks which can be stored simultaneously
+    /// @param[in] limit of stored chunks; values larger than Capacity are reduced to Capacity
+    /// @note must be called before the list is used, e.g. on construction of the port data
+    void setLimit(const uint32_t limit) noexcept;
+
+    /// @brief Returns the maximum number of chunks which can be stored simultaneously
+    /// @return the current limit
+    uint32_t limit() const noexcept;
+
+    /// @brief Inserts a SharedChunk into the list
+    /// @param[in] chunk to store in the list
+    /// @return true if successful, otherwise false if the limit of stored chunks is reached
+    /// @note only from runtime context; thread-safe
+    bool insert(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Reserves entries for up to numberOfChunks chunks which are inserted with insertReserved
+    /// @param[in] numberOfChunks to reserve
+    /// @return the number of reserved entries, less than numberOfChunks if the limit would be exceeded
+    /// @note only from runtime context; thread-safe
+    uint32_t reserve(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Inserts a SharedChunk into an entry which was reserved before, therefore it cannot fail
+    /// @param[in] chunk to store in the list
+    /// @note only from runtime context; thread-safe
+    void insertReserved(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Releases reserved entries which were not used by insertReserved
+    /// @param[in] numberOfChunks the number of unused reserved entries
+    /// @note only from runtime context; thread-safe
+    void cancelReservation(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Removes a chunk from the list
+    /// @param[in] chunkHeader to look for a corresponding SharedChunk
+    /// @param[out] chunk which is removed
+    /// @return true if successfully removed, otherwise false if e.g. the chunkHeader was not found in the list
+    /// @note only from runtime context; thread-safe
+    bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief Cleans up all the remaining chunks from the list.
+    /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
+    /// still running.
+    void cleanup() noexcept;
+
+  private:
+    using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
+
+  private:
+    std::atomic<uint32_t> m_numberOfChunks{0U};
+    uint32_t m_limit{Capacity};
+    std::atomic<DataElement_t> m_listData[Capacity];
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/concurrent_used_chunk_list.inl"
+
+#endif // IOX_POSH_POPO_CONCURRENT_USED_CHUNK_LIST_HPP
@@ -0,0 +1,144 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_CONCURRENT_USED_CHUNK_LIST_INL
+#define IOX_POSH_POPO_CONCURRENT_USED_CHUNK_LIST_INL
+
+#include "iceoryx_posh/internal/popo/concurrent_used_chunk_list.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <uint32_t Capacity>
+inline ConcurrentUsedChunkList<Capacity>::ConcurrentUsedChunkList() noexcept
+{
+    static_assert(sizeof(DataElement_t) <= 8U, "The size of the data element type must not exceed 64 bit!");
+    static_assert(std::is_trivially_copyable<DataElement_t>::value,
+                  "The data element type must be trivially copyable!");
+
+    for (auto& data : m_listData)
+    {
+        data.store(DataElement_t(), std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <uint32_t Capacity>
+inline void ConcurrentUsedChunkList<Capacity>::setLimit(const uint32_t limit) noexcept
+{
+    m_limit = (limit < Capacity) ? limit : Capacity;
+}
+
+template <uint32_t Capacity>
+inline uint32_t ConcurrentUsedChunkList<Capacity>::limit() const noexcept
+{
+    return m_limit;
+}
+
+template <uint32_t Capacity>
+inline bool ConcurrentUsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
+{
+    // reserve an entry first; afterwards there is guaranteed to be a free entry which only has to be found
+    if (m_numberOfChunks.fetch_add(1U, std::memory_order_relaxed) >= m_limit)
+    {
+        m_numberOfChunks.fetch_sub(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    insertReserved(chunk);
+    return true;
+}
+
+template <uint32_t Capacity>
+inline uint32_t ConcurrentUsedChunkList<Capacity>::reserve(const uint32_t numberOfChunks) noexcept
+{
+    auto numberOfStoredChunks = m_numberOfChunks.load(std::memory_order_relaxed);
+    uint32_t numberOfReservedChunks{0U};
+    do
+    {
+        const uint32_t numberOfFreeEntries = (numberOfStoredChunks < m_limit) ? m_limit - numberOfStoredChunks : 0U;
+        numberOfReservedChunks = (numberOfChunks < numberOfFreeEntries) ? numberOfChunks : numberOfFreeEntries;
+    } while (numberOfReservedChunks > 0U
+             && !m_numberOfChunks.compare_exchange_weak(
+                 numberOfStoredChunks, numberOfStoredChunks + numberOfReservedChunks, std::memory_order_relaxed));
+
+    return numberOfReservedChunks;
+}
+
+template <uint32_t Capacity>
+inline void ConcurrentUsedChunkList<Capacity>::insertReserved(mepoo::SharedChunk chunk) noexcept
+{
+    // the entry is already counted, therefore there is guaranteed to be a free entry which only has to be found
+    const DataElement_t newData(chunk);
+    while (true)
+    {
+        for (auto& data : m_listData)
+        {
+            auto currentData = data.load(std::memory_order_relaxed);
+            if (currentData.isLogicalNullptr()
+                && data.compare_exchange_strong(currentData, newData, std::memory_order_acq_rel))
+            {
+                return;
+            }
+        }
+    }
+}
+
+template <uint32_t Capacity>
+inline void ConcurrentUsedChunkList<Capacity>::cancelReservation(const uint32_t numberOfChunks) noexcept
+{
+    m_numberOfChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+}
+
+template <uint32_t Capacity>
+inline bool ConcurrentUsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader,
+                                                      mepoo::SharedChunk& chunk) noexcept
+{
+    for (auto& data : m_listData)
+    {
+        auto currentData = data.load(std::memory_order_acquire);
+        if (!currentData.isLogicalNullptr() && currentData.getChunkHeader() == chunkHeader
+            && data.compare_exchange_strong(currentData, DataElement_t(), std::memory_order_acq_rel))
+        {
+            chunk = currentData.releaseToSharedChunk();
+            m_numberOfChunks.fetch_sub(1U, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <uint32_t Capacity>
+inline void ConcurrentUsedChunkList<Capacity>::cleanup() noexcept
+{
+    for (auto& data : m_listData)
+    {
+        auto currentData = data.exchange(DataElement_t(), std::memory_order_acq_rel);
+        if (!currentData.isLogicalNullptr())
+        {
+            // release ownership by creating a SharedChunk
+            currentData.releaseToSharedChunk();
+        }
+    }
+
+    m_numberOfChunks.store(0U, std::memory_order_relaxed);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_CONCURRENT_USED_CHUNK_LIST_INL
@@ -0,0 +1,137 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_IO_REACTOR_HPP
+#define IOX_POSH_POPO_IO_REACTOR_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/method_callback.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_file_descriptor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+enum class IoReactorError
+{
+    NOT_SUPPORTED,
+    REACTOR_FULL,
+    UNABLE_TO_WATCH_FILE_DESCRIPTOR,
+};
+
+/// @brief The IoReactor of a WaitSet or Listener watches the file descriptors of the attached FileDescriptorTrigger
+/// and TimerTrigger. As soon as a file descriptor is watched, the thread which waits in the WaitSet or Listener does
+/// not block on the semaphore of the condition variable anymore but in epoll_wait, on the watched file descriptors
+/// and a ConditionFileDescriptor of the condition variable. It calls the callbacks of the ready file descriptors
+/// itself; they notify the condition variable, so that the file descriptors are handled like iceoryx events.
+/// @note only available on Linux, where it is based on epoll
+class IoReactor
+{
+  public:
+    enum class Readiness : uint8_t
+    {
+        READABLE,
+        WRITABLE,
+    };
+
+    using Callback_t = cxx::MethodCallback<void>;
+
+    /// @param[in] condVarData the condition variable of the WaitSet or Listener; must outlive the IoReactor
+    explicit IoReactor(ConditionVariableData& condVarData) noexcept;
+    IoReactor(const IoReactor&) = delete;
+    IoReactor(IoReactor&&) = delete;
+    IoReactor& operator=(const IoReactor&) = delete;
+    IoReactor& operator=(IoReactor&&) = delete;
+    ~IoReactor() noexcept;
+
+    /// @brief starts to watch a file descriptor; the callback is called by the waiting thread whenever the file
+    /// descriptor becomes ready, i.e. it is edge triggered. A file descriptor can be watched by multiple watches,
+    /// e.g. one for READABLE and one for WRITABLE.
+    /// @param[in] fileDescriptor which is watched
+    /// @param[in] readiness which is watched
+    /// @param[in] callback which is called when the file descriptor becomes ready, it must not call unwatch
+    /// @return the id of the watch which is required for unwatch or the IoReactorError
+    cxx::expected<uint64_t, IoReactorError>
+    watch(const int32_t fileDescriptor, const Readiness readiness, const Callback_t& callback) noexcept;
+
+    /// @brief stops to watch; when the call returns, the callback of the watch is neither running nor called again
+    /// @param[in] watchId which was returned by watch
+    void unwatch(const uint64_t watchId) noexcept;
+
+    /// @brief true if a file descriptor is watched; the waiting thread has to wait with wait() then
+    bool hasWatches() const noexcept;
+
+    /// @brief blocks until the condition variable is notified, a watched file descriptor becomes ready or the
+    /// timeout has passed and calls the callbacks of the ready file descriptors
+    /// @param[in] timeout how long at most to block; units::Duration::max() blocks without a timeout
+    void wait(const units::Duration& timeout) noexcept;
+
+    /// @brief makes the file descriptor of getFileDescriptor readable after the given time, so that an external event
+    /// loop wakes up at the deadline of the deferred notifications of the condition variable; an earlier call is
+    /// replaced
+    /// @param[in] timeUntilDeadline the time after which the file descriptor becomes readable
+    void wakeUpAfter(const units::Duration& timeUntilDeadline) noexcept;
+
+    /// @brief discards a pending signal of the condition variable; must be called before the notifications of the
+    /// condition variable are collected, otherwise a notification which arrives in between does not end wait()
+    void resetConditionSignal() noexcept;
+
+    /// @brief returns a file descriptor which becomes readable whenever the condition variable is notified or a
+    /// watched file descriptor becomes ready; it is valid until the IoReactor is destroyed
+    cxx::expected<int32_t, IoReactorError> getFileDescriptor() noexcept;
+
+    /// @brief stops the signaling of the condition variable; must be called before the condition variable is
+    /// marked for destruction, since the ConditionFileDescriptor accesses it
+    void releaseConditionVariable() noexcept;
+
+  private:
+    struct Watch
+    {
+        int32_t fileDescriptor{-1};
+        Readiness readiness{Readiness::READABLE};
+        Callback_t callback;
+    };
+
+    /// @brief creates the epoll instance with the ConditionFileDescriptor; must be called with the lock held
+    bool createEpollInstance() noexcept;
+
+    /// @brief discards the expiration of the deadline timer; must be called with the lock held
+    void discardDeadlineExpiration() noexcept;
+
+    /// @brief registers the union of the readiness of all watches of the file descriptor at the epoll instance;
+    /// must be called with the lock held
+    bool updateEpollInstance(const int32_t fileDescriptor) noexcept;
+
+    mutable std::mutex m_mutex;
+    ConditionVariableData* m_condVarDataPtr{nullptr};
+    cxx::optional<ConditionFileDescriptor> m_conditionFileDescriptor;
+    cxx::optional<Watch> m_watches[MAX_NUMBER_OF_IO_TRIGGERS];
+    std::atomic<uint64_t> m_numberOfWatches{0U};
+    std::atomic<int32_t> m_epollFd{-1};
+    int32_t m_deadlineTimerFd{-1};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_IO_REACTOR_HPP
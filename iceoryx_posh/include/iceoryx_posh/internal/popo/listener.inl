@@ -43,7 +43,10 @@ ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
-                TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl<Capacity>::removeTrigger}, eventId));
+                TriggerHandle(*m_conditionVariableData,
+                              {*this, &ListenerImpl<Capacity>::removeTrigger},
+                              eventId,
+                              &m_ioReactor));
         });
 }
 
@@ -67,7 +70,10 @@ inline cxx::expected<ListenerError> ListenerImpl<Capacity>::attachEvent(
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
-                TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl<Capacity>::removeTrigger}, eventId),
+                TriggerHandle(*m_conditionVariableData,
+                              {*this, &ListenerImpl<Capacity>::removeTrigger},
+                              eventId,
+                              &m_ioReactor),
                 eventType);
         });
 }
@@ -101,9 +107,17 @@ inline ListenerImpl<Capacity>::ListenerImpl() noexcept
 }
 
 template <uint64_t Capacity>
-inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
-    : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
+inline ListenerImpl<Capacity>::ListenerImpl(const WaitOptions& waitOptions) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitOptions)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const WaitOptions& waitOptions) noexcept
+    : m_ioReactor(conditionVariable)
+    , m_conditionVariableData(&conditionVariable)
+    , m_conditionListener(conditionVariable, waitOptions, &m_ioReactor)
 {
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
@@ -115,6 +129,7 @@ inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+    m_ioReactor.releaseConditionVariable();
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
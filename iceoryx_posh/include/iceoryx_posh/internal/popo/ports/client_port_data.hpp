@@ -46,6 +46,9 @@ struct ClientPortData : public BasePortData
     ClientChunkReceiverData_t m_chunkReceiverData;
     std::atomic_bool m_connectRequested{false};
     std::atomic<ConnectionState> m_connectionState{ConnectionState::NOT_CONNECTED};
+    /// @brief the slot index of the response queue in the ChunkDistributor of the server, taken from the last
+    /// response; it is sent with each request to enable a fast lookup of the response queue in the server
+    std::atomic<uint32_t> m_lastKnownQueueIndex{RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX};
 };
 
 } // namespace popo
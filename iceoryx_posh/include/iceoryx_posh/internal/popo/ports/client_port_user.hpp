@@ -118,6 +118,14 @@ class ClientPortUser : public BasePort
     /// ChunkReceiveResult on error
     cxx::expected<const ResponseHeader*, ChunkReceiveResult> getResponse() noexcept;
 
+    /// @brief Tries to get up to maxNumberOfResponses responses from the queue with one call, the oldest response first
+    /// @param[in] maxNumberOfResponses, the maximum number of responses to get
+    /// @param[in] onResponse, is called with the ResponseHeader of each received response
+    /// @return the number of received responses, ChunkReceiveResult on error
+    cxx::expected<uint64_t, ChunkReceiveResult>
+    getResponses(const uint64_t maxNumberOfResponses,
+                 const cxx::function_ref<void(const ResponseHeader*)> onResponse) noexcept;
+
     /// @brief Release a response that was obtained with getResponseChunk
     /// @param[in] requestHeader, pointer to the ResponseHeader to release
     void releaseResponse(const ResponseHeader* const responseHeader) noexcept;
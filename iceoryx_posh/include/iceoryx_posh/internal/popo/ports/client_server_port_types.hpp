@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/internal/popo/concurrent_used_chunk_list.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 
 #include <cstdint>
@@ -44,11 +45,15 @@ struct ServerChunkDistributorConfig
 struct ClientChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_RESPONSE_QUEUE_CAPACITY;
+    /// @brief the client and server ports never transfer InlineChunks
+    static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = 0U;
 };
 
 struct ServerChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_REQUEST_QUEUE_CAPACITY;
+    /// @brief the client and server ports never transfer InlineChunks
+    static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = 0U;
 };
 
 using ClientChunkQueueData_t = ChunkQueueData<ClientChunkQueueConfig, ThreadSafePolicy>;
@@ -63,7 +68,8 @@ using ServerChunkDistributorData_t =
 
 using ClientChunkReceiverData_t = ChunkReceiverData<MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY, ClientChunkQueueData_t>;
 
-using ServerChunkReceiverData_t = ChunkReceiverData<MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY, ServerChunkQueueData_t>;
+using ServerChunkReceiverData_t =
+    ChunkReceiverData<MAX_REQUESTS_IN_FLIGHT_PER_SERVER, ServerChunkQueueData_t, ConcurrentUsedChunkList>;
 
 using ClientChunkSenderData_t = ChunkSenderData<MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY, ClientChunkDistributorData_t>;
 
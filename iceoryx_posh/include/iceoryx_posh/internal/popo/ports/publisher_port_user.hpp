@@ -71,6 +71,12 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks to all connected subscriber ports; every subscriber port is notified only
+    /// once for all the chunks
+    /// @param[in] chunkHeaders, pointer to an array of pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, the number of ChunkHeaders in the array
+    void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -40,7 +40,12 @@ struct ServerPortData : public BasePortData
                    const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
     ServerChunkSenderData_t m_chunkSenderData;
+    /// @brief the requests are taken from an MPMC queue and tracked in a ConcurrentUsedChunkList, therefore multiple
+    /// threads can take requests simultaneously
     ServerChunkReceiverData_t m_chunkReceiverData;
+    /// @brief serializes the allocation, release and sending of responses if multiple threads of the server process
+    /// requests; it is only used by the server process and not by RouDi
+    ThreadSafePolicy m_responseLock;
     std::atomic_bool m_offeringRequested{false};
     std::atomic_bool m_offered{false};
 
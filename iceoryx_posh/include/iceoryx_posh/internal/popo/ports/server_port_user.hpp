@@ -28,6 +28,8 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/popo/rpc_header.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace popo
@@ -95,7 +97,8 @@ inline log::LogStream& operator<<(log::LogStream& stream, ServerSendError value)
 /// is divided in the three parts ServerPortData, ServerPortRouDi and ServerPortUser. The ServerPortUser
 /// uses the functionality of a ChunkSender and ChunReceiver for receiving requests and sending responses.
 /// Additionally it provides the offer / stopOffer API which controls whether the server is discoverable
-/// for client ports
+/// for client ports. Requests can be taken and responses can be sent from multiple threads simultaneously, the number
+/// of requests held in parallel is limited by ServerOptions::maxRequestsInFlight.
 class ServerPortUser : public BasePort
 {
   public:
@@ -115,6 +118,14 @@ class ServerPortUser : public BasePort
     /// ServerRequestResult on error
     cxx::expected<const RequestHeader*, ServerRequestResult> getRequest() noexcept;
 
+    /// @brief Tries to get up to maxNumberOfRequests requests from the queue with one call, the oldest request first
+    /// @param[in] maxNumberOfRequests, the maximum number of requests to get
+    /// @param[in] onRequest, is called with the RequestHeader of each received request
+    /// @return the number of received requests, ServerRequestResult on error
+    cxx::expected<uint64_t, ServerRequestResult>
+    getRequests(const uint64_t maxNumberOfRequests,
+                const cxx::function_ref<void(const RequestHeader*)> onRequest) noexcept;
+
     /// @brief Release a request that was obtained with getRequest
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseRequest(const RequestHeader* const requestHeader) noexcept;
@@ -176,6 +187,8 @@ class ServerPortUser : public BasePort
     bool isConditionVariableSet() const noexcept;
 
   private:
+    using ResponseLockGuard_t = std::lock_guard<const ThreadSafePolicy>;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
@@ -68,6 +68,15 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Tries to get up to maxNumberOfChunks chunks from the queue with one call, the oldest chunk first
+    /// @param[in] maxNumberOfChunks, the maximum number of chunks to get
+    /// @param[in] onChunk, is called with the ChunkHeader of each received chunk
+    /// @return the number of received chunks, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    cxx::expected<uint64_t, ChunkReceiveResult>
+    tryGetChunks(const uint64_t maxNumberOfChunks,
+                 const cxx::function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -61,6 +61,15 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in one go and releases their loans. Compared to publishing the
+    /// samples one by one, each subscriber is notified only once.
+    /// @param samples Pointer to the first of the samples to publish, e.g. the data of a cxx::vector<Sample<T, H>, N>.
+    /// @param numberOfSamples The number of samples to publish.
+    /// @note The samples are empty afterwards and must not be accessed anymore.
+    ///
+    void publishBatch(Sample<T, H>* const samples, const uint64_t numberOfSamples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
@@ -80,6 +89,9 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     using BasePublisherType::port;
 
   private:
+    /// @brief resolves InlineSamplePolicy::AUTOMATIC depending on T, H and the history capacity
+    static PublisherOptions resolveInlineSamplePolicy(const PublisherOptions& publisherOptions) noexcept;
+
     Sample<T, H> convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept;
 
     cxx::expected<Sample<T, H>, AllocationError> loanSample() noexcept;
@@ -29,10 +29,28 @@ namespace popo
 template <typename T, typename H, typename BasePublisherType>
 inline PublisherImpl<T, H, BasePublisherType>::PublisherImpl(const capro::ServiceDescription& service,
                                                              const PublisherOptions& publisherOptions)
-    : BasePublisherType(service, publisherOptions)
+    : BasePublisherType(service, resolveInlineSamplePolicy(publisherOptions))
 {
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherOptions
+PublisherImpl<T, H, BasePublisherType>::resolveInlineSamplePolicy(const PublisherOptions& publisherOptions) noexcept
+{
+    constexpr bool SAMPLE_FITS_INLINE{std::is_same<H, mepoo::NoUserHeader>::value
+                                      && sizeof(T) <= MAX_INLINE_USER_PAYLOAD_SIZE
+                                      && alignof(T) <= alignof(mepoo::ChunkHeader)};
+
+    auto options = publisherOptions;
+    if (options.inlineSamplePolicy == InlineSamplePolicy::AUTOMATIC)
+    {
+        options.inlineSamplePolicy = (SAMPLE_FITS_INLINE && options.historyCapacity == 0U)
+                                         ? InlineSamplePolicy::ENABLED
+                                         : InlineSamplePolicy::DISABLED;
+    }
+    return options;
+}
+
 template <typename T, typename H, typename BasePublisherType>
 template <typename... Args>
 inline cxx::expected<Sample<T, H>, AllocationError>
@@ -91,6 +109,28 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(Sample<T, H>* const samples,
+                                                                 const uint64_t numberOfSamples) noexcept
+{
+    // a publisher cannot hold more samples at once, therefore this is usually done in one round
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    uint64_t numberOfPublishedSamples{0U};
+    while (numberOfPublishedSamples < numberOfSamples)
+    {
+        uint64_t numberOfChunks{0U};
+        for (; numberOfPublishedSamples < numberOfSamples
+               && numberOfChunks < MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
+             ++numberOfPublishedSamples)
+        {
+            // release the Samples ownership of the chunk before publishing
+            auto userPayload = samples[numberOfPublishedSamples].release();
+            chunkHeaders[numberOfChunks++] = mepoo::ChunkHeader::fromUserPayload(userPayload);
+        }
+        port().sendChunks(chunkHeaders, numberOfChunks);
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
@@ -68,6 +68,16 @@ class UntypedClientImpl : public BaseClientT
     ///          and must be manually done by calling `releaseResponse`
     cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    /// @brief Take up to maxNumberOfResponses response chunks from the top of the receive queue with one call.
+    /// @param[out] responsePayloads array of at least maxNumberOfResponses elements which is filled with the payload
+    /// pointers of the response chunks taken, the oldest response first
+    /// @param[in] maxNumberOfResponses the maximum number of responses to take
+    /// @return The number of response chunks taken.
+    /// @details No automatic cleanup of the associated chunks is performed
+    ///          and must be manually done by calling `releaseResponse` for each of them
+    cxx::expected<uint64_t, ChunkReceiveResult> takeMultiple(const void** const responsePayloads,
+                                                             const uint64_t maxNumberOfResponses) noexcept;
+
     /// @brief Releases the ownership of the response chunk provided by the payload pointer.
     /// @param responsePayload pointer to the payload of the chunk to be released
     /// @details The responsePayload pointer must have been previously provided by `take`
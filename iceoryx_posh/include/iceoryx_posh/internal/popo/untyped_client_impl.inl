@@ -83,6 +83,17 @@ cxx::expected<const void*, ChunkReceiveResult> UntypedClientImpl<BaseClientT>::t
     return cxx::success<const void*>(mepoo::ChunkHeader::fromUserHeader(responseResult.value())->userPayload());
 }
 
+template <typename BaseClientT>
+cxx::expected<uint64_t, ChunkReceiveResult>
+UntypedClientImpl<BaseClientT>::takeMultiple(const void** const responsePayloads,
+                                             const uint64_t maxNumberOfResponses) noexcept
+{
+    uint64_t index{0U};
+    return port().getResponses(maxNumberOfResponses, [&](const ResponseHeader* responseHeader) {
+        responsePayloads[index++] = mepoo::ChunkHeader::fromUserHeader(responseHeader)->userPayload();
+    });
+}
+
 template <typename BaseClientT>
 void UntypedClientImpl<BaseClientT>::releaseResponse(const void* const responsePayload) noexcept
 {
@@ -60,6 +60,14 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Publish the provided memory chunks in one go. Compared to publishing the chunks one by one, each
+    /// subscriber is notified only once.
+    /// @param userPayloads Pointer to an array of pointers to the user-payloads of the allocated shared memory chunks.
+    /// @param numberOfChunks The number of user-payload pointers in the array.
+    ///
+    void publishBatch(void* const* const userPayloads, const uint64_t numberOfChunks) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -38,6 +38,27 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(void* const* const userPayloads,
+                                                                  const uint64_t numberOfChunks) noexcept
+{
+    // a publisher cannot hold more chunks at once, therefore this is usually done in one round
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    uint64_t numberOfPublishedChunks{0U};
+    while (numberOfPublishedChunks < numberOfChunks)
+    {
+        uint64_t numberOfChunksInRound{0U};
+        for (; numberOfPublishedChunks < numberOfChunks
+               && numberOfChunksInRound < MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
+             ++numberOfPublishedChunks)
+        {
+            chunkHeaders[numberOfChunksInRound++] =
+                mepoo::ChunkHeader::fromUserPayload(userPayloads[numberOfPublishedChunks]);
+        }
+        port().sendChunks(chunkHeaders, numberOfChunksInRound);
+    }
+}
+
 template <typename BasePublisherType>
 inline cxx::expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
@@ -46,6 +46,16 @@ class UntypedServerImpl : public BaseServerT
     ///          and must be manually done by calling `releaseRequest`
     cxx::expected<const void*, ServerRequestResult> take() noexcept;
 
+    /// @brief Take up to maxNumberOfRequests request chunks from the top of the receive queue with one call.
+    /// @param[out] requestPayloads array of at least maxNumberOfRequests elements which is filled with the payload
+    /// pointers of the request chunks taken, the oldest request first
+    /// @param[in] maxNumberOfRequests the maximum number of requests to take
+    /// @return The number of request chunks taken.
+    /// @details No automatic cleanup of the associated chunks is performed
+    ///          and must be manually done by calling `releaseRequest` for each of them
+    cxx::expected<uint64_t, ServerRequestResult> takeMultiple(const void** const requestPayloads,
+                                                              const uint64_t maxNumberOfRequests) noexcept;
+
     /// @brief Releases the ownership of the request chunk provided by the payload pointer.
     /// @param requestPayload pointer to the payload of the chunk to be released
     /// @details The requestPayload pointer must have been previously provided by `take`
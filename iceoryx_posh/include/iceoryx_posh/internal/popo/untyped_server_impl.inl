@@ -48,6 +48,17 @@ cxx::expected<const void*, ServerRequestResult> UntypedServerImpl<BaseServerT>::
     return cxx::success<const void*>(mepoo::ChunkHeader::fromUserHeader(requestResult.value())->userPayload());
 }
 
+template <typename BaseServerT>
+cxx::expected<uint64_t, ServerRequestResult>
+UntypedServerImpl<BaseServerT>::takeMultiple(const void** const requestPayloads,
+                                             const uint64_t maxNumberOfRequests) noexcept
+{
+    uint64_t index{0U};
+    return port().getRequests(maxNumberOfRequests, [&](const RequestHeader* requestHeader) {
+        requestPayloads[index++] = mepoo::ChunkHeader::fromUserHeader(requestHeader)->userPayload();
+    });
+}
+
 template <typename BaseServerT>
 void UntypedServerImpl<BaseServerT>::releaseRequest(const void* const requestPayload) noexcept
 {
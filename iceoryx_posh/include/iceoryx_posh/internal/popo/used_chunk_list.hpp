@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 #define IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -60,6 +62,22 @@ class UsedChunkList
     /// @note only from runtime context
     bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Reserves entries for up to numberOfChunks chunks which are inserted with insertReserved
+    /// @param[in] numberOfChunks to reserve
+    /// @return the number of reserved entries, less than numberOfChunks if the list has not enough free entries
+    /// @note only from runtime context
+    uint32_t reserve(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Inserts a SharedChunk into an entry which was reserved before, therefore it cannot fail
+    /// @param[in] chunk to store in the list
+    /// @note only from runtime context
+    void insertReserved(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Releases reserved entries which were not used by insertReserved
+    /// @param[in] numberOfChunks the number of unused reserved entries
+    /// @note only from runtime context
+    void cancelReservation(const uint32_t numberOfChunks) noexcept;
+
     /// @brief Cleans up all the remaining chunks from the list.
     /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
     /// still running.
@@ -78,6 +96,8 @@ class UsedChunkList
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
     uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_size{0U};
+    uint32_t m_numberOfReservedEntries{0U};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
 };
@@ -38,7 +38,8 @@ UsedChunkList<Capacity>::UsedChunkList() noexcept
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 {
-    auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
+    // the reserved entries are kept free for insertReserved
+    auto hasFreeSpace = (m_size + m_numberOfReservedEntries < Capacity) && (m_freeListHead != INVALID_INDEX);
     if (hasFreeSpace)
     {
         // get next free entry after freelistHead
@@ -52,6 +53,7 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 
         // set freeListHead to the next free entry
         m_freeListHead = nextFree;
+        ++m_size;
 
         /// @todo can we do this cheaper with a global fence in cleanup?
         m_synchronizer.clear(std::memory_order_release);
@@ -91,6 +93,7 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
                 // insert index to free list
                 m_listIndices[current] = m_freeListHead;
                 m_freeListHead = current;
+                --m_size;
 
                 /// @todo can we do this cheaper with a global fence in cleanup?
                 m_synchronizer.clear(std::memory_order_release);
@@ -102,6 +105,32 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
     return false;
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::reserve(const uint32_t numberOfChunks) noexcept
+{
+    const uint32_t numberOfFreeEntries = Capacity - m_size - m_numberOfReservedEntries;
+    const uint32_t numberOfReservedEntries =
+        (numberOfChunks < numberOfFreeEntries) ? numberOfChunks : numberOfFreeEntries;
+    m_numberOfReservedEntries += numberOfReservedEntries;
+    return numberOfReservedEntries;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::insertReserved(mepoo::SharedChunk chunk) noexcept
+{
+    cxx::Expects(m_numberOfReservedEntries > 0U);
+    --m_numberOfReservedEntries;
+    // cannot fail since the entry was kept free by the reservation
+    IOX_DISCARD_RESULT(insert(chunk));
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::cancelReservation(const uint32_t numberOfChunks) noexcept
+{
+    cxx::Expects(numberOfChunks <= m_numberOfReservedEntries);
+    m_numberOfReservedEntries -= numberOfChunks;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -140,6 +169,8 @@ void UsedChunkList<Capacity>::init() noexcept
 
     m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
+    m_size = 0U;
+    m_numberOfReservedEntries = 0U;
 
     // clear data
     for (auto& data : m_listData)
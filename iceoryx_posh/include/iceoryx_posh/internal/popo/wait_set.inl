@@ -28,9 +28,16 @@ inline WaitSet<Capacity>::WaitSet() noexcept
 }
 
 template <uint64_t Capacity>
-inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
+inline WaitSet<Capacity>::WaitSet(const WaitOptions& waitOptions) noexcept
+    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitOptions)
+{
+}
+
+template <uint64_t Capacity>
+inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData, const WaitOptions& waitOptions) noexcept
     : m_conditionVariableDataPtr(&condVarData)
-    , m_conditionListener(condVarData)
+    , m_ioReactor(condVarData)
+    , m_conditionListener(condVarData, waitOptions, &m_ioReactor)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -42,6 +49,8 @@ template <uint64_t Capacity>
 inline WaitSet<Capacity>::~WaitSet() noexcept
 {
     removeAllTriggers();
+    // the file descriptor accesses the condition variable, which can be released as soon as it is marked
+    m_ioReactor.releaseConditionVariable();
     m_conditionVariableDataPtr->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -124,7 +133,7 @@ WaitSet<Capacity>::attachEvent(T& eventOrigin,
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
-                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId),
+                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId, &m_ioReactor),
                 eventType);
         });
 }
@@ -149,8 +158,11 @@ inline cxx::expected<WaitSetError> WaitSet<Capacity>::attachEvent(
                       static_cast<uint64_t>(NoEventEnumUsed::PLACEHOLDER),
                       typeid(NoEventEnumUsed).hash_code())
         .and_then([&](auto& uniqueId) {
-            NotificationAttorney::enableEvent(
-                eventOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
+            NotificationAttorney::enableEvent(eventOrigin,
+                                             TriggerHandle(*m_conditionVariableDataPtr,
+                                                           {*this, &WaitSet::removeTrigger},
+                                                           uniqueId,
+                                                           &m_ioReactor));
         });
 }
 
@@ -182,7 +194,7 @@ WaitSet<Capacity>::attachState(T& stateOrigin,
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableState(
                 stateOrigin,
-                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId),
+                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId, &m_ioReactor),
                 stateType);
         });
 }
@@ -208,8 +220,11 @@ inline cxx::expected<WaitSetError> WaitSet<Capacity>::attachState(
                       static_cast<uint64_t>(NoStateEnumUsed::PLACEHOLDER),
                       typeid(NoStateEnumUsed).hash_code())
         .and_then([&](auto& uniqueId) {
-            NotificationAttorney::enableState(
-                stateOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
+            NotificationAttorney::enableState(stateOrigin,
+                                             TriggerHandle(*m_conditionVariableDataPtr,
+                                                           {*this, &WaitSet::removeTrigger},
+                                                           uniqueId,
+                                                           &m_ioReactor));
         });
 }
 
@@ -272,6 +287,17 @@ inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wai
     return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.wait(); });
 }
 
+template <uint64_t Capacity>
+inline cxx::expected<int32_t, WaitSetError> WaitSet<Capacity>::getFileDescriptor() noexcept
+{
+    auto result = m_ioReactor.getFileDescriptor();
+    if (result.has_error())
+    {
+        return cxx::error<WaitSetError>(WaitSetError::UNABLE_TO_CREATE_FILE_DESCRIPTOR);
+    }
+    return cxx::success<int32_t>(result.value());
+}
+
 template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
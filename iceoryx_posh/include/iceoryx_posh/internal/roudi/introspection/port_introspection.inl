@@ -608,6 +608,13 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                     // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
                     // subscriberData.fifoSize = port.getDeliveryFiFoSize();
                     subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+
+                    const auto takeLatency =
+                        subscriberInfo.portData->m_chunkReceiverData.m_takeLatencyHistogram.snapshotAndReset();
+                    subscriberData.takeLatencySampleCount = takeLatency.numberOfSamples();
+                    subscriberData.takeLatencyP50InNs = takeLatency.percentile(50.0);
+                    subscriberData.takeLatencyP99InNs = takeLatency.percentile(99.0);
+                    subscriberData.takeLatencyMaxInNs = takeLatency.max();
                 }
                 else
                 {
@@ -139,6 +139,18 @@ class PortManager
 
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
+    /// @brief Destroys multiple publisher ports at once. The ports are processed in batches and the STOP_OFFER
+    /// messages of a batch are distributed with a single pass over the subscriber ports.
+    /// @param[in] publisherPortDataList publisher ports to destroy
+    void destroyPublisherPorts(
+        const cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>& publisherPortDataList) noexcept;
+
+    /// @brief Destroys multiple subscriber ports at once. The ports are processed in batches and the UNSUB messages of
+    /// a batch are distributed with a single pass over the publisher ports.
+    /// @param[in] subscriberPortDataList subscriber ports to destroy
+    void destroySubscriberPorts(
+        const cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>& subscriberPortDataList) noexcept;
+
     void handlePublisherPorts() noexcept;
 
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
@@ -176,6 +188,14 @@ class PortManager
     void sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                           PublisherPortRouDiType& publisherSource) noexcept;
 
+    void dispatchToPublisherPort(const capro::CaproMessage& message,
+                                 SubscriberPortType& subscriberSource,
+                                 PublisherPortRouDiType& publisherPort) noexcept;
+
+    void dispatchToSubscriberPort(const capro::CaproMessage& message,
+                                  PublisherPortRouDiType& publisherSource,
+                                  SubscriberPortType& subscriberPort) noexcept;
+
     bool isCompatibleClientServer(const popo::ServerPortRouDi& server,
                                   const popo::ClientPortRouDi& client) const noexcept;
 
@@ -17,8 +17,6 @@
 #ifndef IOX_POSH_ROUDI_PORT_POOL_DATA_HPP
 #define IOX_POSH_ROUDI_PORT_POOL_DATA_HPP
 
-#include "iceoryx_hoofs/cxx/optional.hpp"
-#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
@@ -28,17 +26,65 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 
+#include <cstdint>
+#include <limits>
+
 namespace iox
 {
 namespace roudi
 {
 /// @brief workaround container until we have a fixed list with the needed functionality
+/// @details The occupied slots are tracked with a bitmap. Iterating over the elements therefore skips empty regions
+/// word by word and erasing an element does not need to search for it. The position of an element does not change
+/// while it is stored in the container.
 template <typename T, uint64_t Capacity>
 class FixedPositionContainer
 {
   public:
     static constexpr uint64_t FIRST_ELEMENT = std::numeric_limits<uint64_t>::max();
 
+    /// @brief forward iterator over the occupied slots; dereferencing it returns a pointer to the element
+    /// @note erasing the element the iterator points to does not invalidate the iterator
+    class Iterator
+    {
+      public:
+        T* operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        bool operator==(const Iterator& rhs) const noexcept;
+        bool operator!=(const Iterator& rhs) const noexcept;
+
+      private:
+        friend class FixedPositionContainer;
+        Iterator(FixedPositionContainer* const container, const uint64_t index) noexcept;
+
+        FixedPositionContainer* m_container{nullptr};
+        uint64_t m_index{Capacity};
+    };
+
+    /// @brief a view of the occupied slots of the container, which can be used in a range based for loop without
+    /// copying the elements pointers
+    class Content
+    {
+      public:
+        Iterator begin() const noexcept;
+        Iterator end() const noexcept;
+        uint64_t size() const noexcept;
+        bool empty() const noexcept;
+
+      private:
+        friend class FixedPositionContainer;
+        explicit Content(FixedPositionContainer* const container) noexcept;
+
+        FixedPositionContainer* m_container{nullptr};
+    };
+
+    FixedPositionContainer() noexcept = default;
+    FixedPositionContainer(const FixedPositionContainer&) = delete;
+    FixedPositionContainer(FixedPositionContainer&&) = delete;
+    FixedPositionContainer& operator=(const FixedPositionContainer&) = delete;
+    FixedPositionContainer& operator=(FixedPositionContainer&&) = delete;
+    ~FixedPositionContainer() noexcept;
+
     bool hasFreeSpace() noexcept;
 
     template <typename... Targs>
@@ -46,10 +92,25 @@ class FixedPositionContainer
 
     void erase(const T* const element) noexcept;
 
-    cxx::vector<T*, Capacity> content() noexcept;
+    Content content() noexcept;
+
+    Iterator begin() noexcept;
+    Iterator end() noexcept;
+    uint64_t size() const noexcept;
+
+  private:
+    static constexpr uint64_t BITS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_WORDS{(Capacity + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+
+    static uint64_t indexOfLowestSetBit(uint64_t word) noexcept;
+    uint64_t nextOccupiedIndex(const uint64_t index) const noexcept;
+    T* elementAt(const uint64_t index) noexcept;
 
   private:
-    cxx::vector<cxx::optional<T>, Capacity> m_data;
+    using element_t = uint8_t[sizeof(T)];
+    alignas(T) element_t m_data[Capacity];
+    uint64_t m_occupiedSlots[NUMBER_OF_WORDS]{};
+    uint64_t m_size{0U};
 };
 
 struct PortPoolData
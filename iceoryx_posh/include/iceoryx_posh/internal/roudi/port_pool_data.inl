@@ -18,72 +18,242 @@
 
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 
+#include <new>
+#include <utility>
+
 namespace iox
 {
 namespace roudi
 {
 template <typename T, uint64_t Capacity>
-bool FixedPositionContainer<T, Capacity>::hasFreeSpace() noexcept
+constexpr uint64_t FixedPositionContainer<T, Capacity>::BITS_PER_WORD;
+
+template <typename T, uint64_t Capacity>
+constexpr uint64_t FixedPositionContainer<T, Capacity>::NUMBER_OF_WORDS;
+
+template <typename T, uint64_t Capacity>
+inline FixedPositionContainer<T, Capacity>::~FixedPositionContainer() noexcept
 {
-    if (m_data.capacity() > m_data.size())
+    for (auto element : *this)
     {
-        return true;
+        element->~T();
     }
+}
 
-    for (auto& e : m_data)
+template <typename T, uint64_t Capacity>
+inline bool FixedPositionContainer<T, Capacity>::hasFreeSpace() noexcept
+{
+    return m_size < Capacity;
+}
+
+template <typename T, uint64_t Capacity>
+template <typename... Targs>
+inline T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args) noexcept
+{
+    for (uint64_t word = 0U; word < NUMBER_OF_WORDS; ++word)
     {
-        if (!e.has_value())
+        const uint64_t freeSlots = ~m_occupiedSlots[word];
+        if (freeSlots == 0U)
         {
-            return true;
+            continue;
         }
+
+        const uint64_t index = word * BITS_PER_WORD + indexOfLowestSetBit(freeSlots);
+        if (index >= Capacity)
+        {
+            break;
+        }
+
+        m_occupiedSlots[word] |= 1ULL << (index % BITS_PER_WORD);
+        ++m_size;
+        return new (&m_data[index]) T(std::forward<Targs>(args)...);
     }
 
-    return false;
+    return nullptr;
 }
 
 template <typename T, uint64_t Capacity>
-template <typename... Targs>
-T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args) noexcept
+inline void FixedPositionContainer<T, Capacity>::erase(const T* const element) noexcept
 {
-    for (auto& e : m_data)
+    const auto address = reinterpret_cast<uint64_t>(element);
+    const auto begin = reinterpret_cast<uint64_t>(&m_data[0]);
+    if (address < begin || ((address - begin) % sizeof(T)) != 0U)
     {
-        if (!e.has_value())
-        {
-            e.emplace(std::forward<Targs>(args)...);
-            return &e.value();
-        }
+        return;
+    }
+
+    const uint64_t index = (address - begin) / sizeof(T);
+    if (index >= Capacity)
+    {
+        return;
+    }
+
+    const uint64_t slotMask = 1ULL << (index % BITS_PER_WORD);
+    if ((m_occupiedSlots[index / BITS_PER_WORD] & slotMask) == 0U)
+    {
+        return;
     }
 
-    m_data.emplace_back();
-    m_data.back().emplace(std::forward<Targs>(args)...);
-    return &m_data.back().value();
+    elementAt(index)->~T();
+    m_occupiedSlots[index / BITS_PER_WORD] &= ~slotMask;
+    --m_size;
 }
 
 template <typename T, uint64_t Capacity>
-void FixedPositionContainer<T, Capacity>::erase(const T* const element) noexcept
+inline typename FixedPositionContainer<T, Capacity>::Content FixedPositionContainer<T, Capacity>::content() noexcept
 {
-    for (auto& e : m_data)
+    return Content(this);
+}
+
+template <typename T, uint64_t Capacity>
+inline typename FixedPositionContainer<T, Capacity>::Iterator FixedPositionContainer<T, Capacity>::begin() noexcept
+{
+    return Iterator(this, nextOccupiedIndex(0U));
+}
+
+template <typename T, uint64_t Capacity>
+inline typename FixedPositionContainer<T, Capacity>::Iterator FixedPositionContainer<T, Capacity>::end() noexcept
+{
+    return Iterator(this, Capacity);
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t FixedPositionContainer<T, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t FixedPositionContainer<T, Capacity>::indexOfLowestSetBit(uint64_t word) noexcept
+{
+    // binary search instead of a compiler intrinsic to stay portable
+    uint64_t index{0U};
+    if ((word & 0xFFFFFFFFULL) == 0U)
     {
-        if (e.has_value() && &e.value() == element)
-        {
-            e.reset();
-            return;
-        }
+        index += 32U;
+        word >>= 32U;
+    }
+    if ((word & 0xFFFFULL) == 0U)
+    {
+        index += 16U;
+        word >>= 16U;
+    }
+    if ((word & 0xFFULL) == 0U)
+    {
+        index += 8U;
+        word >>= 8U;
+    }
+    if ((word & 0xFULL) == 0U)
+    {
+        index += 4U;
+        word >>= 4U;
+    }
+    if ((word & 0x3ULL) == 0U)
+    {
+        index += 2U;
+        word >>= 2U;
+    }
+    if ((word & 0x1ULL) == 0U)
+    {
+        index += 1U;
     }
+    return index;
 }
 
 template <typename T, uint64_t Capacity>
-cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content() noexcept
+inline uint64_t FixedPositionContainer<T, Capacity>::nextOccupiedIndex(const uint64_t index) const noexcept
 {
-    cxx::vector<T*, Capacity> returnValue;
-    for (auto& e : m_data)
+    if (index >= Capacity)
     {
-        if (e.has_value())
+        return Capacity;
+    }
+
+    uint64_t word = index / BITS_PER_WORD;
+    // mask out the slots before the index
+    uint64_t occupiedSlots = m_occupiedSlots[word] & (~0ULL << (index % BITS_PER_WORD));
+    while (occupiedSlots == 0U)
+    {
+        ++word;
+        if (word >= NUMBER_OF_WORDS)
         {
-            returnValue.emplace_back(&e.value());
+            return Capacity;
         }
+        occupiedSlots = m_occupiedSlots[word];
     }
-    return returnValue;
+
+    return word * BITS_PER_WORD + indexOfLowestSetBit(occupiedSlots);
+}
+
+template <typename T, uint64_t Capacity>
+inline T* FixedPositionContainer<T, Capacity>::elementAt(const uint64_t index) noexcept
+{
+    return reinterpret_cast<T*>(&m_data[index]);
+}
+
+template <typename T, uint64_t Capacity>
+inline FixedPositionContainer<T, Capacity>::Iterator::Iterator(FixedPositionContainer* const container,
+                                                               const uint64_t index) noexcept
+    : m_container(container)
+    , m_index(index)
+{
+}
+
+template <typename T, uint64_t Capacity>
+inline T* FixedPositionContainer<T, Capacity>::Iterator::operator*() const noexcept
+{
+    return m_container->elementAt(m_index);
+}
+
+template <typename T, uint64_t Capacity>
+inline typename FixedPositionContainer<T, Capacity>::Iterator&
+FixedPositionContainer<T, Capacity>::Iterator::operator++() noexcept
+{
+    m_index = m_container->nextOccupiedIndex(m_index + 1U);
+    return *this;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool FixedPositionContainer<T, Capacity>::Iterator::operator==(const Iterator& rhs) const noexcept
+{
+    return m_container == rhs.m_container && m_index == rhs.m_index;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool FixedPositionContainer<T, Capacity>::Iterator::operator!=(const Iterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename T, uint64_t Capacity>
+inline FixedPositionContainer<T, Capacity>::Content::Content(FixedPositionContainer* const container) noexcept
+    : m_container(container)
+{
+}
+
+template <typename T, uint64_t Capacity>
+inline typename FixedPositionContainer<T, Capacity>::Iterator
+FixedPositionContainer<T, Capacity>::Content::begin() const noexcept
+{
+    return m_container->begin();
+}
+
+template <typename T, uint64_t Capacity>
+inline typename FixedPositionContainer<T, Capacity>::Iterator
+FixedPositionContainer<T, Capacity>::Content::end() const noexcept
+{
+    return m_container->end();
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t FixedPositionContainer<T, Capacity>::Content::size() const noexcept
+{
+    return m_container->size();
+}
+
+template <typename T, uint64_t Capacity>
+inline bool FixedPositionContainer<T, Capacity>::Content::empty() const noexcept
+{
+    return m_container->size() == 0U;
 }
 
 } // namespace roudi
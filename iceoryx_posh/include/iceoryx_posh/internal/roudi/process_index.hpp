@@ -0,0 +1,88 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_PROCESS_INDEX_HPP
+#define IOX_POSH_ROUDI_PROCESS_INDEX_HPP
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_hash.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The ProcessIndex maps the name of a registered process to its Process object. It is a hash table with open
+/// addressing and linear probing, which is sized to have a load factor below 0.5 with MAX_PROCESS_NUMBER processes.
+/// This gives a constant lookup time for the process name which is contained in every runtime message, instead of a
+/// linear search through the process list.
+/// @note the ProcessIndex does not own the Process objects and is not thread-safe
+class ProcessIndex
+{
+  public:
+    /// @brief the number of buckets; a power of two to map the hash to a bucket with a mask
+    static constexpr uint32_t CAPACITY{internal::nextPowerOfTwo(2U * MAX_PROCESS_NUMBER)};
+
+    ProcessIndex() noexcept = default;
+
+    ProcessIndex(const ProcessIndex&) = delete;
+    ProcessIndex(ProcessIndex&&) = delete;
+    ProcessIndex& operator=(const ProcessIndex&) = delete;
+    ProcessIndex& operator=(ProcessIndex&&) = delete;
+    ~ProcessIndex() noexcept = default;
+
+    /// @brief Adds a process to the index
+    /// @param[in] process to add; the pointer must stay valid until the process is removed from the index
+    /// @return false if a process with the same name is already contained or there are already MAX_PROCESS_NUMBER
+    /// processes in the index, true otherwise
+    bool insert(Process* const process) noexcept;
+
+    /// @brief Looks up a process by its name
+    /// @param[in] name of the process
+    /// @return the process if it is contained in the index, cxx::nullopt otherwise
+    cxx::optional<Process*> find(const RuntimeName_t& name) const noexcept;
+
+    /// @brief Removes a process from the index
+    /// @param[in] name of the process
+    /// @return true if the process was contained in the index, false otherwise
+    bool remove(const RuntimeName_t& name) noexcept;
+
+    /// @brief Removes all processes from the index
+    void clear() noexcept;
+
+    /// @brief Returns the number of processes in the index
+    uint32_t size() const noexcept;
+
+  private:
+    static uint32_t bucketOf(const RuntimeName_t& name) noexcept;
+    static uint32_t nextBucket(const uint32_t bucket) noexcept;
+    cxx::optional<uint32_t> findBucket(const RuntimeName_t& name) const noexcept;
+
+  private:
+    static_assert(cxx::isPowerOfTwo(CAPACITY), "the ProcessIndex capacity must be a power of two");
+    static_assert(CAPACITY > MAX_PROCESS_NUMBER, "the ProcessIndex needs at least one empty bucket");
+
+    Process* m_buckets[CAPACITY]{};
+    uint32_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_INDEX_HPP
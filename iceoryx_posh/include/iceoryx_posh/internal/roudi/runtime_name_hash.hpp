@@ -0,0 +1,60 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_NAME_HASH_HPP
+#define IOX_POSH_ROUDI_RUNTIME_NAME_HASH_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+namespace internal
+{
+/// @brief Calculates the smallest power of two which is not smaller than the provided value
+constexpr uint32_t nextPowerOfTwo(const uint32_t value) noexcept
+{
+    uint32_t powerOfTwo{1U};
+    while (powerOfTwo < value)
+    {
+        powerOfTwo <<= 1U;
+    }
+    return powerOfTwo;
+}
+
+/// @brief Calculates the FNV-1a hash of a runtime name, which is used by the RouDi lookup tables for runtime names
+inline uint32_t hashRuntimeName(const RuntimeName_t& name) noexcept
+{
+    constexpr uint32_t FNV_OFFSET_BASIS{2166136261U};
+    constexpr uint32_t FNV_PRIME{16777619U};
+
+    uint32_t hashValue{FNV_OFFSET_BASIS};
+    const auto* const characters = name.c_str();
+    for (uint64_t i = 0U; i < name.size(); ++i)
+    {
+        hashValue ^= static_cast<uint8_t>(characters[i]);
+        hashValue *= FNV_PRIME;
+    }
+    return hashValue;
+}
+} // namespace internal
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RUNTIME_NAME_HASH_HPP
@@ -0,0 +1,112 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_HPP
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_hash.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The RuntimePortIndex groups the ports of the PortPool by the runtime which owns them. It is a hash table with
+/// open addressing and linear probing which is keyed by the hash of the runtime name and has one bucket per runtime.
+/// Each bucket holds a singly linked list of the ports of its runtime. The probe sequences therefore only grow with the
+/// number of runtimes and not with the number of ports, and all ports of a runtime are collected without iterating
+/// over the ports of all other runtimes.
+/// @tparam T the port data type; it must have a m_runtimeName member, which must not change while the port is indexed
+/// @tparam Capacity the maximum number of ports
+/// @note the RuntimePortIndex does not own the ports and is not thread-safe
+template <typename T, uint64_t Capacity>
+class RuntimePortIndex
+{
+  public:
+    /// @brief the number of buckets; a power of two with a load factor below 0.5 when every port belongs to a
+    /// different runtime
+    static constexpr uint32_t NUMBER_OF_BUCKETS{internal::nextPowerOfTwo(static_cast<uint32_t>(2U * Capacity))};
+
+    RuntimePortIndex() noexcept;
+
+    RuntimePortIndex(const RuntimePortIndex&) = delete;
+    RuntimePortIndex(RuntimePortIndex&&) = delete;
+    RuntimePortIndex& operator=(const RuntimePortIndex&) = delete;
+    RuntimePortIndex& operator=(RuntimePortIndex&&) = delete;
+    ~RuntimePortIndex() noexcept = default;
+
+    /// @brief Adds a port to the index
+    /// @param[in] port to add; the pointer must stay valid until the port is removed from the index
+    /// @return false if the port is a nullptr or there are already Capacity ports in the index, true otherwise
+    bool insert(T* const port) noexcept;
+
+    /// @brief Removes a port from the index
+    /// @param[in] port to remove
+    /// @return true if the port was contained in the index, false otherwise
+    bool remove(const T* const port) noexcept;
+
+    /// @brief Collects all ports of a runtime in the order in which they were inserted
+    /// @param[in] runtimeName of the runtime which owns the ports
+    /// @return the ports of the runtime
+    cxx::vector<T*, Capacity> portsOf(const RuntimeName_t& runtimeName) const noexcept;
+
+    /// @brief Returns the number of ports in the index
+    uint64_t size() const noexcept;
+
+  private:
+    static constexpr uint32_t INVALID_NODE{static_cast<uint32_t>(Capacity)};
+
+    struct Node
+    {
+        T* port{nullptr};
+        uint32_t next{INVALID_NODE};
+    };
+
+    /// @brief the bucket of a runtime; it is empty if it has no ports
+    struct Bucket
+    {
+        uint32_t runtimeNameHash{0U};
+        uint32_t head{INVALID_NODE};
+        uint32_t tail{INVALID_NODE};
+    };
+
+    /// @brief Returns the bucket of the runtime or the empty bucket which terminates its probe sequence
+    uint32_t findBucket(const uint32_t runtimeNameHash, const RuntimeName_t& runtimeName) const noexcept;
+    void eraseBucket(uint32_t gap) noexcept;
+
+    static uint32_t bucketOf(const uint32_t runtimeNameHash) noexcept;
+    static uint32_t nextBucket(const uint32_t bucket) noexcept;
+
+  private:
+    static_assert(Capacity <= (1ULL << 30U), "the RuntimePortIndex capacity is too large");
+    static_assert(NUMBER_OF_BUCKETS > Capacity, "the RuntimePortIndex needs at least one empty bucket");
+
+    Bucket m_buckets[NUMBER_OF_BUCKETS];
+    Node m_nodes[Capacity];
+    uint32_t m_freeNodes{0U};
+    uint64_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/runtime_port_index.inl"
+
+#endif // IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_HPP
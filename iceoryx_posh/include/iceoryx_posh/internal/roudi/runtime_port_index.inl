@@ -0,0 +1,193 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/runtime_port_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity>
+constexpr uint32_t RuntimePortIndex<T, Capacity>::NUMBER_OF_BUCKETS;
+
+template <typename T, uint64_t Capacity>
+constexpr uint32_t RuntimePortIndex<T, Capacity>::INVALID_NODE;
+
+template <typename T, uint64_t Capacity>
+inline RuntimePortIndex<T, Capacity>::RuntimePortIndex() noexcept
+{
+    for (uint32_t node = 0U; node < INVALID_NODE; ++node)
+    {
+        m_nodes[node].next = node + 1U;
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline bool RuntimePortIndex<T, Capacity>::insert(T* const port) noexcept
+{
+    if (port == nullptr || m_freeNodes == INVALID_NODE)
+    {
+        return false;
+    }
+
+    const auto runtimeNameHash = internal::hashRuntimeName(port->m_runtimeName);
+    auto& bucket = m_buckets[findBucket(runtimeNameHash, port->m_runtimeName)];
+
+    const auto node = m_freeNodes;
+    m_freeNodes = m_nodes[node].next;
+    m_nodes[node].port = port;
+    m_nodes[node].next = INVALID_NODE;
+
+    if (bucket.head == INVALID_NODE)
+    {
+        bucket.runtimeNameHash = runtimeNameHash;
+        bucket.head = node;
+    }
+    else
+    {
+        m_nodes[bucket.tail].next = node;
+    }
+    bucket.tail = node;
+
+    ++m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool RuntimePortIndex<T, Capacity>::remove(const T* const port) noexcept
+{
+    if (port == nullptr)
+    {
+        return false;
+    }
+
+    const auto bucketIndex = findBucket(internal::hashRuntimeName(port->m_runtimeName), port->m_runtimeName);
+    auto& bucket = m_buckets[bucketIndex];
+
+    auto previous = INVALID_NODE;
+    auto node = bucket.head;
+    while (node != INVALID_NODE && m_nodes[node].port != port)
+    {
+        previous = node;
+        node = m_nodes[node].next;
+    }
+    if (node == INVALID_NODE)
+    {
+        return false;
+    }
+
+    if (previous == INVALID_NODE)
+    {
+        bucket.head = m_nodes[node].next;
+    }
+    else
+    {
+        m_nodes[previous].next = m_nodes[node].next;
+    }
+    if (bucket.tail == node)
+    {
+        bucket.tail = previous;
+    }
+
+    m_nodes[node] = Node();
+    m_nodes[node].next = m_freeNodes;
+    m_freeNodes = node;
+
+    if (bucket.head == INVALID_NODE)
+    {
+        eraseBucket(bucketIndex);
+    }
+
+    --m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+inline cxx::vector<T*, Capacity> RuntimePortIndex<T, Capacity>::portsOf(const RuntimeName_t& runtimeName) const
+    noexcept
+{
+    cxx::vector<T*, Capacity> ports;
+
+    const auto& bucket = m_buckets[findBucket(internal::hashRuntimeName(runtimeName), runtimeName)];
+    for (auto node = bucket.head; node != INVALID_NODE; node = m_nodes[node].next)
+    {
+        ports.emplace_back(m_nodes[node].port);
+    }
+
+    return ports;
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t RuntimePortIndex<T, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T, uint64_t Capacity>
+inline uint32_t RuntimePortIndex<T, Capacity>::findBucket(const uint32_t runtimeNameHash,
+                                                          const RuntimeName_t& runtimeName) const noexcept
+{
+    auto bucket = bucketOf(runtimeNameHash);
+    while (m_buckets[bucket].head != INVALID_NODE)
+    {
+        const auto& entry = m_buckets[bucket];
+        if (entry.runtimeNameHash == runtimeNameHash && m_nodes[entry.head].port->m_runtimeName == runtimeName)
+        {
+            break;
+        }
+        bucket = nextBucket(bucket);
+    }
+    return bucket;
+}
+
+template <typename T, uint64_t Capacity>
+inline void RuntimePortIndex<T, Capacity>::eraseBucket(uint32_t gap) noexcept
+{
+    // backward shift deletion, like in the ProcessIndex; no tombstones are needed to keep the probe sequences intact
+    m_buckets[gap] = Bucket();
+    for (auto bucket = nextBucket(gap); m_buckets[bucket].head != INVALID_NODE; bucket = nextBucket(bucket))
+    {
+        const auto homeBucket = bucketOf(m_buckets[bucket].runtimeNameHash);
+        const auto distanceToHome = (bucket - homeBucket) & (NUMBER_OF_BUCKETS - 1U);
+        const auto distanceToGap = (bucket - gap) & (NUMBER_OF_BUCKETS - 1U);
+        if (distanceToHome >= distanceToGap)
+        {
+            m_buckets[gap] = m_buckets[bucket];
+            m_buckets[bucket] = Bucket();
+            gap = bucket;
+        }
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline uint32_t RuntimePortIndex<T, Capacity>::bucketOf(const uint32_t runtimeNameHash) noexcept
+{
+    return runtimeNameHash & (NUMBER_OF_BUCKETS - 1U);
+}
+
+template <typename T, uint64_t Capacity>
+inline uint32_t RuntimePortIndex<T, Capacity>::nextBucket(const uint32_t bucket) noexcept
+{
+    return (bucket + 1U) & (NUMBER_OF_BUCKETS - 1U);
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_INL
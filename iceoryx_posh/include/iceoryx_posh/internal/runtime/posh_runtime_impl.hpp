@@ -104,6 +104,9 @@ class PoshRuntimeImpl : public PoshRuntime
     cxx::expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    /// @brief enables the popo::ChunkTrace when the environment variable CHUNK_TRACE_CAPACITY_ENV_VARIABLE is set
+    void enableChunkTraceFromEnvironment() noexcept;
+
     mutable posix::mutex m_appIpcRequestMutex{false};
 
     IpcRuntimeInterface m_ipcChannelInterface;
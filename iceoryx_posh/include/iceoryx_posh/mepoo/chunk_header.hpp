@@ -59,13 +59,16 @@ struct ChunkHeader
     ///            - data width of members changes
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
-    static constexpr uint8_t CHUNK_HEADER_VERSION{1U};
+    static constexpr uint8_t CHUNK_HEADER_VERSION{2U};
 
     /// @brief User-Header id for no user-header
     static constexpr uint16_t NO_USER_HEADER{0x0000};
     /// @brief User-Header id for an unknown user-header
     static constexpr uint16_t UNKNOWN_USER_HEADER{0xFFFF};
 
+    /// @brief Publish timestamp of a chunk from a publisher which does not stamp its chunks
+    static constexpr uint64_t NO_PUBLISH_TIMESTAMP{0U};
+
     /// @brief The ChunkHeader version is used to detect incompatibilities for record&replay functionality
     /// @return the ChunkHeader version
     uint8_t chunkHeaderVersion() const noexcept;
@@ -138,6 +141,11 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The time in nanoseconds of the steady clock when the chunk was published; only set if the publisher
+    /// was created with PublisherOptions::stampPublishTimestamp
+    /// @return the publish timestamp or NO_PUBLISH_TIMESTAMP
+    uint64_t publishTimestamp() const noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
@@ -146,6 +154,8 @@ struct ChunkHeader
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setPublishTimestamp(const uint64_t publishTimestamp) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -163,6 +173,7 @@ struct ChunkHeader
     uint16_t m_userHeaderId{NO_USER_HEADER};
     popo::UniquePortId m_originId{popo::InvalidPortId};
     uint64_t m_sequenceNumber{0U};
+    uint64_t m_publishTimestamp{NO_PUBLISH_TIMESTAMP};
     uint32_t m_userHeaderSize{0U};
     uint32_t m_userPayloadSize{0U};
     uint32_t m_userPayloadAlignment{1U};
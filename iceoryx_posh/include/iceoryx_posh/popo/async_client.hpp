@@ -0,0 +1,58 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_HPP
+#define IOX_POSH_POPO_ASYNC_CLIENT_HPP
+
+#include "iceoryx_posh/internal/popo/async_client_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The AsyncClient class for the request-response messaging pattern in iceoryx. Multiple requests can be in
+/// flight and each response is dispatched to the callback which was registered with the request.
+/// @param[in] Req type of request data
+/// @param[in] Res type of response data
+/// @code
+/// listener.attachEvent(client,
+///                      iox::popo::ClientEvent::RESPONSE_RECEIVED,
+///                      iox::popo::createNotificationCallback(AsyncClient<Req, Res>::onResponseReceived));
+/// @endcode
+template <typename Req, typename Res>
+class AsyncClient : public AsyncClientImpl<Req, Res>
+{
+    using Impl = AsyncClientImpl<Req, Res>;
+
+  public:
+    using AsyncClientImpl<Req, Res>::AsyncClientImpl;
+
+    virtual ~AsyncClient() noexcept
+    {
+        Impl::m_trigger.reset();
+    }
+
+    /// @brief Callback for the ClientEvent::RESPONSE_RECEIVED of a Listener which dispatches all received responses
+    /// @param[in] self the client which received the responses
+    static void onResponseReceived(AsyncClient* const self) noexcept
+    {
+        self->dispatchResponses();
+    }
+};
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_HPP
@@ -33,7 +33,7 @@ struct ClientOptions
 {
     /// @brief The size of the response queue where chunks are stored before they are passed to the user
     /// @attention Depending on the underlying queue there can be a different overflow behavior
-    uint64_t responseQueueCapacity{ClientChunkQueueData_t::MAX_CAPACITY};
+    uint64_t responseQueueCapacity{DEFAULT_RESPONSE_QUEUE_CAPACITY};
 
     /// @brief The name of the node where the client should belong to
     iox::NodeName_t nodeName{""};
@@ -49,6 +49,13 @@ struct ClientOptions
     /// @note Corresponds with ServerOptions::requestQueueFullPolicy
     ConsumerTooSlowPolicy serverTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The maximum number of requests an AsyncClient keeps in flight, i.e. sent but not yet answered
+    /// @note Values above MAX_REQUESTS_IN_FLIGHT_PER_CLIENT are clamped; the AsyncClient raises the
+    /// responseQueueCapacity to this value if it is smaller, but not above MAX_RESPONSE_QUEUE_CAPACITY. With more
+    /// requests in flight than the response queue holds, the responses have to be dispatched promptly or the
+    /// responseQueueFullPolicy has to be BLOCK_PRODUCER, otherwise the requests of discarded responses expire
+    uint64_t maxRequestsInFlight{DEFAULT_RESPONSE_QUEUE_CAPACITY};
+
     /// @brief serialization of the ClientOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the ClientOptions
@@ -0,0 +1,120 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_FILE_DESCRIPTOR_TRIGGER_HPP
+#define IOX_POSH_POPO_FILE_DESCRIPTOR_TRIGGER_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/popo/io_reactor.hpp"
+#include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief FileDescriptorTrigger events which can be attached to a WaitSet or a Listener
+enum class FileDescriptorEvent : EventEnumIdentifier
+{
+    /// @brief the file descriptor became readable or new data arrived
+    READABLE,
+    /// @brief the file descriptor became writable
+    WRITABLE
+};
+
+/// @brief FileDescriptorTrigger states which can be attached to a WaitSet
+enum class FileDescriptorState : StateEnumIdentifier
+{
+    /// @brief the file descriptor is readable
+    READABLE,
+    /// @brief the file descriptor is writable
+    WRITABLE
+};
+
+/// @brief The FileDescriptorTrigger makes a file descriptor, like a socket, a pipe, an eventfd or a timerfd,
+/// attachable to a WaitSet or a Listener. A single thread can then wait for iceoryx events and the file descriptor
+/// together and handle the data of the file descriptor directly. Attaching it without an enum attaches
+/// FileDescriptorEvent::READABLE or FileDescriptorState::READABLE.
+/// @code
+///   popo::FileDescriptorTrigger socketTrigger(socketFd);
+///   waitset.attachState(socketTrigger, popo::FileDescriptorState::READABLE);
+///   waitset.attachState(subscriber, popo::SubscriberState::HAS_DATA);
+/// @endcode
+/// @note The trigger does not take the ownership of the file descriptor. The file descriptor must stay open while
+/// the trigger is attached. The file descriptor is watched edge triggered, an attached event is notified when the
+/// file descriptor becomes ready or new data arrives, not while data is left to be read. The file descriptor is
+/// watched by the thread which waits in the WaitSet or Listener, no additional thread is involved. A file descriptor
+/// can be watched by multiple FileDescriptorTrigger, e.g. one for READABLE and one for WRITABLE. Only available on
+/// Linux.
+class FileDescriptorTrigger
+{
+  public:
+    /// @param[in] fileDescriptor which is watched while the trigger is attached
+    explicit FileDescriptorTrigger(const int32_t fileDescriptor) noexcept;
+    FileDescriptorTrigger(const FileDescriptorTrigger&) = delete;
+    FileDescriptorTrigger(FileDescriptorTrigger&&) = delete;
+    FileDescriptorTrigger& operator=(const FileDescriptorTrigger&) = delete;
+    FileDescriptorTrigger& operator=(FileDescriptorTrigger&&) = delete;
+    ~FileDescriptorTrigger() noexcept;
+
+    int32_t getFileDescriptor() const noexcept;
+
+    /// @brief checks without blocking whether the file descriptor is readable
+    bool isReadable() const noexcept;
+
+    /// @brief checks without blocking whether the file descriptor is writable
+    bool isWritable() const noexcept;
+
+    /// @brief Checks if the FileDescriptorTrigger was triggered
+    /// @return true if the trigger notified its WaitSet/Listener and the notification was not yet handled
+    bool hasTriggered() const noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    void enableEvent(TriggerHandle&& triggerHandle) noexcept;
+    void enableEvent(TriggerHandle&& triggerHandle, const FileDescriptorEvent fileDescriptorEvent) noexcept;
+    void disableEvent() noexcept;
+    void disableEvent(const FileDescriptorEvent fileDescriptorEvent) noexcept;
+
+    void enableState(TriggerHandle&& triggerHandle) noexcept;
+    void enableState(TriggerHandle&& triggerHandle, const FileDescriptorState fileDescriptorState) noexcept;
+    void disableState() noexcept;
+    void disableState(const FileDescriptorState fileDescriptorState) noexcept;
+
+    WaitSetIsConditionSatisfiedCallback getCallbackForIsStateConditionSatisfied() const noexcept;
+    WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const FileDescriptorState fileDescriptorState) const noexcept;
+
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    void attach(TriggerHandle&& triggerHandle, const IoReactor::Readiness readiness) noexcept;
+    void unwatch() noexcept;
+    void detach() noexcept;
+    void notify() noexcept;
+
+  private:
+    int32_t m_fileDescriptor{-1};
+    TriggerHandle m_trigger;
+    IoReactor* m_ioReactor{nullptr};
+    cxx::optional<uint64_t> m_watchId;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_FILE_DESCRIPTOR_TRIGGER_HPP
@@ -27,6 +27,7 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 #include <thread>
@@ -105,6 +106,10 @@ class ListenerImpl
 {
   public:
     ListenerImpl() noexcept;
+
+    /// @brief Creates a Listener whose background thread waits according to the provided options
+    /// @param[in] waitOptions defines whether the background thread blocks, busy polls or polls before blocking
+    explicit ListenerImpl(const WaitOptions& waitOptions) noexcept;
     ListenerImpl(const ListenerImpl&) = delete;
     ListenerImpl(ListenerImpl&&) = delete;
     ~ListenerImpl() noexcept;
@@ -170,7 +175,7 @@ class ListenerImpl
     uint64_t size() const noexcept;
 
   protected:
-    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData, const WaitOptions& waitOptions = {}) noexcept;
 
   private:
     class Event_t;
@@ -209,6 +214,8 @@ class ListenerImpl
     } m_indexManager;
 
 
+    /// @brief declared before the events, which stop watching their file descriptors when they are destroyed
+    IoReactor m_ioReactor;
     std::thread m_thread;
     concurrent::smart_lock<internal::Event_t, std::recursive_mutex> m_events[Capacity];
     std::mutex m_addEventMutex;
@@ -223,9 +230,10 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
   public:
     using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     Listener() noexcept;
+    explicit Listener(const WaitOptions& waitOptions) noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const WaitOptions& waitOptions = {}) noexcept;
 };
 
 } // namespace popo
@@ -41,6 +41,19 @@ enum class QueueFullPolicy : uint8_t
     DISCARD_OLDEST_DATA
 };
 
+/// @brief Used by consumers to request how often the producer notifies them about new data
+enum class QueueNotificationPolicy : uint8_t
+{
+    /// Requests a notification for every chunk which is pushed into the queue
+    ON_EVERY_CHUNK,
+    /// Requests a notification only for the first chunk after the consumer has taken all chunks from the queue
+    ON_EMPTY_TO_NON_EMPTY,
+    /// Requests a notification only when a number of chunks were pushed since the last notification
+    AFTER_NUMBER_OF_CHUNKS,
+    /// Requests a notification only when a minimum interval has passed since the last notification
+    AFTER_MIN_INTERVAL
+};
+
 } // namespace popo
 } // namespace iox
 #endif // IOX_POSH_POPO_PORT_QUEUE_POLICIES_HPP
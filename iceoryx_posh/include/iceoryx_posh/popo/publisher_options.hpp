@@ -21,6 +21,7 @@
 #include "port_queue_policies.hpp"
 
 #include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 
 #include <cstdint>
 
@@ -28,6 +29,20 @@ namespace iox
 {
 namespace popo
 {
+/// @brief Used by publishers to select whether small samples are copied into the subscriber queues instead of being
+/// transferred by a chunk from the mempools
+enum class InlineSamplePolicy : uint8_t
+{
+    /// Samples are always transferred by a chunk from the mempools
+    DISABLED,
+    /// Samples without user-header and a user-payload of at most MAX_INLINE_USER_PAYLOAD_SIZE are copied into the
+    /// subscriber queues; this is only possible for publishers without history
+    ENABLED,
+    /// A typed publisher enables inline samples if the sample type and the options allow it, for all other publishers
+    /// this is equal to DISABLED
+    AUTOMATIC
+};
+
 /// @brief This struct is used to configure the publisher
 struct PublisherOptions
 {
@@ -43,6 +58,22 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The maximum time the publisher blocks on a full subscriber queue with
+    /// ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER; afterwards the sample is lost for this subscriber
+    units::Duration waitForConsumerTimeout{units::Duration::max()};
+
+    /// @brief The option whether small samples should be copied into the subscriber queues
+    /// @note inline samples are opt-in since the inline queue of a subscriber holds at most
+    /// MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY samples and the subscriber can hold at most
+    /// MAX_INLINE_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY inline samples at the same time; the inline queue is only
+    /// available if iceoryx is built with IOX_MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY larger than 0, otherwise all
+    /// samples are transferred by chunks from the mempools
+    InlineSamplePolicy inlineSamplePolicy{InlineSamplePolicy::DISABLED};
+
+    /// @brief The option whether the publisher stamps the publish time into the ChunkHeader; the subscribers use it to
+    /// record the latency from publish to take, which is shown by the port introspection
+    bool stampPublishTimestamp{false};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
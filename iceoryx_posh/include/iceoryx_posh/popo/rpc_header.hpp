@@ -81,6 +81,7 @@ class RpcBaseHeader
     /// @return the const pointer to the user-payload
     const void* getUserPayload() const noexcept;
 
+    friend class ClientPortUser;
     friend class ServerPortUser;
 
   protected:
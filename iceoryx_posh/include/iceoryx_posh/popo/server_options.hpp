@@ -49,6 +49,12 @@ struct ServerOptions
     /// @note Corresponds with ClientOptions::responseQueueFullPolicy
     ConsumerTooSlowPolicy clientTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The maximum number of requests the server can hold simultaneously, e.g. distributed over multiple
+    /// threads which take requests concurrently. One additional request can be taken but then a request must be
+    /// released before the next one can be taken.
+    /// @note Values larger than MAX_REQUESTS_IN_FLIGHT_PER_SERVER are reduced to MAX_REQUESTS_IN_FLIGHT_PER_SERVER
+    uint64_t maxRequestsInFlight{MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY};
+
     /// @brief serialization of the ServerOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the ServerOptions
@@ -21,6 +21,7 @@
 #include "port_queue_policies.hpp"
 
 #include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 
 #include <cstdint>
 
@@ -51,6 +52,24 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The policy which defines when the publisher notifies an attached WaitSet or Listener about new data. The
+    /// publisher skips the notifications which are not due and therefore avoids the wakeup of the subscriber.
+    /// @attention With every policy except QueueNotificationPolicy::ON_EVERY_CHUNK the subscriber must take all chunks
+    /// when it is notified. With QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS and
+    /// QueueNotificationPolicy::AFTER_MIN_INTERVAL the last chunks of a burst are notified after maxNotificationDelay
+    /// respectively minNotificationInterval while a thread waits on the WaitSet or the Listener
+    QueueNotificationPolicy notificationPolicy{QueueNotificationPolicy::ON_EVERY_CHUNK};
+
+    /// @brief The number of chunks which lead to a notification with QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS
+    uint64_t notificationThreshold{1U};
+
+    /// @brief The minimum interval between two notifications with QueueNotificationPolicy::AFTER_MIN_INTERVAL
+    units::Duration minNotificationInterval{units::Duration::fromNanoseconds(0U)};
+
+    /// @brief The maximum time a chunk waits for its notification with QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS
+    /// when the notificationThreshold is not reached
+    units::Duration maxNotificationDelay{DEFAULT_MAX_NOTIFICATION_DELAY};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
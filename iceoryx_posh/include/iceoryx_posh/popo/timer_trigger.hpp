@@ -0,0 +1,111 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_TIMER_TRIGGER_HPP
+#define IOX_POSH_POPO_TIMER_TRIGGER_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class TimerMode : uint8_t
+{
+    /// @brief the timer expires once after the interval
+    ONE_SHOT,
+    /// @brief the timer expires after every interval until it is stopped
+    PERIODIC
+};
+
+enum class TimerTriggerError
+{
+    NOT_SUPPORTED,
+    UNABLE_TO_CREATE_TIMER,
+    INVALID_INTERVAL,
+};
+
+/// @brief The TimerTrigger is a one-shot or periodic timer which can be attached as event to a WaitSet or a Listener.
+/// It notifies on every expiration, so that a single thread can handle iceoryx events and timed work together.
+/// @code
+///   popo::TimerTrigger timer(100_ms);
+///   waitset.attachEvent(timer);
+///   timer.start();
+/// @endcode
+/// @note The timer is based on the monotonic clock. Expirations which happen while the last notification was not
+/// yet handled are counted and returned by takeExpirations. The timer is watched by the thread which waits in the
+/// WaitSet or Listener, no additional thread is involved. Only available on Linux.
+class TimerTrigger
+{
+  public:
+    /// @brief creates a stopped timer
+    /// @param[in] interval after which the timer expires; must be greater than zero
+    /// @param[in] mode whether the timer expires once or periodically
+    explicit TimerTrigger(const units::Duration interval, const TimerMode mode = TimerMode::PERIODIC) noexcept;
+    TimerTrigger(const TimerTrigger&) = delete;
+    TimerTrigger(TimerTrigger&&) = delete;
+    TimerTrigger& operator=(const TimerTrigger&) = delete;
+    TimerTrigger& operator=(TimerTrigger&&) = delete;
+    ~TimerTrigger() noexcept;
+
+    /// @brief starts the timer or restarts it if it is already running; the first expiration is one interval after
+    /// the call
+    /// @return TimerTriggerError if the timer could not be started
+    cxx::expected<TimerTriggerError> start() noexcept;
+
+    /// @brief stops the timer; expirations which happened before are still notified and counted
+    void stop() noexcept;
+
+    /// @brief returns the number of expirations since the last call and resets it
+    uint64_t takeExpirations() noexcept;
+
+    /// @brief Checks if the TimerTrigger was triggered
+    /// @return true if the timer notified its WaitSet/Listener and the notification was not yet handled
+    bool hasTriggered() const noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    void enableEvent(TriggerHandle&& triggerHandle) noexcept;
+    void disableEvent() noexcept;
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    void detach() noexcept;
+    void unwatch() noexcept;
+    void notify() noexcept;
+    /// @brief adds the expirations of the timerfd to the counted ones
+    /// @return true if the timer expired since the last read
+    bool readExpirations() noexcept;
+
+  private:
+    units::Duration m_interval;
+    TimerMode m_mode{TimerMode::PERIODIC};
+    int32_t m_timerFd{-1};
+    TriggerHandle m_trigger;
+    IoReactor* m_ioReactor{nullptr};
+    cxx::optional<uint64_t> m_watchId;
+    std::atomic<uint64_t> m_expirations{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_TRIGGER_HPP
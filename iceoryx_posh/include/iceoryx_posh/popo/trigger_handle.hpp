@@ -28,6 +28,8 @@ namespace iox
 {
 namespace popo
 {
+class IoReactor;
+
 /// @brief TriggerHandle is threadsafe without restrictions in a single process.
 ///        Not qualified for inter process usage. The TriggerHandle is generated
 ///        by a Notifyable like the WaitSet and handed out to the user when they
@@ -45,9 +47,11 @@ class TriggerHandle
     /// @param[in] resetCallback callback which will be called it goes out of scope or reset is called
     /// @param[in] uniqueTriggerId the unique trigger id of the Trigger which corresponds to the TriggerHandle. Usually
     /// stored in a Notifyable. It is required for the resetCallback
+    /// @param[in] ioReactor the IoReactor of the Notifyable which watches the file descriptors of the trigger
     TriggerHandle(ConditionVariableData& conditionVariableData,
                   const cxx::MethodCallback<void, uint64_t> resetCallback,
-                  const uint64_t uniqueTriggerId) noexcept;
+                  const uint64_t uniqueTriggerId,
+                  IoReactor* const ioReactor = nullptr) noexcept;
     TriggerHandle(const TriggerHandle&) = delete;
     TriggerHandle& operator=(const TriggerHandle&) = delete;
 
@@ -84,8 +88,12 @@ class TriggerHandle
     /// @brief returns the pointer to the ConditionVariableData
     ConditionVariableData* getConditionVariableData() noexcept;
 
+    /// @brief returns the pointer to the IoReactor of the Notifyable, nullptr if it has none
+    IoReactor* getIoReactor() noexcept;
+
   private:
     ConditionVariableData* m_conditionVariableDataPtr = nullptr;
+    IoReactor* m_ioReactor = nullptr;
     cxx::MethodCallback<void, uint64_t> m_resetCallback;
     uint64_t m_uniqueTriggerId = Trigger::INVALID_TRIGGER_ID;
     mutable std::recursive_mutex m_mutex;
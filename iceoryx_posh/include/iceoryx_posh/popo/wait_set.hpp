@@ -27,12 +27,14 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/io_reactor.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 namespace iox
@@ -45,6 +47,7 @@ enum class WaitSetError : uint8_t
 {
     WAIT_SET_FULL,
     ALREADY_ATTACHED,
+    UNABLE_TO_CREATE_FILE_DESCRIPTOR,
 };
 
 
@@ -63,6 +66,10 @@ class WaitSet
     using NotificationInfoVector = cxx::vector<const NotificationInfo*, CAPACITY>;
 
     WaitSet() noexcept;
+
+    /// @brief Creates a WaitSet which waits according to the provided options
+    /// @param[in] waitOptions defines whether wait() and timedWait() block, busy poll or poll before blocking
+    explicit WaitSet(const WaitOptions& waitOptions) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -203,6 +210,18 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Returns a file descriptor which becomes readable whenever the WaitSet is notified or an attached
+    ///        FileDescriptorTrigger or TimerTrigger is ready. It can be added to the epoll set of an external event
+    ///        loop, like asio or libuv, which calls timedWait with a timeout of zero when the file descriptor is
+    ///        readable. No thread has to block in wait() to forward the events. A notification which is deferred by
+    ///        a subscriber makes it readable as well; once timedWait has seen it, the file descriptor becomes readable
+    ///        again at the deadline of the notification.
+    /// @note The file descriptor is created with the first call, owned by the WaitSet and valid until the WaitSet
+    ///       is destroyed. It is an epoll instance and must not be used by the user for anything but polling,
+    ///       timedWait and wait reset it. Only available on Linux.
+    /// @return the file descriptor or WaitSetError::UNABLE_TO_CREATE_FILE_DESCRIPTOR
+    cxx::expected<int32_t, WaitSetError> getFileDescriptor() noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -210,7 +229,7 @@ class WaitSet
     static constexpr uint64_t capacity() noexcept;
 
   protected:
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData, const WaitOptions& waitOptions = {}) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
@@ -243,6 +262,7 @@ class WaitSet
     /// needs to be a list since we return pointer to the underlying NotificationInfo class with wait
     TriggerArray m_triggerArray;
     ConditionVariableData* m_conditionVariableDataPtr{nullptr};
+    IoReactor m_ioReactor;
     ConditionListener m_conditionListener;
 
     cxx::stack<uint64_t, Capacity> m_indexRepository;
@@ -118,6 +118,12 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    /// the latencies from publish to take of the chunks taken since the last sample, only chunks of publishers with
+    /// PublisherOptions::stampPublishTimestamp are measured; the percentiles are upper bounds with a 25% resolution
+    uint64_t takeLatencySampleCount{0U};
+    uint64_t takeLatencyP50InNs{0U};
+    uint64_t takeLatencyP99InNs{0U};
+    uint64_t takeLatencyMaxInNs{0U};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_PORT_POOL_HPP
 
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
@@ -31,6 +32,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_port_index.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
@@ -65,18 +67,38 @@ class PortPool
 
     virtual ~PortPool() noexcept = default;
 
-    /// @todo don't create the vector with each call but only when the data really change
-    /// there could be a member "cxx::vector<popo::PublisherPortData* m_publisherPorts;" and publisherPorts() would just
-    /// update this member if the publisher ports actually changed
-    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> getPublisherPortDataList() noexcept;
-    cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> getSubscriberPortDataList() noexcept;
-    cxx::vector<popo::ClientPortData*, MAX_CLIENTS> getClientPortDataList() noexcept;
-    cxx::vector<popo::ServerPortData*, MAX_SERVERS> getServerPortDataList() noexcept;
-    cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getInterfacePortDataList() noexcept;
-    cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
-    cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+    /// @brief The following methods return a view of the data in the shared memory. The view is iterated in place,
+    /// i.e. neither the data nor pointers to the data are copied. Removing the data the iterator currently points to
+    /// is allowed while iterating.
+    FixedPositionContainer<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS>::Content
+    getPublisherPortDataList() noexcept;
+    FixedPositionContainer<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS>::Content
+    getSubscriberPortDataList() noexcept;
+    FixedPositionContainer<popo::ClientPortData, MAX_CLIENTS>::Content getClientPortDataList() noexcept;
+    FixedPositionContainer<popo::ServerPortData, MAX_SERVERS>::Content getServerPortDataList() noexcept;
+    FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER>::Content getInterfacePortDataList() noexcept;
+    FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER>::Content getNodeDataList() noexcept;
+    FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES>::Content
     getConditionVariableDataList() noexcept;
 
+    /// @brief The following methods return only the data which is owned by the provided runtime. They use an index
+    /// of the runtime names and therefore do not iterate over the data of all other runtimes.
+    /// @param[in] runtimeName of the runtime which owns the data
+    /// @return the data owned by the runtime
+    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+    getPublisherPortDataList(const RuntimeName_t& runtimeName) const noexcept;
+    cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+    getSubscriberPortDataList(const RuntimeName_t& runtimeName) const noexcept;
+    cxx::vector<popo::ClientPortData*, MAX_CLIENTS> getClientPortDataList(const RuntimeName_t& runtimeName) const
+        noexcept;
+    cxx::vector<popo::ServerPortData*, MAX_SERVERS> getServerPortDataList(const RuntimeName_t& runtimeName) const
+        noexcept;
+    cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>
+    getInterfacePortDataList(const RuntimeName_t& runtimeName) const noexcept;
+    cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList(const RuntimeName_t& runtimeName) const noexcept;
+    cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+    getConditionVariableDataList(const RuntimeName_t& runtimeName) const noexcept;
+
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -177,6 +199,15 @@ class PortPool
 
   private:
     PortPoolData* m_portPoolData;
+
+    /// @note the indices are not stored in the shared memory since they are only used by RouDi
+    RuntimePortIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publisherPortIndex;
+    RuntimePortIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    RuntimePortIndex<popo::ClientPortData, MAX_CLIENTS> m_clientPortIndex;
+    RuntimePortIndex<popo::ServerPortData, MAX_SERVERS> m_serverPortIndex;
+    RuntimePortIndex<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortIndex;
+    RuntimePortIndex<runtime::NodeData, MAX_NODE_NUMBER> m_nodeDataIndex;
+    RuntimePortIndex<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableDataIndex;
 };
 
 } // namespace roudi
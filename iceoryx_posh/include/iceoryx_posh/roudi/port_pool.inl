@@ -27,14 +27,18 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
                                                                     const popo::SubscriberOptions& subscriberOptions,
                                                                     const mepoo::MemoryInfo& memoryInfo) noexcept
 {
-    return m_portPoolData->m_subscriberPortMembers.insert(
+    // the ChunkQueuePusher serializes the producers with the lock of the chunk queue, therefore the single producer
+    // SoFi can be used for multiple publishers; the FiFo has no single producer variant with a resizeable capacity
+    auto subscriberPortData = m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
         runtimeName,
         (subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
-            ? cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
+            ? cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer
             : cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
         subscriberOptions,
         memoryInfo);
+    m_subscriberPortIndex.insert(subscriberPortData);
+    return subscriberPortData;
 }
 
 template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPolicy>::value>*>
@@ -43,7 +47,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
                                                                     const popo::SubscriberOptions& subscriberOptions,
                                                                     const mepoo::MemoryInfo& memoryInfo) noexcept
 {
-    return m_portPoolData->m_subscriberPortMembers.insert(
+    auto subscriberPortData = m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
         runtimeName,
         (subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
@@ -51,6 +55,8 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
             : cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
         subscriberOptions,
         memoryInfo);
+    m_subscriberPortIndex.insert(subscriberPortData);
+    return subscriberPortData;
 }
 } // namespace roudi
 } // namespace iox
@@ -82,6 +82,9 @@ ServiceDescription::ServiceDescription(const IdString_t& service,
     : m_serviceString{service}
     , m_instanceString{instance}
     , m_eventString{event}
+    , m_serviceKey{createStringKey(service)}
+    , m_instanceKey{createStringKey(instance)}
+    , m_eventKey{createStringKey(event)}
     , m_classHash(classHash)
     , m_interfaceSource(interfaceSource)
 {
@@ -89,6 +92,13 @@ ServiceDescription::ServiceDescription(const IdString_t& service,
 
 bool ServiceDescription::operator==(const ServiceDescription& rhs) const noexcept
 {
+    // different strings almost always have different keys, therefore most unequal service descriptions are rejected
+    // without touching the strings
+    if (m_serviceKey != rhs.m_serviceKey || m_instanceKey != rhs.m_instanceKey || m_eventKey != rhs.m_eventKey)
+    {
+        return false;
+    }
+
     if (m_serviceString != rhs.m_serviceString)
     {
         return false;
@@ -176,6 +186,9 @@ ServiceDescription::deserialize(const cxx::Serialization& serialized) noexcept
         return cxx::error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
     }
 
+    deserializedObject.m_serviceKey = createStringKey(deserializedObject.m_serviceString);
+    deserializedObject.m_instanceKey = createStringKey(deserializedObject.m_instanceString);
+    deserializedObject.m_eventKey = createStringKey(deserializedObject.m_eventString);
     deserializedObject.m_scope = static_cast<Scope>(scope);
     deserializedObject.m_interfaceSource = static_cast<Interfaces>(interfaceSource);
 
@@ -197,6 +210,37 @@ const IdString_t& ServiceDescription::getEventIDString() const noexcept
     return m_eventString;
 }
 
+ServiceDescription::StringKey_t ServiceDescription::getServiceKey() const noexcept
+{
+    return m_serviceKey;
+}
+
+ServiceDescription::StringKey_t ServiceDescription::getInstanceKey() const noexcept
+{
+    return m_instanceKey;
+}
+
+ServiceDescription::StringKey_t ServiceDescription::getEventKey() const noexcept
+{
+    return m_eventKey;
+}
+
+ServiceDescription::StringKey_t ServiceDescription::createStringKey(const IdString_t& idString) noexcept
+{
+    // FNV-1a, the key only depends on the characters and is therefore the same in every process
+    constexpr StringKey_t FNV_OFFSET_BASIS{2166136261U};
+    constexpr StringKey_t FNV_PRIME{16777619U};
+
+    StringKey_t key{FNV_OFFSET_BASIS};
+    const auto* const characters = idString.c_str();
+    for (uint64_t i = 0U; i < idString.size(); ++i)
+    {
+        key ^= static_cast<uint8_t>(characters[i]);
+        key *= FNV_PRIME;
+    }
+    return key;
+}
+
 bool ServiceDescription::isLocal() const noexcept
 {
     return m_scope == Scope::LOCAL;
@@ -224,7 +268,8 @@ Interfaces ServiceDescription::getSourceInterface() const noexcept
 
 bool serviceMatch(const ServiceDescription& first, const ServiceDescription& second) noexcept
 {
-    return (first.getServiceIDString() == second.getServiceIDString());
+    return (first.getServiceKey() == second.getServiceKey())
+           && (first.getServiceIDString() == second.getServiceIDString());
 }
 
 std::ostream& operator<<(std::ostream& stream, const ServiceDescription& service) noexcept
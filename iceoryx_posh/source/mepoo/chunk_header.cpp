@@ -24,6 +24,7 @@ namespace iox
 namespace mepoo
 {
 constexpr uint8_t ChunkHeader::CHUNK_HEADER_VERSION;
+constexpr uint64_t ChunkHeader::NO_PUBLISH_TIMESTAMP;
 
 ChunkHeader::ChunkHeader(const uint32_t chunkSize, const ChunkSettings& chunkSettings) noexcept
     : m_chunkSize(chunkSize)
@@ -222,6 +223,16 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+uint64_t ChunkHeader::publishTimestamp() const noexcept
+{
+    return m_publishTimestamp;
+}
+
+void ChunkHeader::setPublishTimestamp(const uint64_t publishTimestamp) noexcept
+{
+    m_publishTimestamp = publishTimestamp;
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
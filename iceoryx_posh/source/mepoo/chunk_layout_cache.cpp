@@ -0,0 +1,83 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "iceoryx_posh/internal/mepoo/chunk_layout_cache.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace mepoo
+{
+cxx::expected<ChunkSettings, ChunkSettings::Error>
+ChunkLayoutCache::getChunkSettings(const uint32_t userPayloadSize,
+                                   const uint32_t userPayloadAlignment,
+                                   const uint32_t userHeaderSize,
+                                   const uint32_t userHeaderAlignment) noexcept
+{
+    if (m_chunkSettings.has_value() && m_userPayloadSize == userPayloadSize
+        && m_userPayloadAlignment == userPayloadAlignment && m_userHeaderSize == userHeaderSize
+        && m_userHeaderAlignment == userHeaderAlignment)
+    {
+        return cxx::success<ChunkSettings>(m_chunkSettings.value());
+    }
+
+    m_chunkSettings.reset();
+    m_hasCachedChunkHeader = false;
+
+    auto chunkSettingsResult =
+        ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (!chunkSettingsResult.has_error())
+    {
+        m_userPayloadSize = userPayloadSize;
+        m_userPayloadAlignment = userPayloadAlignment;
+        m_userHeaderSize = userHeaderSize;
+        m_userHeaderAlignment = userHeaderAlignment;
+        m_chunkSettings.emplace(chunkSettingsResult.value());
+    }
+
+    return chunkSettingsResult;
+}
+
+void ChunkLayoutCache::cacheChunkHeader(const ChunkHeader& chunkHeader) noexcept
+{
+    // with a user-header or a user-payload alignment larger than the ChunkHeader alignment, the user-payload offset
+    // depends on the address of the chunk and the back-offset is stored outside of the ChunkHeader
+    const bool isLayoutIndependentOfChunkAddress = chunkHeader.userHeaderSize() == 0U
+                                                   && chunkHeader.userPayloadAlignment() <= alignof(ChunkHeader);
+
+    if (m_hasCachedChunkHeader || !m_chunkSettings.has_value() || !isLayoutIndependentOfChunkAddress)
+    {
+        return;
+    }
+
+    std::memcpy(&m_cachedChunkHeader[0], &chunkHeader, sizeof(ChunkHeader));
+    m_hasCachedChunkHeader = true;
+}
+
+ChunkHeader* ChunkLayoutCache::tryInitializeChunkHeader(void* const chunk, const uint32_t chunkSize) const noexcept
+{
+    if (!m_hasCachedChunkHeader
+        || reinterpret_cast<const ChunkHeader*>(&m_cachedChunkHeader[0])->chunkSize() != chunkSize)
+    {
+        return nullptr;
+    }
+
+    std::memcpy(chunk, &m_cachedChunkHeader[0], sizeof(ChunkHeader));
+    return static_cast<ChunkHeader*>(chunk);
+}
+
+} // namespace mepoo
+} // namespace iox
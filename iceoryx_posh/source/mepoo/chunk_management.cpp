@@ -23,17 +23,11 @@ namespace iox
 namespace mepoo
 {
 ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
-                                 const cxx::not_null<MemPool*> mempool,
-                                 const cxx::not_null<MemPool*> chunkManagementPool) noexcept
+                                 const cxx::not_null<MemPool*> mempool) noexcept
     : m_chunkHeader(chunkHeader)
     , m_mempool(mempool)
-    , m_chunkManagementPool(chunkManagementPool)
 {
-    static_assert(alignof(ChunkManagement) <= mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT,
-                  "The ChunkManagement must not exceed the alignment of the mempool chunks, which are aligned to "
-                  "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
-
 } // namespace mepoo
 } // namespace iox
@@ -40,6 +40,10 @@ MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
 
+static_assert(alignof(ChunkManagement) <= MemPool::CHUNK_MEMORY_ALIGNMENT,
+              "The ChunkManagement must not exceed the alignment of the mempool chunks, which are aligned to "
+              "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
+
 MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
                  posix::Allocator& managementAllocator,
@@ -55,6 +59,8 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> c
         auto memoryLoFFLi =
             managementAllocator.allocate(freeList_t::requiredIndexMemorySize(m_numberOfChunks), CHUNK_MEMORY_ALIGNMENT);
         m_freeIndices.init(static_cast<concurrent::LoFFLi::Index_t*>(memoryLoFFLi), m_numberOfChunks);
+        m_chunkManagements = static_cast<ChunkManagement*>(managementAllocator.allocate(
+            static_cast<uint64_t>(m_numberOfChunks) * sizeof(ChunkManagement), CHUNK_MEMORY_ALIGNMENT));
     }
     else
     {
@@ -93,7 +99,7 @@ void* MemPool::getChunk() noexcept
     return m_rawMemory + l_index * m_chunkSize;
 }
 
-void MemPool::freeChunk(const void* chunk) noexcept
+uint32_t MemPool::indexOfChunk(const void* chunk) const noexcept
 {
     cxx::Expects(m_rawMemory <= chunk
                  && chunk <= m_rawMemory + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
@@ -101,7 +107,12 @@ void MemPool::freeChunk(const void* chunk) noexcept
     auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory;
     cxx::Expects(offset % m_chunkSize == 0);
 
-    uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
+    return static_cast<uint32_t>(offset / m_chunkSize);
+}
+
+void MemPool::freeChunk(const void* chunk) noexcept
+{
+    uint32_t index = indexOfChunk(chunk);
 
     if (!m_freeIndices.push(index))
     {
@@ -111,6 +122,18 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+ChunkManagement* MemPool::getChunkManagement(const void* chunk) noexcept
+{
+    return m_chunkManagements.get() + indexOfChunk(chunk);
+}
+
+uint64_t MemPool::requiredManagementMemorySize(const uint32_t numberOfChunks) noexcept
+{
+    return cxx::align(static_cast<uint64_t>(freeList_t::requiredIndexMemorySize(numberOfChunks)),
+                      CHUNK_MEMORY_ALIGNMENT)
+           + cxx::align(static_cast<uint64_t>(numberOfChunks) * sizeof(ChunkManagement), CHUNK_MEMORY_ALIGNMENT);
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
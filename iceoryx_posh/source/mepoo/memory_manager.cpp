@@ -50,7 +50,7 @@ void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
     uint32_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint32_t>(chunkPayloadSize));
     if (m_denyAddMemPool)
     {
-        LogFatal() << "After the generation of the chunk management pool you are not allowed to create new mempools.";
+        LogFatal() << "After the configuration of the memory manager you are not allowed to create new mempools.";
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL);
     }
     else if (m_memPoolVector.size() > 0 && adjustedChunkSize <= m_memPoolVector.back().getChunkSize())
@@ -67,14 +67,6 @@ void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
     }
 
     m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
-    m_totalNumberOfChunks += numberOfChunks;
-}
-
-void MemoryManager::generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept
-{
-    m_denyAddMemPool = true;
-    uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -115,20 +107,11 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
 uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0U};
-    uint32_t sumOfAllChunks{0U};
     for (const auto& mempool : mePooConfig.m_mempoolConfig)
     {
-        sumOfAllChunks += mempool.m_chunkCount;
-        memorySize +=
-            cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount)),
-                       MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize += MemPool::requiredManagementMemorySize(mempool.m_chunkCount);
     }
 
-    memorySize +=
-        cxx::align(static_cast<uint64_t>(sumOfAllChunks * sizeof(ChunkManagement)), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize += cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks)),
-                             MemPool::CHUNK_MEMORY_ALIGNMENT);
-
     return memorySize;
 }
 
@@ -146,10 +129,22 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
 
-    generateChunkManagementPool(managementAllocator);
+    m_denyAddMemPool = true;
 }
 
 cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return getChunk(chunkSettings, nullptr);
+}
+
+cxx::expected<SharedChunk, MemoryManager::Error>
+MemoryManager::getChunk(const ChunkSettings& chunkSettings, const ChunkLayoutCache& chunkLayoutCache) noexcept
+{
+    return getChunk(chunkSettings, &chunkLayoutCache);
+}
+
+cxx::expected<SharedChunk, MemoryManager::Error>
+MemoryManager::getChunk(const ChunkSettings& chunkSettings, const ChunkLayoutCache* const chunkLayoutCache) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
@@ -201,9 +196,15 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
     }
     else
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        ChunkHeader* chunkHeader = (chunkLayoutCache != nullptr)
+                                       ? chunkLayoutCache->tryInitializeChunkHeader(chunk, aquiredChunkSize)
+                                       : nullptr;
+        if (chunkHeader == nullptr)
+        {
+            chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
+        }
+        auto chunkManagement =
+            new (memPoolPointer->getChunkManagement(chunk)) ChunkManagement(chunkHeader, memPoolPointer);
         return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
     }
 }
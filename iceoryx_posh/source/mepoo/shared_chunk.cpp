@@ -62,7 +62,6 @@ void SharedChunk::decrementReferenceCounter() noexcept
 void SharedChunk::freeChunk() noexcept
 {
     m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
     m_chunkManagement = nullptr;
 }
 
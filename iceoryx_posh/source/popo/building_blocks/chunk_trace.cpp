@@ -0,0 +1,163 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <chrono>
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t ChunkTraceRing::VERSION;
+constexpr uint64_t ChunkTraceRing::SEGMENT_ID_SHIFT;
+constexpr uint64_t ChunkTraceEvent::POSITION_BUSY;
+
+std::atomic<ChunkTraceRing*> ChunkTrace::m_ring{nullptr};
+
+namespace
+{
+/// @brief the shared memory of the active ring; it is intentionally not destroyed at process exit to keep the ring
+/// for iox-trace-export, only disable removes it
+posix::SharedMemoryObject* g_ringMemory{nullptr};
+std::mutex g_ringMutex;
+} // namespace
+
+ChunkTraceEvent* ChunkTraceRing::events() noexcept
+{
+    return reinterpret_cast<ChunkTraceEvent*>(reinterpret_cast<uint8_t*>(this) + sizeof(ChunkTraceRing));
+}
+
+const ChunkTraceEvent* ChunkTraceRing::events() const noexcept
+{
+    return reinterpret_cast<const ChunkTraceEvent*>(reinterpret_cast<const uint8_t*>(this) + sizeof(ChunkTraceRing));
+}
+
+uint64_t ChunkTraceRing::requiredMemorySize(const uint64_t capacity) noexcept
+{
+    static_assert(sizeof(ChunkTraceRing) % alignof(ChunkTraceEvent) == 0U,
+                  "The events must be aligned when they directly follow the ChunkTraceRing");
+    return sizeof(ChunkTraceRing) + capacity * sizeof(ChunkTraceEvent);
+}
+
+posix::SharedMemory::Name_t ChunkTrace::shmName(const RuntimeName_t& runtimeName) noexcept
+{
+    posix::SharedMemory::Name_t name(cxx::TruncateToCapacity, CHUNK_TRACE_SHM_PREFIX);
+    name.append(cxx::TruncateToCapacity, runtimeName);
+    return name;
+}
+
+cxx::expected<ChunkTraceError> ChunkTrace::enable(const RuntimeName_t& runtimeName, const uint64_t capacity) noexcept
+{
+    if (capacity == 0U || (capacity & (capacity - 1U)) != 0U || capacity > MAX_CHUNK_TRACE_CAPACITY)
+    {
+        return cxx::error<ChunkTraceError>(ChunkTraceError::INVALID_CAPACITY);
+    }
+
+    std::lock_guard<std::mutex> lock(g_ringMutex);
+    if (g_ringMemory != nullptr)
+    {
+        return cxx::error<ChunkTraceError>(ChunkTraceError::ALREADY_ENABLED);
+    }
+
+    auto memoryResult = posix::SharedMemoryObjectBuilder()
+                            .name(shmName(runtimeName))
+                            .memorySizeInBytes(ChunkTraceRing::requiredMemorySize(capacity))
+                            .accessMode(posix::AccessMode::READ_WRITE)
+                            .openMode(posix::OpenMode::PURGE_AND_CREATE)
+                            .permissions(cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read)
+                            .create();
+    if (memoryResult.has_error())
+    {
+        LogError() << "Unable to create the chunk trace ring '" << shmName(runtimeName) << "'";
+        return cxx::error<ChunkTraceError>(ChunkTraceError::UNABLE_TO_CREATE_SHARED_MEMORY);
+    }
+
+    g_ringMemory = new posix::SharedMemoryObject(std::move(memoryResult.value()));
+    auto ring = new (g_ringMemory->getBaseAddress()) ChunkTraceRing();
+    ring->capacity = capacity;
+    ring->pid = static_cast<uint64_t>(getpid());
+    ring->runtimeName = runtimeName;
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        new (&ring->events()[i]) ChunkTraceEvent();
+    }
+
+    m_ring.store(ring, std::memory_order_release);
+    LogInfo() << "Chunk trace enabled with " << capacity << " events in '" << shmName(runtimeName) << "'";
+    return cxx::success<>();
+}
+
+void ChunkTrace::disable() noexcept
+{
+    std::lock_guard<std::mutex> lock(g_ringMutex);
+    m_ring.store(nullptr, std::memory_order_release);
+    delete g_ringMemory;
+    g_ringMemory = nullptr;
+}
+
+bool ChunkTrace::isEnabled() noexcept
+{
+    return m_ring.load(std::memory_order_relaxed) != nullptr;
+}
+
+void ChunkTrace::write(ChunkTraceRing& ring,
+                       const ChunkTraceEventType type,
+                       const uint64_t id,
+                       const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    const auto timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+
+    // the chunk is identified by its position in the shared memory, which is the same in every process
+    auto chunkAddress = const_cast<mepoo::ChunkHeader*>(chunkHeader);
+    const auto segmentId = rp::BaseRelativePointer::searchId(chunkAddress);
+    constexpr uint64_t OFFSET_MASK{(static_cast<uint64_t>(1U) << ChunkTraceRing::SEGMENT_ID_SHIFT) - 1U};
+    const uint64_t chunk = (static_cast<uint64_t>(segmentId) << ChunkTraceRing::SEGMENT_ID_SHIFT)
+                           | (static_cast<uint64_t>(rp::BaseRelativePointer::getOffset(segmentId, chunkAddress))
+                              & OFFSET_MASK);
+
+    const uint64_t index = ring.writeIndex.fetch_add(1U, std::memory_order_relaxed);
+    auto& event = ring.events()[index & (ring.capacity - 1U)];
+
+    // when the ring wraps around, writers of different rounds can target the same event; only one of them may write
+    // it and an event must not be replaced by an older one, the event of the losing writer is dropped
+    uint64_t position = event.position.load(std::memory_order_relaxed);
+    do
+    {
+        if (position == ChunkTraceEvent::POSITION_BUSY || position > index)
+        {
+            return;
+        }
+    } while (!event.position.compare_exchange_weak(
+        position, ChunkTraceEvent::POSITION_BUSY, std::memory_order_acquire, std::memory_order_relaxed));
+
+    // a reader which sees the same position before and after reading the fields got a consistent event
+    std::atomic_thread_fence(std::memory_order_release);
+    event.timestamp = timestamp;
+    event.id = id;
+    event.chunk = chunk;
+    event.sequenceNumber = chunkHeader->sequenceNumber();
+    event.type = type;
+    event.position.store(index + 1U, std::memory_order_release);
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,258 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_file_descriptor.hpp"
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/cxx/generic_raii.hpp"
+#include "iceoryx_hoofs/platform/platform_settings.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <atomic>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdio>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace iox
+{
+namespace popo
+{
+#if defined(__linux__)
+namespace
+{
+constexpr const char CONDITION_FILE_DESCRIPTOR_PATH_FORMAT[] = "%siox_cv_%016" PRIx64;
+
+/// @brief the id consists of the process id and a process local counter and is unique on the system
+uint64_t createId() noexcept
+{
+    static std::atomic<uint32_t> counter{1U};
+    constexpr uint64_t PID_SHIFT{32U};
+    return (static_cast<uint64_t>(getpid()) << PID_SHIFT) | counter.fetch_add(1U, std::memory_order_relaxed);
+}
+
+/// @brief the socket file is placed next to the unix domain sockets of the runtimes; unlike an abstract address it
+/// has access rights, so that only processes of the user and the group of the waiter can signal it
+sockaddr_un toAddress(const uint64_t id) noexcept
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    IOX_DISCARD_RESULT(snprintf(address.sun_path,
+                                sizeof(address.sun_path),
+                                CONDITION_FILE_DESCRIPTOR_PATH_FORMAT,
+                                platform::IOX_UDS_SOCKET_PATH_PREFIX,
+                                id));
+    return address;
+}
+
+/// @brief signal is called on every notification, therefore a failure which may repeat is only logged once per process
+std::atomic_bool& hasLoggedSignalFailure() noexcept
+{
+    static std::atomic_bool hasLogged{false};
+    return hasLogged;
+}
+
+/// @brief all notifiers of a process send their signals with this unbound socket; it lives until the process ends
+int32_t senderSocket() noexcept
+{
+    static const int32_t fileDescriptor{socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0)};
+    return fileDescriptor;
+}
+} // namespace
+#endif
+
+cxx::expected<ConditionFileDescriptor, ConditionFileDescriptorError>
+ConditionFileDescriptor::create(ConditionVariableData& condVarData) noexcept
+{
+#if defined(__linux__)
+    auto socketCall = posix::posixCall(socket)(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)
+                          .failureReturnValue(-1)
+                          .evaluate();
+    if (socketCall.has_error())
+    {
+        LogError() << "Unable to create the socket of the ConditionFileDescriptor: "
+                   << socketCall.get_error().getHumanReadableErrnum();
+        return cxx::error<ConditionFileDescriptorError>(ConditionFileDescriptorError::UNABLE_TO_CREATE_SOCKET);
+    }
+    const int32_t fileDescriptor = socketCall->value;
+
+    const uint64_t id = createId();
+    auto address = toAddress(id);
+    // the file of a crashed process with the same process id would let the bind fail
+    IOX_DISCARD_RESULT(
+        posix::posixCall(unlink)(address.sun_path).failureReturnValue(-1).ignoreErrnos(ENOENT).evaluate());
+
+    // the socket file is readable and writable for the user and the group, like the sockets of the runtimes
+    mode_t umaskSaved = umask(S_IXUSR | S_IXGRP | S_IRWXO);
+    cxx::GenericRAII umaskGuard([&] { umask(umaskSaved); });
+    auto bindCall = posix::posixCall(bind)(fileDescriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address))
+                        .failureReturnValue(-1)
+                        .evaluate();
+    if (bindCall.has_error())
+    {
+        LogError() << "Unable to bind the socket of the ConditionFileDescriptor: "
+                   << bindCall.get_error().getHumanReadableErrnum();
+        IOX_DISCARD_RESULT(posix::posixCall(close)(fileDescriptor).failureReturnValue(-1).evaluate());
+        return cxx::error<ConditionFileDescriptorError>(ConditionFileDescriptorError::UNABLE_TO_CREATE_SOCKET);
+    }
+
+    condVarData.m_fileDescriptorSignaled.store(false, std::memory_order_relaxed);
+    condVarData.m_fileDescriptorId.store(id, std::memory_order_release);
+    return cxx::success<ConditionFileDescriptor>(ConditionFileDescriptor(condVarData, fileDescriptor, id));
+#else
+    IOX_DISCARD_RESULT(condVarData);
+    return cxx::error<ConditionFileDescriptorError>(ConditionFileDescriptorError::NOT_SUPPORTED);
+#endif
+}
+
+ConditionFileDescriptor::ConditionFileDescriptor(ConditionVariableData& condVarData,
+                                                 const int32_t fileDescriptor,
+                                                 const uint64_t id) noexcept
+    : m_condVarDataPtr(&condVarData)
+    , m_fileDescriptor(fileDescriptor)
+    , m_id(id)
+{
+}
+
+ConditionFileDescriptor::ConditionFileDescriptor(ConditionFileDescriptor&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+ConditionFileDescriptor& ConditionFileDescriptor::operator=(ConditionFileDescriptor&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        m_condVarDataPtr = rhs.m_condVarDataPtr;
+        m_fileDescriptor = rhs.m_fileDescriptor;
+        m_id = rhs.m_id;
+        rhs.m_condVarDataPtr = nullptr;
+        rhs.m_fileDescriptor = -1;
+        rhs.m_id = 0U;
+    }
+    return *this;
+}
+
+ConditionFileDescriptor::~ConditionFileDescriptor() noexcept
+{
+    destroy();
+}
+
+void ConditionFileDescriptor::destroy() noexcept
+{
+#if defined(__linux__)
+    if (m_condVarDataPtr != nullptr)
+    {
+        m_condVarDataPtr->m_fileDescriptorId.store(0U, std::memory_order_release);
+        m_condVarDataPtr = nullptr;
+    }
+    if (m_fileDescriptor != -1)
+    {
+        IOX_DISCARD_RESULT(posix::posixCall(close)(m_fileDescriptor).failureReturnValue(-1).evaluate());
+        m_fileDescriptor = -1;
+    }
+    if (m_id != 0U)
+    {
+        const auto address = toAddress(m_id);
+        IOX_DISCARD_RESULT(
+            posix::posixCall(unlink)(address.sun_path).failureReturnValue(-1).ignoreErrnos(ENOENT).evaluate());
+        m_id = 0U;
+    }
+#endif
+}
+
+int32_t ConditionFileDescriptor::getFileDescriptor() const noexcept
+{
+    return m_fileDescriptor;
+}
+
+void ConditionFileDescriptor::reset() noexcept
+{
+#if defined(__linux__)
+    if (m_condVarDataPtr == nullptr)
+    {
+        return;
+    }
+
+    // the exchange synchronizes with the one of the notifier, its notification is visible to the following wait;
+    // every later notification sends a new signal
+    m_condVarDataPtr->m_fileDescriptorSignaled.exchange(false, std::memory_order_acq_rel);
+
+    uint8_t buffer[16U];
+    while (recv(m_fileDescriptor, buffer, sizeof(buffer), MSG_DONTWAIT) > 0)
+    {
+    }
+#endif
+}
+
+void ConditionFileDescriptor::signal(ConditionVariableData& condVarData) noexcept
+{
+#if defined(__linux__)
+    const uint64_t id = condVarData.m_fileDescriptorId.load(std::memory_order_acquire);
+    if (id == 0U || condVarData.m_fileDescriptorSignaled.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    const auto address = toAddress(id);
+    const uint8_t data{1U};
+    auto sendCall = posix::posixCall(sendto)(senderSocket(),
+                                             &data,
+                                             sizeof(data),
+                                             MSG_DONTWAIT,
+                                             reinterpret_cast<const sockaddr*>(&address),
+                                             static_cast<socklen_t>(sizeof(address)))
+                        .failureReturnValue(-1)
+                        .evaluate();
+    if (sendCall.has_error())
+    {
+        const auto errnum = sendCall.get_error().errnum;
+        if (errnum == ENOENT || errnum == ECONNREFUSED)
+        {
+            // the waiter is gone without disabling the signaling, e.g. since it crashed; only the notifier which
+            // disables it logs, the following notifications do not try it anymore
+            auto expectedId = id;
+            if (condVarData.m_fileDescriptorId.compare_exchange_strong(
+                    expectedId, 0U, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                LogWarn() << "The file descriptor of the condition variable at '" << address.sun_path
+                          << "' is gone: " << sendCall.get_error().getHumanReadableErrnum()
+                          << ". Its signaling is disabled.";
+            }
+        }
+        else if (!hasLoggedSignalFailure().exchange(true, std::memory_order_relaxed))
+        {
+            LogWarn() << "Unable to signal the file descriptor of the condition variable at '" << address.sun_path
+                      << "': " << sendCall.get_error().getHumanReadableErrnum()
+                      << ". The next notification tries it again, further failures are not logged.";
+        }
+        condVarData.m_fileDescriptorSignaled.store(false, std::memory_order_release);
+    }
+#else
+    IOX_DISCARD_RESULT(condVarData);
+#endif
+}
+
+} // namespace popo
+} // namespace iox
@@ -16,14 +16,31 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+namespace
+{
+units::Duration steadyClockNow() noexcept
+{
+    // the steady clock is system wide and can therefore be compared with deadlines of notifiers in other processes
+    return units::Duration(std::chrono::steady_clock::now().time_since_epoch());
+}
+} // namespace
+
+ConditionListener::ConditionListener(ConditionVariableData& condVarData,
+                                     const WaitOptions& waitOptions,
+                                     IoReactor* const ioReactor) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitOptions(waitOptions)
+    , m_ioReactor(ioReactor)
 {
 }
 
@@ -49,6 +66,8 @@ void ConditionListener::destroy() noexcept
     getMembers()->m_semaphore.post().or_else([](auto) {
         errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY, ErrorLevel::FATAL);
     });
+    // wakes up a waiter which blocks in the IoReactor
+    ConditionFileDescriptor::signal(*getMembers());
 }
 
 bool ConditionListener::wasNotified() const noexcept
@@ -66,24 +85,119 @@ bool ConditionListener::wasNotified() const noexcept
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
     return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore.wait().has_error())
+        this->waitFor(this->timeUntilDeferredNotifications(),
+                      PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
+        return true;
+    });
+}
+
+ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
+{
+    const auto endTime = steadyClockNow() + timeToWait;
+    return waitImpl([this, endTime]() -> bool {
+        const auto now = steadyClockNow();
+        if (now >= endTime)
         {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+            // file descriptors which became ready are handled even if the time is up, e.g. by a timedWait(0) of an
+            // external event loop
+            if (this->hasIoWatches())
+            {
+                m_ioReactor->wait(units::Duration::zero());
+            }
+            // such an event loop is woken up at the deadline of the deferred notifications, which are not due yet
+            const auto timeUntilDeferredNotifications = this->timeUntilDeferredNotifications();
+            if (m_ioReactor != nullptr && timeUntilDeferredNotifications != units::Duration::max())
+            {
+                m_ioReactor->wakeUpAfter(timeUntilDeferredNotifications);
+            }
             return false;
         }
+        this->waitFor(algorithm::min(endTime - now, this->timeUntilDeferredNotifications()),
+                      PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
         return true;
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
+void ConditionListener::waitFor(const units::Duration& timeToWait, const PoshError semaphoreError) noexcept
+{
+    if (hasIoWatches())
+    {
+        waitForIo(timeToWait);
+        return;
+    }
+
+    const auto timeToPoll = pollDuration(timeToWait);
+    if (pollForNotifications(timeToPoll) || timeToPoll >= timeToWait)
+    {
+        return;
+    }
+
+    const bool hasSemaphoreError = (timeToWait == units::Duration::max())
+                                       ? getMembers()->m_semaphore.wait().has_error()
+                                       : getMembers()->m_semaphore.timedWait(timeToWait - timeToPoll).has_error();
+    if (hasSemaphoreError)
+    {
+        errorHandler(semaphoreError, ErrorLevel::FATAL);
+    }
+}
+
+void ConditionListener::waitForIo(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore.timedWait(timeToWait).has_error())
+    // the file descriptors are only seen by epoll_wait, busy polling checks them without blocking after every spin
+    // duration
+    if (m_waitOptions.waitStrategy == WaitStrategy::BUSY_POLLING)
+    {
+        if (!pollForNotifications(algorithm::min(m_waitOptions.spinDuration, timeToWait)))
         {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+            m_ioReactor->wait(units::Duration::zero());
         }
-        return false;
-    });
+        return;
+    }
+
+    const auto timeToPoll = pollDuration(timeToWait);
+    if (pollForNotifications(timeToPoll) || timeToPoll >= timeToWait)
+    {
+        return;
+    }
+
+    m_ioReactor->wait((timeToWait == units::Duration::max()) ? timeToWait : timeToWait - timeToPoll);
+}
+
+bool ConditionListener::hasIoWatches() const noexcept
+{
+    return m_ioReactor != nullptr && m_ioReactor->hasWatches();
+}
+
+units::Duration ConditionListener::timeUntilDeferredNotifications() const noexcept
+{
+    const auto deadline = getMembers()->m_deferredNotificationDeadline.load(std::memory_order_seq_cst);
+    if (deadline == ConditionVariableData::NO_DEFERRED_NOTIFICATION)
+    {
+        return units::Duration::max();
+    }
+
+    const auto now = steadyClockNow().toNanoseconds();
+    return (deadline > now) ? units::Duration::fromNanoseconds(deadline - now) : units::Duration::zero();
+}
+
+void ConditionListener::activateDueDeferredNotifications() noexcept
+{
+    if (timeUntilDeferredNotifications() != units::Duration::zero())
+    {
+        return;
+    }
+
+    // the deadline is reset before the flags are collected; a notifier which defers a notification afterwards sets
+    // a new deadline
+    getMembers()->m_deferredNotificationDeadline.store(ConditionVariableData::NO_DEFERRED_NOTIFICATION,
+                                                       std::memory_order_seq_cst);
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; ++i)
+    {
+        if (getMembers()->m_deferredNotifications[i].exchange(false, std::memory_order_seq_cst))
+        {
+            getMembers()->m_activeNotifications[i].store(true, std::memory_order_relaxed);
+        }
+    }
 }
 
 ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept
@@ -92,9 +206,14 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
+    if (m_ioReactor != nullptr)
+    {
+        m_ioReactor->resetConditionSignal();
+    }
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
+        activateDueDeferredNotifications();
         for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
         {
             if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
@@ -114,6 +233,61 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
     return activeNotifications;
 }
 
+units::Duration ConditionListener::pollDuration(const units::Duration& timeToWait) const noexcept
+{
+    switch (m_waitOptions.waitStrategy)
+    {
+    case WaitStrategy::BUSY_POLLING:
+        return timeToWait;
+    case WaitStrategy::SPIN_THEN_BLOCK:
+        return algorithm::min(m_waitOptions.spinDuration, timeToWait);
+    case WaitStrategy::BLOCKING:
+        break;
+    }
+    return units::Duration::zero();
+}
+
+bool ConditionListener::hasActiveNotifications() const noexcept
+{
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; ++i)
+    {
+        if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ConditionListener::pollForNotifications(const units::Duration& timeToPoll) const noexcept
+{
+    if (timeToPoll == units::Duration::zero())
+    {
+        return false;
+    }
+
+    // the notifier still posts the semaphore but without a blocked waiter this does not enter the kernel
+    cxx::internal::adaptive_wait adaptiveWait;
+    const auto start = std::chrono::steady_clock::now();
+    while (!hasActiveNotifications())
+    {
+        if (m_toBeDestroyed.load(std::memory_order_relaxed)
+            || timeUntilDeferredNotifications() == units::Duration::zero())
+        {
+            return true;
+        }
+        if (units::Duration(std::chrono::steady_clock::now() - start) >= timeToPoll)
+        {
+            return false;
+        }
+        if (m_waitOptions.waitStrategy == WaitStrategy::SPIN_THEN_BLOCK)
+        {
+            adaptiveWait.wait();
+        }
+    }
+    return true;
+}
+
 void ConditionListener::reset(const uint64_t index) noexcept
 {
     if (index < MAX_NUMBER_OF_NOTIFIERS)
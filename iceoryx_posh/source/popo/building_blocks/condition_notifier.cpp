@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_file_descriptor.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
 namespace iox
@@ -38,10 +39,46 @@ void ConditionNotifier::notify() noexcept
 {
     if (m_notificationIndex < MAX_NUMBER_OF_NOTIFIERS)
     {
+        getMembers()->m_deferredNotifications[m_notificationIndex].store(false, std::memory_order_relaxed);
         getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
     }
     getMembers()->m_semaphore.post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
+    if (getMembers()->m_fileDescriptorId.load(std::memory_order_relaxed) != 0U)
+    {
+        ConditionFileDescriptor::signal(*getMembers());
+    }
+}
+
+void ConditionNotifier::deferNotification(const units::Duration& deadline) noexcept
+{
+    if (m_notificationIndex >= MAX_NUMBER_OF_NOTIFIERS)
+    {
+        return;
+    }
+
+    // the flag is set before the deadline, therefore the listener sees the flag when it sees the deadline
+    getMembers()->m_deferredNotifications[m_notificationIndex].store(true, std::memory_order_seq_cst);
+
+    const uint64_t deadlineInNanoseconds = deadline.toNanoseconds();
+    auto& earliestDeadline = getMembers()->m_deferredNotificationDeadline;
+    auto currentDeadline = earliestDeadline.load(std::memory_order_relaxed);
+    while (deadlineInNanoseconds < currentDeadline)
+    {
+        if (earliestDeadline.compare_exchange_weak(currentDeadline, deadlineInNanoseconds, std::memory_order_seq_cst))
+        {
+            // a blocked listener has to wake up to wait with the earlier deadline; it blocks in epoll_wait, like an
+            // external event loop, when a file descriptor is watched
+            getMembers()->m_semaphore.post().or_else([](auto) {
+                errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL);
+            });
+            if (getMembers()->m_fileDescriptorId.load(std::memory_order_relaxed) != 0U)
+            {
+                ConditionFileDescriptor::signal(*getMembers());
+            }
+            return;
+        }
+    }
 }
 
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
@@ -21,6 +21,8 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::NO_DEFERRED_NOTIFICATION;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -33,6 +35,10 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
     {
         id.store(false, std::memory_order_relaxed);
     }
+    for (auto& id : m_deferredNotifications)
+    {
+        id.store(false, std::memory_order_relaxed);
+    }
 }
 } // namespace popo
 } // namespace iox
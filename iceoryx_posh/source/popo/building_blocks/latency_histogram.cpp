@@ -0,0 +1,158 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_SUB_BUCKETS;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+namespace
+{
+/// @brief position of the most significant set bit; value must not be 0
+uint64_t mostSignificantBit(uint64_t value) noexcept
+{
+    uint64_t position{0U};
+    for (uint64_t shift = 32U; shift > 0U; shift >>= 1U)
+    {
+        if ((value >> shift) != 0U)
+        {
+            value >>= shift;
+            position += shift;
+        }
+    }
+    return position;
+}
+} // namespace
+
+uint64_t LatencyHistogram::Snapshot::numberOfSamples() const noexcept
+{
+    uint64_t numberOfSamples{0U};
+    for (const auto count : counts)
+    {
+        numberOfSamples += count;
+    }
+    return numberOfSamples;
+}
+
+uint64_t LatencyHistogram::Snapshot::percentile(const double percentile) const noexcept
+{
+    const uint64_t samples = numberOfSamples();
+    if (samples == 0U)
+    {
+        return 0U;
+    }
+
+    // the rank of the sample is rounded up and at least the first sample
+    const double exactRank = static_cast<double>(samples) * percentile / 100.0;
+    uint64_t rank = static_cast<uint64_t>(exactRank);
+    if (static_cast<double>(rank) < exactRank)
+    {
+        ++rank;
+    }
+    rank = (rank == 0U) ? 1U : rank;
+
+    uint64_t cumulatedCount{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        cumulatedCount += counts[i];
+        if (cumulatedCount >= rank)
+        {
+            return bucketUpperBound(i);
+        }
+    }
+    return bucketUpperBound(NUMBER_OF_BUCKETS - 1U);
+}
+
+uint64_t LatencyHistogram::Snapshot::max() const noexcept
+{
+    for (uint64_t i = NUMBER_OF_BUCKETS; i > 0U; --i)
+    {
+        if (counts[i - 1U] != 0U)
+        {
+            return bucketUpperBound(i - 1U);
+        }
+    }
+    return 0U;
+}
+
+LatencyHistogram::LatencyHistogram() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(const uint64_t latencyInNs) noexcept
+{
+    // only the counters themselves must be consistent, there is no data which is published with them
+    m_buckets[bucketIndex(latencyInNs)].fetch_add(1U, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const noexcept
+{
+    Snapshot snapshot;
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        snapshot.counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshotAndReset() noexcept
+{
+    Snapshot snapshot;
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        snapshot.counts[i] = m_buckets[i].exchange(0U, std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+uint64_t LatencyHistogram::bucketIndex(const uint64_t latencyInNs) noexcept
+{
+    if (latencyInNs < NUMBER_OF_SUB_BUCKETS)
+    {
+        return latencyInNs;
+    }
+
+    // the sub bucket is given by the SUB_BUCKET_BITS below the most significant bit
+    const uint64_t msb = mostSignificantBit(latencyInNs);
+    const uint64_t subBucket = (latencyInNs >> (msb - SUB_BUCKET_BITS)) & (NUMBER_OF_SUB_BUCKETS - 1U);
+    const uint64_t index = (msb - SUB_BUCKET_BITS + 1U) * NUMBER_OF_SUB_BUCKETS + subBucket;
+    return (index < NUMBER_OF_BUCKETS) ? index : NUMBER_OF_BUCKETS - 1U;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const uint64_t index) noexcept
+{
+    if (index < NUMBER_OF_SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    const uint64_t shift = (index >> SUB_BUCKET_BITS) - 1U;
+    const uint64_t subBucket = index & (NUMBER_OF_SUB_BUCKETS - 1U);
+    const uint64_t lowerBound = (NUMBER_OF_SUB_BUCKETS + subBucket) << shift;
+    return lowerBound + (static_cast<uint64_t>(1U) << shift) - 1U;
+}
+
+} // namespace popo
+} // namespace iox
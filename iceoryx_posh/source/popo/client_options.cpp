@@ -27,7 +27,8 @@ cxx::Serialization ClientOptions::serialize() const noexcept
                                       nodeName,
                                       connectOnCreate,
                                       static_cast<std::underlying_type_t<QueueFullPolicy>>(responseQueueFullPolicy),
-                                      static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(serverTooSlowPolicy));
+                                      static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(serverTooSlowPolicy),
+                                      maxRequestsInFlight);
 }
 
 cxx::expected<ClientOptions, cxx::Serialization::Error>
@@ -44,7 +45,8 @@ ClientOptions::deserialize(const cxx::Serialization& serialized) noexcept
                                                         clientOptions.nodeName,
                                                         clientOptions.connectOnCreate,
                                                         responseQueueFullPolicy,
-                                                        serverTooSlowPolicy);
+                                                        serverTooSlowPolicy,
+                                                        clientOptions.maxRequestsInFlight);
 
     if (!deserializationSuccessful
         || responseQueueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
@@ -62,7 +64,7 @@ bool ClientOptions::operator==(const ClientOptions& rhs) const noexcept
 {
     return responseQueueCapacity == rhs.responseQueueCapacity && nodeName == rhs.nodeName
            && connectOnCreate == rhs.connectOnCreate && responseQueueFullPolicy == rhs.responseQueueFullPolicy
-           && serverTooSlowPolicy == rhs.serverTooSlowPolicy;
+           && serverTooSlowPolicy == rhs.serverTooSlowPolicy && maxRequestsInFlight == rhs.maxRequestsInFlight;
 }
 } // namespace popo
 } // namespace iox
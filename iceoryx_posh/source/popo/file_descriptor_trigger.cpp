@@ -0,0 +1,206 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/file_descriptor_trigger.hpp"
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#if defined(__linux__)
+#include <poll.h>
+#endif
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+#if defined(__linux__)
+bool pollWithoutBlocking(const int32_t fileDescriptor, const int16_t events) noexcept
+{
+    pollfd pollFd{fileDescriptor, events, 0};
+    return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & events) != 0;
+}
+#endif
+} // namespace
+
+FileDescriptorTrigger::FileDescriptorTrigger(const int32_t fileDescriptor) noexcept
+    : m_fileDescriptor(fileDescriptor)
+{
+}
+
+FileDescriptorTrigger::~FileDescriptorTrigger() noexcept
+{
+    detach();
+}
+
+int32_t FileDescriptorTrigger::getFileDescriptor() const noexcept
+{
+    return m_fileDescriptor;
+}
+
+bool FileDescriptorTrigger::isReadable() const noexcept
+{
+#if defined(__linux__)
+    return pollWithoutBlocking(m_fileDescriptor, POLLIN);
+#else
+    return false;
+#endif
+}
+
+bool FileDescriptorTrigger::isWritable() const noexcept
+{
+#if defined(__linux__)
+    return pollWithoutBlocking(m_fileDescriptor, POLLOUT);
+#else
+    return false;
+#endif
+}
+
+bool FileDescriptorTrigger::hasTriggered() const noexcept
+{
+    return m_trigger.wasTriggered();
+}
+
+void FileDescriptorTrigger::enableEvent(TriggerHandle&& triggerHandle) noexcept
+{
+    enableEvent(std::move(triggerHandle), FileDescriptorEvent::READABLE);
+}
+
+void FileDescriptorTrigger::enableEvent(TriggerHandle&& triggerHandle,
+                                        const FileDescriptorEvent fileDescriptorEvent) noexcept
+{
+    attach(std::move(triggerHandle),
+           (fileDescriptorEvent == FileDescriptorEvent::READABLE) ? IoReactor::Readiness::READABLE
+                                                                  : IoReactor::Readiness::WRITABLE);
+}
+
+void FileDescriptorTrigger::disableEvent() noexcept
+{
+    detach();
+}
+
+void FileDescriptorTrigger::disableEvent(const FileDescriptorEvent) noexcept
+{
+    detach();
+}
+
+void FileDescriptorTrigger::enableState(TriggerHandle&& triggerHandle) noexcept
+{
+    enableState(std::move(triggerHandle), FileDescriptorState::READABLE);
+}
+
+void FileDescriptorTrigger::enableState(TriggerHandle&& triggerHandle,
+                                        const FileDescriptorState fileDescriptorState) noexcept
+{
+    attach(std::move(triggerHandle),
+           (fileDescriptorState == FileDescriptorState::READABLE) ? IoReactor::Readiness::READABLE
+                                                                  : IoReactor::Readiness::WRITABLE);
+}
+
+void FileDescriptorTrigger::disableState() noexcept
+{
+    detach();
+}
+
+void FileDescriptorTrigger::disableState(const FileDescriptorState) noexcept
+{
+    detach();
+}
+
+WaitSetIsConditionSatisfiedCallback FileDescriptorTrigger::getCallbackForIsStateConditionSatisfied() const noexcept
+{
+    return getCallbackForIsStateConditionSatisfied(FileDescriptorState::READABLE);
+}
+
+WaitSetIsConditionSatisfiedCallback FileDescriptorTrigger::getCallbackForIsStateConditionSatisfied(
+    const FileDescriptorState fileDescriptorState) const noexcept
+{
+    switch (fileDescriptorState)
+    {
+    case FileDescriptorState::READABLE:
+        return {*this, &FileDescriptorTrigger::isReadable};
+    case FileDescriptorState::WRITABLE:
+        return {*this, &FileDescriptorTrigger::isWritable};
+    }
+    return {};
+}
+
+void FileDescriptorTrigger::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        unwatch();
+        m_trigger.invalidate();
+    }
+}
+
+void FileDescriptorTrigger::attach(TriggerHandle&& triggerHandle, const IoReactor::Readiness readiness) noexcept
+{
+    if (m_trigger)
+    {
+        LogWarn() << "The FileDescriptorTrigger of the file descriptor " << m_fileDescriptor
+                  << " is already attached to a WaitSet/Listener. Detaching it from the previous one and attaching it "
+                     "to the new one. Best practice is to call detach first.";
+        errorHandler(PoshError::POPO__FILE_DESCRIPTOR_TRIGGER_OVERRIDING_ALREADY_ATTACHED_TRIGGER,
+                     ErrorLevel::MODERATE);
+    }
+    detach();
+
+    m_trigger = std::move(triggerHandle);
+    m_ioReactor = m_trigger.getIoReactor();
+    if (m_ioReactor == nullptr)
+    {
+        LogError() << "The file descriptor " << m_fileDescriptor << " cannot be watched without an IoReactor, the "
+                   << "FileDescriptorTrigger will never be triggered";
+        errorHandler(PoshError::POPO__IO_REACTOR_UNABLE_TO_WATCH_FILE_DESCRIPTOR, ErrorLevel::MODERATE);
+        return;
+    }
+
+    m_ioReactor->watch(m_fileDescriptor, readiness, {*this, &FileDescriptorTrigger::notify})
+        .and_then([&](auto& watchId) { m_watchId.emplace(watchId); })
+        .or_else([&](auto&) {
+            LogError() << "The file descriptor " << m_fileDescriptor << " cannot be watched, the "
+                       << "FileDescriptorTrigger will never be triggered";
+            errorHandler(PoshError::POPO__IO_REACTOR_UNABLE_TO_WATCH_FILE_DESCRIPTOR, ErrorLevel::MODERATE);
+        });
+}
+
+void FileDescriptorTrigger::detach() noexcept
+{
+    // the watch is removed first, afterwards the waiting thread does not access the TriggerHandle anymore
+    unwatch();
+    m_trigger.reset();
+}
+
+void FileDescriptorTrigger::unwatch() noexcept
+{
+    if (m_watchId.has_value())
+    {
+        m_ioReactor->unwatch(*m_watchId);
+        m_watchId.reset();
+    }
+    m_ioReactor = nullptr;
+}
+
+void FileDescriptorTrigger::notify() noexcept
+{
+    m_trigger.trigger();
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,381 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/io_reactor.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#if defined(__linux__)
+#include <algorithm>
+#include <limits>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+constexpr int32_t INVALID_FD{-1};
+} // namespace
+
+IoReactor::IoReactor(ConditionVariableData& condVarData) noexcept
+    : m_condVarDataPtr(&condVarData)
+{
+}
+
+IoReactor::~IoReactor() noexcept
+{
+    releaseConditionVariable();
+#if defined(__linux__)
+    const auto epollFd = m_epollFd.load(std::memory_order_relaxed);
+    if (epollFd != INVALID_FD)
+    {
+        IOX_DISCARD_RESULT(posix::posixCall(close)(epollFd).failureReturnValue(-1).evaluate());
+    }
+    if (m_deadlineTimerFd != INVALID_FD)
+    {
+        IOX_DISCARD_RESULT(posix::posixCall(close)(m_deadlineTimerFd).failureReturnValue(-1).evaluate());
+    }
+#endif
+}
+
+bool IoReactor::hasWatches() const noexcept
+{
+    return m_numberOfWatches.load(std::memory_order_acquire) > 0U;
+}
+
+void IoReactor::resetConditionSignal() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_conditionFileDescriptor)
+    {
+        m_conditionFileDescriptor->reset();
+    }
+    discardDeadlineExpiration();
+}
+
+void IoReactor::releaseConditionVariable() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // closing the socket removes it from the epoll instance as well
+    m_conditionFileDescriptor.reset();
+}
+
+#if defined(__linux__)
+namespace
+{
+uint32_t toEpollEvents(const IoReactor::Readiness readiness) noexcept
+{
+    return (readiness == IoReactor::Readiness::READABLE) ? EPOLLIN : EPOLLOUT;
+}
+} // namespace
+
+cxx::expected<uint64_t, IoReactorError>
+IoReactor::watch(const int32_t fileDescriptor, const Readiness readiness, const Callback_t& callback) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!createEpollInstance())
+    {
+        return cxx::error<IoReactorError>(IoReactorError::UNABLE_TO_WATCH_FILE_DESCRIPTOR);
+    }
+
+    for (uint64_t watchId = 0U; watchId < MAX_NUMBER_OF_IO_TRIGGERS; ++watchId)
+    {
+        if (m_watches[watchId].has_value())
+        {
+            continue;
+        }
+
+        m_watches[watchId].emplace(Watch{fileDescriptor, readiness, callback});
+        if (!updateEpollInstance(fileDescriptor))
+        {
+            m_watches[watchId].reset();
+            return cxx::error<IoReactorError>(IoReactorError::UNABLE_TO_WATCH_FILE_DESCRIPTOR);
+        }
+
+        // a thread which already blocks on the semaphore of the condition variable is woken up, so that it waits
+        // in epoll_wait from now on
+        if (m_numberOfWatches.fetch_add(1U, std::memory_order_release) == 0U)
+        {
+            IOX_DISCARD_RESULT(m_condVarDataPtr->m_semaphore.post());
+        }
+        return cxx::success<uint64_t>(watchId);
+    }
+
+    return cxx::error<IoReactorError>(IoReactorError::REACTOR_FULL);
+}
+
+void IoReactor::unwatch(const uint64_t watchId) noexcept
+{
+    if (watchId >= MAX_NUMBER_OF_IO_TRIGGERS)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_watches[watchId].has_value())
+    {
+        return;
+    }
+
+    const auto fileDescriptor = m_watches[watchId]->fileDescriptor;
+    m_watches[watchId].reset();
+    // the file descriptor may have been closed already, which removes it from the epoll instance implicitly
+    IOX_DISCARD_RESULT(updateEpollInstance(fileDescriptor));
+    m_numberOfWatches.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+void IoReactor::wait(const units::Duration& timeout) noexcept
+{
+    const auto epollFd = m_epollFd.load(std::memory_order_acquire);
+    if (epollFd == INVALID_FD)
+    {
+        return;
+    }
+
+    constexpr int32_t MAX_EVENTS_PER_WAIT{32};
+    epoll_event events[MAX_EVENTS_PER_WAIT];
+    int32_t timeoutInMs{-1};
+    if (timeout != units::Duration::max())
+    {
+        // rounded up, a timeout which is too short would let the caller spin until the deadline
+        constexpr uint64_t NANOSECONDS_PER_MILLISECOND{1000U * 1000U};
+        const uint64_t timeoutInNs = timeout.toNanoseconds();
+        timeoutInMs = static_cast<int32_t>(std::min(timeoutInNs / NANOSECONDS_PER_MILLISECOND
+                                                        + ((timeoutInNs % NANOSECONDS_PER_MILLISECOND != 0U) ? 1U : 0U),
+                                                    static_cast<uint64_t>(std::numeric_limits<int32_t>::max())));
+    }
+
+    auto result = posix::posixCall(epoll_wait)(epollFd, events, MAX_EVENTS_PER_WAIT, timeoutInMs)
+                      .failureReturnValue(-1)
+                      .ignoreErrnos(EINTR)
+                      .evaluate();
+    if (result.has_error())
+    {
+        errorHandler(PoshError::POPO__IO_REACTOR_WAIT_FAILED, ErrorLevel::FATAL);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (int32_t i = 0; i < result->value; ++i)
+    {
+        const int32_t fileDescriptor = events[i].data.fd;
+        // a hangup or an error is reported to the readers and the writers, they detect it on their next access
+        const uint32_t hangupEvents = ((events[i].events & (EPOLLERR | EPOLLHUP)) != 0U) ? (EPOLLIN | EPOLLOUT) : 0U;
+        const uint32_t readyEvents = events[i].events | hangupEvents;
+        // an event of a watch which was removed while epoll_wait returned only causes a spurious notification of
+        // a watch which reuses the file descriptor
+        for (auto& watch : m_watches)
+        {
+            if (watch.has_value() && watch->fileDescriptor == fileDescriptor
+                && (readyEvents & toEpollEvents(watch->readiness)) != 0U)
+            {
+                IOX_DISCARD_RESULT(watch->callback());
+            }
+        }
+    }
+
+    // the signal is discarded after the callbacks notified the condition variable, their notifications are
+    // collected anyway
+    if (m_conditionFileDescriptor)
+    {
+        m_conditionFileDescriptor->reset();
+    }
+    discardDeadlineExpiration();
+}
+
+void IoReactor::wakeUpAfter(const units::Duration& timeUntilDeadline) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_deadlineTimerFd == INVALID_FD)
+    {
+        return;
+    }
+
+    // an it_value of zero would disarm the timer, a deadline which is due expires after a nanosecond
+    itimerspec timerSpec{};
+    timerSpec.it_value = algorithm::max(timeUntilDeadline, units::Duration::fromNanoseconds(1U)).timespec();
+    IOX_DISCARD_RESULT(posix::posixCall(timerfd_settime)(m_deadlineTimerFd, 0, &timerSpec, nullptr)
+                           .failureReturnValue(-1)
+                           .evaluate());
+}
+
+void IoReactor::discardDeadlineExpiration() noexcept
+{
+    if (m_deadlineTimerFd != INVALID_FD)
+    {
+        uint64_t expirations{0U};
+        IOX_DISCARD_RESULT(read(m_deadlineTimerFd, &expirations, sizeof(expirations)));
+    }
+}
+
+cxx::expected<int32_t, IoReactorError> IoReactor::getFileDescriptor() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!createEpollInstance())
+    {
+        return cxx::error<IoReactorError>(IoReactorError::UNABLE_TO_WATCH_FILE_DESCRIPTOR);
+    }
+    return cxx::success<int32_t>(m_epollFd.load(std::memory_order_relaxed));
+}
+
+bool IoReactor::createEpollInstance() noexcept
+{
+    if (m_epollFd.load(std::memory_order_relaxed) != INVALID_FD)
+    {
+        return true;
+    }
+
+    auto conditionFileDescriptor = ConditionFileDescriptor::create(*m_condVarDataPtr);
+    if (conditionFileDescriptor.has_error())
+    {
+        return false;
+    }
+
+    auto epollCall = posix::posixCall(epoll_create1)(EPOLL_CLOEXEC).failureReturnValue(INVALID_FD).evaluate();
+    if (epollCall.has_error())
+    {
+        LogError() << "Unable to create the epoll instance: " << epollCall.get_error().getHumanReadableErrnum();
+        return false;
+    }
+    const int32_t epollFd = epollCall->value;
+
+    auto timerCall = posix::posixCall(timerfd_create)(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK)
+                         .failureReturnValue(INVALID_FD)
+                         .evaluate();
+    if (timerCall.has_error())
+    {
+        LogError() << "Unable to create the deadline timer: " << timerCall.get_error().getHumanReadableErrnum();
+        IOX_DISCARD_RESULT(posix::posixCall(close)(epollFd).failureReturnValue(-1).evaluate());
+        return false;
+    }
+    const int32_t deadlineTimerFd = timerCall->value;
+
+    // level triggered, they stay ready until the waiter resets them
+    for (const int32_t fileDescriptor : {conditionFileDescriptor->getFileDescriptor(), deadlineTimerFd})
+    {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fileDescriptor;
+        if (posix::posixCall(epoll_ctl)(epollFd, EPOLL_CTL_ADD, event.data.fd, &event)
+                .failureReturnValue(-1)
+                .evaluate()
+                .has_error())
+        {
+            IOX_DISCARD_RESULT(posix::posixCall(close)(deadlineTimerFd).failureReturnValue(-1).evaluate());
+            IOX_DISCARD_RESULT(posix::posixCall(close)(epollFd).failureReturnValue(-1).evaluate());
+            return false;
+        }
+    }
+
+    m_conditionFileDescriptor.emplace(std::move(conditionFileDescriptor.value()));
+    m_deadlineTimerFd = deadlineTimerFd;
+    m_epollFd.store(epollFd, std::memory_order_release);
+    return true;
+}
+
+bool IoReactor::updateEpollInstance(const int32_t fileDescriptor) noexcept
+{
+    uint32_t watchedEvents{0U};
+    for (const auto& watch : m_watches)
+    {
+        if (watch.has_value() && watch->fileDescriptor == fileDescriptor)
+        {
+            watchedEvents |= toEpollEvents(watch->readiness);
+        }
+    }
+
+    const auto epollFd = m_epollFd.load(std::memory_order_relaxed);
+    if (watchedEvents == 0U)
+    {
+        IOX_DISCARD_RESULT(posix::posixCall(epoll_ctl)(epollFd, EPOLL_CTL_DEL, fileDescriptor, nullptr)
+                               .failureReturnValue(-1)
+                               .suppressErrorMessagesForErrnos(EBADF, ENOENT)
+                               .evaluate());
+        return true;
+    }
+
+    // edge triggered, so that a file descriptor which is not drained by the user does not wake up the waiter
+    // continuously; a file descriptor which is already ready when it is added or modified is reported once
+    epoll_event event{};
+    event.events = watchedEvents | EPOLLET;
+    event.data.fd = fileDescriptor;
+    auto result = posix::posixCall(epoll_ctl)(epollFd, EPOLL_CTL_MOD, fileDescriptor, &event)
+                      .failureReturnValue(-1)
+                      .ignoreErrnos(ENOENT)
+                      .evaluate();
+    if (!result.has_error() && result->errnum == ENOENT)
+    {
+        result = posix::posixCall(epoll_ctl)(epollFd, EPOLL_CTL_ADD, fileDescriptor, &event)
+                     .failureReturnValue(-1)
+                     .evaluate();
+    }
+    if (result.has_error())
+    {
+        LogError() << "Unable to watch the file descriptor " << fileDescriptor << ": "
+                   << result.get_error().getHumanReadableErrnum();
+        return false;
+    }
+    return true;
+}
+#else
+cxx::expected<uint64_t, IoReactorError>
+IoReactor::watch(const int32_t, const Readiness, const Callback_t&) noexcept
+{
+    return cxx::error<IoReactorError>(IoReactorError::NOT_SUPPORTED);
+}
+
+void IoReactor::unwatch(const uint64_t) noexcept
+{
+}
+
+void IoReactor::wait(const units::Duration&) noexcept
+{
+}
+
+void IoReactor::wakeUpAfter(const units::Duration&) noexcept
+{
+}
+
+void IoReactor::discardDeadlineExpiration() noexcept
+{
+}
+
+cxx::expected<int32_t, IoReactorError> IoReactor::getFileDescriptor() noexcept
+{
+    return cxx::error<IoReactorError>(IoReactorError::NOT_SUPPORTED);
+}
+
+bool IoReactor::createEpollInstance() noexcept
+{
+    return false;
+}
+
+bool IoReactor::updateEpollInstance(const int32_t) noexcept
+{
+    return false;
+}
+#endif
+
+} // namespace popo
+} // namespace iox
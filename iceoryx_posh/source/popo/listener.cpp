@@ -26,8 +26,13 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariableData) noexcept
-    : Parent(conditionVariableData)
+Listener::Listener(const WaitOptions& waitOptions) noexcept
+    : Parent(waitOptions)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariableData, const WaitOptions& waitOptions) noexcept
+    : Parent(conditionVariableData, waitOptions)
 {
 }
 
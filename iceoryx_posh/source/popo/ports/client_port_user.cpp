@@ -50,7 +50,8 @@ ClientPortUser::allocateRequest(const uint32_t userPayloadSize, const uint32_t u
     }
 
     auto* requestHeader = new (allocateResult.value()->userHeader())
-        RequestHeader(getMembers()->m_chunkReceiverData.m_uniqueId, RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
+        RequestHeader(getMembers()->m_chunkReceiverData.m_uniqueId,
+                      getMembers()->m_lastKnownQueueIndex.load(std::memory_order_relaxed));
 
     return cxx::success<RequestHeader*>(requestHeader);
 }
@@ -124,8 +125,34 @@ cxx::expected<const ResponseHeader*, ChunkReceiveResult> ClientPortUser::getResp
         return cxx::error<ChunkReceiveResult>(getChunkResult.get_error());
     }
 
-    return cxx::success<const ResponseHeader*>(
-        static_cast<const ResponseHeader*>(getChunkResult.value()->userHeader()));
+    const auto* responseHeader = static_cast<const ResponseHeader*>(getChunkResult.value()->userHeader());
+    getMembers()->m_lastKnownQueueIndex.store(responseHeader->m_lastKnownClientQueueIndex, std::memory_order_relaxed);
+
+    return cxx::success<const ResponseHeader*>(responseHeader);
+}
+
+cxx::expected<uint64_t, ChunkReceiveResult>
+ClientPortUser::getResponses(const uint64_t maxNumberOfResponses,
+                             const cxx::function_ref<void(const ResponseHeader*)> onResponse) noexcept
+{
+    const ResponseHeader* lastResponseHeader{nullptr};
+    auto getChunksResult = m_chunkReceiver.tryGetMultiple(maxNumberOfResponses, [&](auto chunkHeader) {
+        lastResponseHeader = static_cast<const ResponseHeader*>(chunkHeader->userHeader());
+        onResponse(lastResponseHeader);
+    });
+
+    if (getChunksResult.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(getChunksResult.get_error());
+    }
+
+    if (lastResponseHeader != nullptr)
+    {
+        getMembers()->m_lastKnownQueueIndex.store(lastResponseHeader->m_lastKnownClientQueueIndex,
+                                                  std::memory_order_relaxed);
+    }
+
+    return cxx::success<uint64_t>(getChunksResult.value());
 }
 
 void ClientPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 
 namespace iox
 {
@@ -27,11 +28,22 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
                                      const PublisherOptions& publisherOptions,
                                      const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, publisherOptions.nodeName)
-    , m_chunkSenderData(
-          memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
+    , m_chunkSenderData(memoryManager,
+                        publisherOptions.subscriberTooSlowPolicy,
+                        publisherOptions.historyCapacity,
+                        memoryInfo,
+                        publisherOptions.inlineSamplePolicy == InlineSamplePolicy::ENABLED
+                            && publisherOptions.historyCapacity == 0U)
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
+    m_chunkSenderData.m_waitForConsumerTimeout = publisherOptions.waitForConsumerTimeout;
+    m_chunkSenderData.m_stampPublishTimestamp = publisherOptions.stampPublishTimestamp;
+
+    if (publisherOptions.inlineSamplePolicy == InlineSamplePolicy::ENABLED && publisherOptions.historyCapacity > 0U)
+    {
+        LogWarn() << "Inline samples are not supported for publishers with history! Inline samples are disabled.";
+    }
 }
 
 } // namespace popo
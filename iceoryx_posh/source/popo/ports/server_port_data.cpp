@@ -16,6 +16,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 
 namespace iox
 {
@@ -41,6 +43,17 @@ ServerPortData::ServerPortData(const capro::ServiceDescription& serviceDescripti
     , m_offeringRequested(serverOptions.offerOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(serverOptions.requestQueueCapacity);
+
+    if (serverOptions.maxRequestsInFlight > MAX_REQUESTS_IN_FLIGHT_PER_SERVER)
+    {
+        LogWarn() << "Requested " << serverOptions.maxRequestsInFlight
+                  << " requests in flight but the maximum is MAX_REQUESTS_IN_FLIGHT_PER_SERVER = "
+                  << MAX_REQUESTS_IN_FLIGHT_PER_SERVER << "! Limiting to " << MAX_REQUESTS_IN_FLIGHT_PER_SERVER;
+    }
+    const auto maxRequestsInFlight = static_cast<uint32_t>(
+        algorithm::min(serverOptions.maxRequestsInFlight, static_cast<uint64_t>(MAX_REQUESTS_IN_FLIGHT_PER_SERVER)));
+    // one request more than the requests in flight can be taken, see ChunkReceiverData::MAX_CHUNKS_IN_USE
+    m_chunkReceiverData.m_chunksInUse.setLimit(maxRequestsInFlight + 1U);
 }
 
 } // namespace popo
@@ -55,6 +55,26 @@ cxx::expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequ
     return cxx::success<const RequestHeader*>(static_cast<const RequestHeader*>(getChunkResult.value()->userHeader()));
 }
 
+cxx::expected<uint64_t, ServerRequestResult>
+ServerPortUser::getRequests(const uint64_t maxNumberOfRequests,
+                            const cxx::function_ref<void(const RequestHeader*)> onRequest) noexcept
+{
+    auto getChunksResult = m_chunkReceiver.tryGetMultiple(maxNumberOfRequests, [&](auto chunkHeader) {
+        onRequest(static_cast<const RequestHeader*>(chunkHeader->userHeader()));
+    });
+
+    if (getChunksResult.has_error())
+    {
+        if (!isOffered())
+        {
+            return cxx::error<ServerRequestResult>(ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER);
+        }
+        return cxx::error<ServerRequestResult>(cxx::into<ServerRequestResult>(getChunksResult.get_error()));
+    }
+
+    return cxx::success<uint64_t>(getChunksResult.value());
+}
+
 void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
     if (requestHeader != nullptr)
@@ -93,6 +113,7 @@ ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
         return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
     }
 
+    ResponseLockGuard_t lock(getMembers()->m_responseLock);
     auto allocateResult = m_chunkSender.tryAllocate(
         getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(ResponseHeader), alignof(ResponseHeader));
 
@@ -113,6 +134,7 @@ void ServerPortUser::releaseResponse(const ResponseHeader* const responseHeader)
 {
     if (responseHeader != nullptr)
     {
+        ResponseLockGuard_t lock(getMembers()->m_responseLock);
         m_chunkSender.release(responseHeader->getChunkHeader());
     }
     else
@@ -139,7 +161,12 @@ cxx::expected<ServerSendError> ServerPortUser::sendResponse(ResponseHeader* cons
         return cxx::error<ServerSendError>(ServerSendError::NOT_OFFERED);
     }
 
+    // the lock is also held while waiting for a slow client, since the ChunkSender state must not be modified by
+    // another thread in the meantime; RouDi is not blocked by this lock
+    ResponseLockGuard_t lock(getMembers()->m_responseLock);
     bool responseSent{false};
+    // the lookup does not need the lock of the ChunkDistributor if the client sent a valid queue index; the resolved
+    // index is stored in the response to be used by the client for the next requests
     m_chunkSender.getQueueIndex(responseHeader->m_uniqueClientQueueId, responseHeader->m_lastKnownClientQueueIndex)
         .and_then([&](auto queueIndex) {
             responseHeader->m_lastKnownClientQueueIndex = queueIndex;
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 
 namespace iox
@@ -33,6 +34,13 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(subscriberOptions.queueCapacity);
+    m_chunkReceiverData.m_inlineQueue.setCapacity(
+        algorithm::min(subscriberOptions.queueCapacity, static_cast<uint64_t>(MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY)));
+    m_chunkReceiverData.m_notificationPolicy = subscriberOptions.notificationPolicy;
+    m_chunkReceiverData.m_notificationThreshold =
+        algorithm::max(subscriberOptions.notificationThreshold, static_cast<uint64_t>(1U));
+    m_chunkReceiverData.m_minNotificationInterval = subscriberOptions.minNotificationInterval;
+    m_chunkReceiverData.m_maxNotificationDelay = subscriberOptions.maxNotificationDelay;
 }
 
 } // namespace popo
@@ -69,6 +69,13 @@ cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser:
     return m_chunkReceiver.tryGet();
 }
 
+cxx::expected<uint64_t, ChunkReceiveResult>
+SubscriberPortUser::tryGetChunks(const uint64_t maxNumberOfChunks,
+                                 const cxx::function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept
+{
+    return m_chunkReceiver.tryGetMultiple(maxNumberOfChunks, onChunk);
+}
+
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkReceiver.release(chunkHeader);
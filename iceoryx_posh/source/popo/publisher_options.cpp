@@ -17,39 +17,63 @@
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
+#include <limits>
+
 namespace iox
 {
 namespace popo
 {
 cxx::Serialization PublisherOptions::serialize() const noexcept
 {
+    // an infinite timeout saturates to the maximum of uint64_t which cannot be deserialized, therefore it is
+    // serialized as flag
+    const auto waitForConsumerTimeoutNs = waitForConsumerTimeout.toNanoseconds();
+    const bool hasWaitForConsumerTimeout = (waitForConsumerTimeoutNs != std::numeric_limits<uint64_t>::max());
+
     return cxx::Serialization::create(
         historyCapacity,
         nodeName,
         offerOnCreate,
-        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+        static_cast<std::underlying_type_t<InlineSamplePolicy>>(inlineSamplePolicy),
+        hasWaitForConsumerTimeout,
+        hasWaitForConsumerTimeout ? waitForConsumerTimeoutNs : 0U,
+        stampPublishTimestamp);
 }
 
 cxx::expected<PublisherOptions, cxx::Serialization::Error>
 PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
 {
     using ConsumerTooSlowPolicyUT = std::underlying_type_t<ConsumerTooSlowPolicy>;
+    using InlineSamplePolicyUT = std::underlying_type_t<InlineSamplePolicy>;
 
     PublisherOptions publisherOptions;
     ConsumerTooSlowPolicyUT subscriberTooSlowPolicy;
+    InlineSamplePolicyUT inlineSamplePolicy;
+    bool hasWaitForConsumerTimeout{false};
+    uint64_t waitForConsumerTimeoutNs{0U};
 
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        inlineSamplePolicy,
+                                                        hasWaitForConsumerTimeout,
+                                                        waitForConsumerTimeoutNs,
+                                                        publisherOptions.stampPublishTimestamp);
 
     if (!deserializationSuccessful
-        || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
+        || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+        || inlineSamplePolicy > static_cast<InlineSamplePolicyUT>(InlineSamplePolicy::AUTOMATIC))
     {
         return cxx::error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
     }
 
     publisherOptions.subscriberTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
+    publisherOptions.inlineSamplePolicy = static_cast<InlineSamplePolicy>(inlineSamplePolicy);
+    publisherOptions.waitForConsumerTimeout = hasWaitForConsumerTimeout
+                                                  ? units::Duration::fromNanoseconds(waitForConsumerTimeoutNs)
+                                                  : units::Duration::max();
     return cxx::success<PublisherOptions>(publisherOptions);
 }
 } // namespace popo
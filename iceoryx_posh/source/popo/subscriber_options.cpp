@@ -28,31 +28,47 @@ cxx::Serialization SubscriberOptions::serialize() const noexcept
                                       nodeName,
                                       subscribeOnCreate,
                                       static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
-                                      requiresPublisherHistorySupport);
+                                      requiresPublisherHistorySupport,
+                                      static_cast<std::underlying_type_t<QueueNotificationPolicy>>(notificationPolicy),
+                                      notificationThreshold,
+                                      minNotificationInterval.toNanoseconds(),
+                                      maxNotificationDelay.toNanoseconds());
 }
 
 cxx::expected<SubscriberOptions, cxx::Serialization::Error>
 SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
 {
     using QueueFullPolicyUT = std::underlying_type_t<QueueFullPolicy>;
+    using QueueNotificationPolicyUT = std::underlying_type_t<QueueNotificationPolicy>;
 
     SubscriberOptions subscriberOptions;
     QueueFullPolicyUT queueFullPolicy;
+    QueueNotificationPolicyUT notificationPolicy;
+    uint64_t minNotificationIntervalNs;
+    uint64_t maxNotificationDelayNs;
 
     auto deserializationSuccessful = serialized.extract(subscriberOptions.queueCapacity,
                                                         subscriberOptions.historyRequest,
                                                         subscriberOptions.nodeName,
                                                         subscriberOptions.subscribeOnCreate,
                                                         queueFullPolicy,
-                                                        subscriberOptions.requiresPublisherHistorySupport);
+                                                        subscriberOptions.requiresPublisherHistorySupport,
+                                                        notificationPolicy,
+                                                        subscriberOptions.notificationThreshold,
+                                                        minNotificationIntervalNs,
+                                                        maxNotificationDelayNs);
 
     if (!deserializationSuccessful
-        || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA))
+        || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
+        || notificationPolicy > static_cast<QueueNotificationPolicyUT>(QueueNotificationPolicy::AFTER_MIN_INTERVAL))
     {
         return cxx::error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
     }
 
     subscriberOptions.queueFullPolicy = static_cast<QueueFullPolicy>(queueFullPolicy);
+    subscriberOptions.notificationPolicy = static_cast<QueueNotificationPolicy>(notificationPolicy);
+    subscriberOptions.minNotificationInterval = units::Duration::fromNanoseconds(minNotificationIntervalNs);
+    subscriberOptions.maxNotificationDelay = units::Duration::fromNanoseconds(maxNotificationDelayNs);
     return cxx::success<SubscriberOptions>(subscriberOptions);
 }
 } // namespace popo
@@ -0,0 +1,193 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/io_reactor.hpp"
+
+#if defined(__linux__)
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace iox
+{
+namespace popo
+{
+TimerTrigger::TimerTrigger(const units::Duration interval, const TimerMode mode) noexcept
+    : m_interval(interval)
+    , m_mode(mode)
+{
+#if defined(__linux__)
+    posix::posixCall(timerfd_create)(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK)
+        .failureReturnValue(-1)
+        .evaluate()
+        .and_then([&](auto& r) { m_timerFd = r.value; })
+        .or_else([](auto& r) { LogError() << "Unable to create the timerfd: " << r.getHumanReadableErrnum(); });
+#endif
+}
+
+TimerTrigger::~TimerTrigger() noexcept
+{
+    detach();
+#if defined(__linux__)
+    if (m_timerFd != -1)
+    {
+        IOX_DISCARD_RESULT(posix::posixCall(close)(m_timerFd).failureReturnValue(-1).evaluate());
+    }
+#endif
+}
+
+cxx::expected<TimerTriggerError> TimerTrigger::start() noexcept
+{
+#if defined(__linux__)
+    if (m_timerFd == -1)
+    {
+        return cxx::error<TimerTriggerError>(TimerTriggerError::UNABLE_TO_CREATE_TIMER);
+    }
+    // an it_value of zero would disarm the timer
+    if (m_interval == units::Duration::fromNanoseconds(0U))
+    {
+        return cxx::error<TimerTriggerError>(TimerTriggerError::INVALID_INTERVAL);
+    }
+
+    itimerspec timerSpec{};
+    timerSpec.it_value = m_interval.timespec();
+    if (m_mode == TimerMode::PERIODIC)
+    {
+        timerSpec.it_interval = m_interval.timespec();
+    }
+    if (posix::posixCall(timerfd_settime)(m_timerFd, 0, &timerSpec, nullptr)
+            .failureReturnValue(-1)
+            .evaluate()
+            .has_error())
+    {
+        return cxx::error<TimerTriggerError>(TimerTriggerError::UNABLE_TO_CREATE_TIMER);
+    }
+    return cxx::success<>();
+#else
+    return cxx::error<TimerTriggerError>(TimerTriggerError::NOT_SUPPORTED);
+#endif
+}
+
+void TimerTrigger::stop() noexcept
+{
+#if defined(__linux__)
+    if (m_timerFd != -1)
+    {
+        // disarming the timer discards the expirations which the waiting thread has not read yet
+        if (readExpirations())
+        {
+            m_trigger.trigger();
+        }
+
+        itimerspec timerSpec{};
+        IOX_DISCARD_RESULT(
+            posix::posixCall(timerfd_settime)(m_timerFd, 0, &timerSpec, nullptr).failureReturnValue(-1).evaluate());
+    }
+#endif
+}
+
+uint64_t TimerTrigger::takeExpirations() noexcept
+{
+    return m_expirations.exchange(0U, std::memory_order_relaxed);
+}
+
+bool TimerTrigger::hasTriggered() const noexcept
+{
+    return m_trigger.wasTriggered();
+}
+
+void TimerTrigger::enableEvent(TriggerHandle&& triggerHandle) noexcept
+{
+    detach();
+    m_trigger = std::move(triggerHandle);
+    m_ioReactor = m_trigger.getIoReactor();
+    if (m_ioReactor == nullptr)
+    {
+        LogError() << "The timer cannot be watched without an IoReactor, the TimerTrigger will never be triggered";
+        errorHandler(PoshError::POPO__IO_REACTOR_UNABLE_TO_WATCH_FILE_DESCRIPTOR, ErrorLevel::MODERATE);
+        return;
+    }
+
+    m_ioReactor->watch(m_timerFd, IoReactor::Readiness::READABLE, {*this, &TimerTrigger::notify})
+        .and_then([&](auto& watchId) { m_watchId.emplace(watchId); })
+        .or_else([&](auto&) {
+            LogError() << "The timer cannot be watched, the TimerTrigger will never be triggered";
+            errorHandler(PoshError::POPO__IO_REACTOR_UNABLE_TO_WATCH_FILE_DESCRIPTOR, ErrorLevel::MODERATE);
+        });
+}
+
+void TimerTrigger::disableEvent() noexcept
+{
+    detach();
+}
+
+void TimerTrigger::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        unwatch();
+        m_trigger.invalidate();
+    }
+}
+
+void TimerTrigger::detach() noexcept
+{
+    // the watch is removed first, afterwards the waiting thread does not access the TriggerHandle anymore
+    unwatch();
+    m_trigger.reset();
+}
+
+void TimerTrigger::unwatch() noexcept
+{
+    if (m_watchId.has_value())
+    {
+        m_ioReactor->unwatch(*m_watchId);
+        m_watchId.reset();
+    }
+    m_ioReactor = nullptr;
+}
+
+void TimerTrigger::notify() noexcept
+{
+    // the timerfd must be drained since it is watched edge triggered
+    if (readExpirations())
+    {
+        m_trigger.trigger();
+    }
+}
+
+bool TimerTrigger::readExpirations() noexcept
+{
+#if defined(__linux__)
+    uint64_t expirations{0U};
+    if (read(m_timerFd, &expirations, sizeof(expirations)) != static_cast<ssize_t>(sizeof(expirations)))
+    {
+        return false;
+    }
+    m_expirations.fetch_add(expirations, std::memory_order_relaxed);
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace popo
+} // namespace iox
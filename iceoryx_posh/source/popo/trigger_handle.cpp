@@ -28,8 +28,10 @@ TriggerHandle::TriggerHandle() noexcept
 
 TriggerHandle::TriggerHandle(ConditionVariableData& conditionVariableData,
                              const cxx::MethodCallback<void, uint64_t> resetCallback,
-                             const uint64_t uniqueTriggerId) noexcept
+                             const uint64_t uniqueTriggerId,
+                             IoReactor* const ioReactor) noexcept
     : m_conditionVariableDataPtr(&conditionVariableData)
+    , m_ioReactor(ioReactor)
     , m_resetCallback(resetCallback)
     , m_uniqueTriggerId(uniqueTriggerId)
 {
@@ -55,6 +57,7 @@ TriggerHandle& TriggerHandle::operator=(TriggerHandle&& rhs) noexcept
         reset();
 
         m_conditionVariableDataPtr = rhs.m_conditionVariableDataPtr;
+        m_ioReactor = rhs.m_ioReactor;
         m_resetCallback = std::move(rhs.m_resetCallback);
         m_uniqueTriggerId = rhs.m_uniqueTriggerId;
 
@@ -121,6 +124,7 @@ void TriggerHandle::invalidate() noexcept
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     m_conditionVariableDataPtr = nullptr;
+    m_ioReactor = nullptr;
     m_resetCallback = cxx::MethodCallback<void, uint64_t>();
     m_uniqueTriggerId = Trigger::INVALID_TRIGGER_ID;
 }
@@ -132,6 +136,13 @@ ConditionVariableData* TriggerHandle::getConditionVariableData() noexcept
     return m_conditionVariableDataPtr;
 }
 
+IoReactor* TriggerHandle::getIoReactor() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    return m_ioReactor;
+}
+
 uint64_t TriggerHandle::getUniqueId() const noexcept
 {
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
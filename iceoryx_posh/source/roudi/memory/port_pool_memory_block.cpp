@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/roudi/memory/port_pool_memory_block.hpp"
 
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
@@ -25,6 +26,38 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+template <typename T, uint64_t Capacity>
+void logFootprint(const char* const name, const FixedPositionContainer<T, Capacity>&) noexcept
+{
+    LogDebug() << "  " << name << ": " << Capacity << " x " << sizeof(T) << " bytes = " << Capacity * sizeof(T)
+               << " bytes";
+}
+
+/// @brief the per-port additions which can be disabled with a build option, in order to see what they cost
+void logOptionalFootprint() noexcept
+{
+    using SubscriberChunkReceiverData_t = popo::SubscriberPortData::ChunkReceiverData_t;
+    using PublisherChunkSenderData_t = popo::PublisherPortData::ChunkSenderData_t;
+
+    constexpr uint64_t INLINE_SAMPLES_PER_SUBSCRIBER{
+        (MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY > 0U)
+            ? sizeof(SubscriberChunkReceiverData_t::InlineQueue_t)
+                  + sizeof(decltype(SubscriberChunkReceiverData_t::m_inlineChunksInUse))
+            : 0U};
+    constexpr uint64_t INLINE_SAMPLES_PER_PUBLISHER{
+        (MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY > 0U) ? sizeof(PublisherChunkSenderData_t::InlineChunkSlots_t) : 0U};
+    constexpr uint64_t TAKE_LATENCY_HISTOGRAM_PER_PORT{
+        TAKE_LATENCY_HISTOGRAM ? sizeof(SubscriberChunkReceiverData_t::TakeLatencyHistogram_t) : 0U};
+
+    LogDebug() << "  inline samples (IOX_MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY): " << INLINE_SAMPLES_PER_SUBSCRIBER
+               << " bytes per subscriber port and " << INLINE_SAMPLES_PER_PUBLISHER << " bytes per publisher port";
+    LogDebug() << "  take latency histogram (TAKE_LATENCY_HISTOGRAM): " << TAKE_LATENCY_HISTOGRAM_PER_PORT
+               << " bytes per subscriber, client and server port";
+}
+} // namespace
+
 PortPoolMemoryBlock::~PortPoolMemoryBlock() noexcept
 {
     destroy();
@@ -43,6 +76,17 @@ uint64_t PortPoolMemoryBlock::alignment() const noexcept
 void PortPoolMemoryBlock::onMemoryAvailable(cxx::not_null<void*> memory) noexcept
 {
     m_portPoolData = new (memory) PortPoolData;
+
+    // every slot reserves the maximum capacities of the deployment, see the IOX_MAX_* CMake options to reduce them
+    LogInfo() << "The port pool occupies " << sizeof(PortPoolData) << " bytes of the management segment";
+    logFootprint("publisher ports", m_portPoolData->m_publisherPortMembers);
+    logFootprint("subscriber ports", m_portPoolData->m_subscriberPortMembers);
+    logFootprint("server ports", m_portPoolData->m_serverPortMembers);
+    logFootprint("client ports", m_portPoolData->m_clientPortMembers);
+    logFootprint("interface ports", m_portPoolData->m_interfacePortMembers);
+    logFootprint("nodes", m_portPoolData->m_nodeMembers);
+    logFootprint("condition variables", m_portPoolData->m_conditionVariableMembers);
+    logOptionalFootprint();
 }
 
 void PortPoolMemoryBlock::destroy() noexcept
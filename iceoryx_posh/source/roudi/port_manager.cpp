@@ -30,6 +30,27 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+/// @brief number of ports which are destroyed together; bounds the stack usage for the pending CaPro messages
+constexpr uint64_t PORT_DESTRUCTION_BATCH_SIZE{32U};
+
+/// @brief a port which is destroyed together with other ports and whose CaPro message is not yet fully distributed
+template <typename PortData>
+struct PendingCaproMessage
+{
+    PendingCaproMessage(PortData* const portData, const cxx::optional<capro::CaproMessage>& message) noexcept
+        : portData(portData)
+        , message(message)
+    {
+    }
+
+    PortData* portData{nullptr};
+    cxx::optional<capro::CaproMessage> message;
+    bool isDistributionFinished{false};
+};
+} // namespace
+
 capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
 {
     int32_t i{0};
@@ -514,25 +535,31 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
         {
-            auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
-            if (publisherResponse.has_value())
-            {
-                // send response to subscriber port
-                auto returnMessage =
-                    subscriberSource.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value());
-
-                // ACK or NACK are sent back to the subscriber port, no further response from this one expected
-                cxx::Ensures(!returnMessage.has_value());
-
-                // inform introspection
-                m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
-            }
+            dispatchToPublisherPort(message, subscriberSource, publisherPort);
             publisherFound = true;
         }
     }
     return publisherFound;
 }
 
+void PortManager::dispatchToPublisherPort(const capro::CaproMessage& message,
+                                          SubscriberPortType& subscriberSource,
+                                          PublisherPortRouDiType& publisherPort) noexcept
+{
+    auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
+    if (publisherResponse.has_value())
+    {
+        // send response to subscriber port
+        auto returnMessage = subscriberSource.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value());
+
+        // ACK or NACK are sent back to the subscriber port, no further response from this one expected
+        cxx::Ensures(!returnMessage.has_value());
+
+        // inform introspection
+        m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
+    }
+}
+
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
@@ -552,32 +579,37 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
         {
-            auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
+            dispatchToSubscriberPort(message, publisherSource, subscriberPort);
+        }
+    }
+}
 
-            // if the subscribers react on the change, process it immediately on publisher side
-            if (subscriberResponse.has_value())
-            {
-                // we only expect reaction on OFFER
-                cxx::Expects(capro::CaproMessageType::OFFER == message.m_type);
+void PortManager::dispatchToSubscriberPort(const capro::CaproMessage& message,
+                                           PublisherPortRouDiType& publisherSource,
+                                           SubscriberPortType& subscriberPort) noexcept
+{
+    auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
 
-                // inform introspection
-                m_portIntrospection.reportMessage(subscriberResponse.value());
+    // if the subscribers react on the change, process it immediately on publisher side
+    if (subscriberResponse.has_value())
+    {
+        // we only expect reaction on OFFER
+        cxx::Expects(capro::CaproMessageType::OFFER == message.m_type);
 
-                auto publisherResponse =
-                    publisherSource.dispatchCaProMessageAndGetPossibleResponse(subscriberResponse.value());
-                if (publisherResponse.has_value())
-                {
-                    // sende responsee to subscriber port
-                    auto returnMessage =
-                        subscriberPort.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value());
+        // inform introspection
+        m_portIntrospection.reportMessage(subscriberResponse.value());
 
-                    // ACK or NACK are sent back to the subscriber port, no further response from this one expected
-                    cxx::Ensures(!returnMessage.has_value());
+        auto publisherResponse = publisherSource.dispatchCaProMessageAndGetPossibleResponse(subscriberResponse.value());
+        if (publisherResponse.has_value())
+        {
+            // sende responsee to subscriber port
+            auto returnMessage = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value());
 
-                    // inform introspection
-                    m_portIntrospection.reportMessage(publisherResponse.value());
-                }
-            }
+            // ACK or NACK are sent back to the subscriber port, no further response from this one expected
+            cxx::Ensures(!returnMessage.has_value());
+
+            // inform introspection
+            m_portIntrospection.reportMessage(publisherResponse.value());
         }
     }
 }
@@ -725,68 +757,36 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     {
         m_serviceRegistryPublisherPortData.reset();
     }
-    for (auto port : m_portPool->getPublisherPortDataList())
-    {
-        PublisherPortRouDiType sender(port);
-        if (runtimeName == sender.getRuntimeName())
-        {
-            destroyPublisherPort(port);
-        }
-    }
+    destroyPublisherPorts(m_portPool->getPublisherPortDataList(runtimeName));
 
-    for (auto port : m_portPool->getSubscriberPortDataList())
-    {
-        SubscriberPortUserType subscriber(port);
-        if (runtimeName == subscriber.getRuntimeName())
-        {
-            destroySubscriberPort(port);
-        }
-    }
+    destroySubscriberPorts(m_portPool->getSubscriberPortDataList(runtimeName));
 
-    for (auto port : m_portPool->getServerPortDataList())
+    for (auto port : m_portPool->getServerPortDataList(runtimeName))
     {
-        popo::ServerPortRouDi server(*port);
-        if (runtimeName == server.getRuntimeName())
-        {
-            destroyServerPort(port);
-        }
+        destroyServerPort(port);
     }
 
-    for (auto port : m_portPool->getClientPortDataList())
+    for (auto port : m_portPool->getClientPortDataList(runtimeName))
     {
-        popo::ClientPortRouDi client(*port);
-        if (runtimeName == client.getRuntimeName())
-        {
-            destroyClientPort(port);
-        }
+        destroyClientPort(port);
     }
 
-    for (auto port : m_portPool->getInterfacePortDataList())
+    for (auto port : m_portPool->getInterfacePortDataList(runtimeName))
     {
-        popo::InterfacePort interface(port);
-        if (runtimeName == interface.getRuntimeName())
-        {
-            m_portPool->removeInterfacePort(port);
-            LogDebug() << "Deleted Interface of application " << runtimeName;
-        }
+        m_portPool->removeInterfacePort(port);
+        LogDebug() << "Deleted Interface of application " << runtimeName;
     }
 
-    for (auto nodeData : m_portPool->getNodeDataList())
+    for (auto nodeData : m_portPool->getNodeDataList(runtimeName))
     {
-        if (runtimeName == nodeData->m_runtimeName)
-        {
-            m_portPool->removeNodeData(nodeData);
-            LogDebug() << "Deleted node of application " << runtimeName;
-        }
+        m_portPool->removeNodeData(nodeData);
+        LogDebug() << "Deleted node of application " << runtimeName;
     }
 
-    for (auto conditionVariableData : m_portPool->getConditionVariableDataList())
+    for (auto conditionVariableData : m_portPool->getConditionVariableDataList(runtimeName))
     {
-        if (runtimeName == conditionVariableData->m_runtimeName)
-        {
-            m_portPool->removeConditionVariableData(conditionVariableData);
-            LogDebug() << "Deleted condition variable of application" << runtimeName;
-        }
+        m_portPool->removeConditionVariableData(conditionVariableData);
+        LogDebug() << "Deleted condition variable of application" << runtimeName;
     }
 }
 
@@ -844,6 +844,137 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
+void PortManager::destroyPublisherPorts(
+    const cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>& publisherPortDataList) noexcept
+{
+    for (uint64_t batchBegin = 0U; batchBegin < publisherPortDataList.size(); batchBegin += PORT_DESTRUCTION_BATCH_SIZE)
+    {
+        cxx::vector<PendingCaproMessage<PublisherPortRouDiType::MemberType_t>, PORT_DESTRUCTION_BATCH_SIZE> batch;
+        for (uint64_t i = batchBegin; i < publisherPortDataList.size() && batch.size() < batch.capacity(); ++i)
+        {
+            auto publisherPortData = publisherPortDataList[i];
+            PublisherPortUserType(publisherPortData).stopOffer();
+
+            auto caproMessage = PublisherPortRouDiType(publisherPortData).tryGetCaProMessage();
+            caproMessage.and_then([this](auto& message) {
+                cxx::Ensures(message.m_type == capro::CaproMessageType::STOP_OFFER);
+
+                m_portIntrospection.reportMessage(message);
+                this->removePublisherFromServiceRegistry(message.m_serviceDescription);
+            });
+            batch.emplace_back(publisherPortData, caproMessage);
+        }
+
+        // distribute the STOP_OFFER of the whole batch with a single pass over the subscriber ports; the matching rules
+        // are the same as in sendToAllMatchingSubscriberPorts
+        for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+        {
+            SubscriberPortType subscriberPort(subscriberPortData);
+            auto subscriberInterface = subscriberPort.getCaProServiceDescription().getSourceInterface();
+
+            for (auto& pending : batch)
+            {
+                if (!pending.message.has_value() || pending.isDistributionFinished)
+                {
+                    continue;
+                }
+
+                const auto& message = pending.message.value();
+                if (subscriberInterface != capro::Interfaces::INTERNAL
+                    && subscriberInterface == message.m_serviceDescription.getSourceInterface())
+                {
+                    pending.isDistributionFinished = true;
+                    continue;
+                }
+
+                PublisherPortRouDiType publisherPort(pending.portData);
+                if (isCompatiblePubSub(publisherPort, subscriberPort))
+                {
+                    dispatchToSubscriberPort(message, publisherPort, subscriberPort);
+                }
+            }
+        }
+
+        for (auto& pending : batch)
+        {
+            // like in destroyPublisherPort, the interface ports get the STOP_OFFER after the subscribers
+            pending.message.and_then([this](auto& message) { this->sendToAllMatchingInterfacePorts(message); });
+
+            PublisherPortRouDiType(pending.portData).releaseAllChunks();
+            m_portIntrospection.removePublisher(PublisherPortUserType(pending.portData));
+
+            LogDebug() << "Destroy publisher port from runtime '" << pending.portData->m_runtimeName
+                       << "' and with service description '" << pending.portData->m_serviceDescription << "'";
+            // delete publisher port from list after STOP_OFFER was processed
+            m_portPool->removePublisherPort(pending.portData);
+        }
+    }
+}
+
+void PortManager::destroySubscriberPorts(
+    const cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>& subscriberPortDataList) noexcept
+{
+    for (uint64_t batchBegin = 0U; batchBegin < subscriberPortDataList.size();
+         batchBegin += PORT_DESTRUCTION_BATCH_SIZE)
+    {
+        cxx::vector<PendingCaproMessage<SubscriberPortType::MemberType_t>, PORT_DESTRUCTION_BATCH_SIZE> batch;
+        for (uint64_t i = batchBegin; i < subscriberPortDataList.size() && batch.size() < batch.capacity(); ++i)
+        {
+            auto subscriberPortData = subscriberPortDataList[i];
+            SubscriberPortUserType(subscriberPortData).unsubscribe();
+
+            auto caproMessage = SubscriberPortType(subscriberPortData).tryGetCaProMessage();
+            caproMessage.and_then([this](auto& message) {
+                cxx::Ensures(message.m_type == capro::CaproMessageType::UNSUB);
+
+                m_portIntrospection.reportMessage(message);
+            });
+            batch.emplace_back(subscriberPortData, caproMessage);
+        }
+
+        // distribute the UNSUB of the whole batch with a single pass over the publisher ports; the matching rules are
+        // the same as in sendToAllMatchingPublisherPorts
+        for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+        {
+            PublisherPortRouDiType publisherPort(publisherPortData);
+            auto publisherInterface = publisherPort.getCaProServiceDescription().getSourceInterface();
+
+            for (auto& pending : batch)
+            {
+                if (!pending.message.has_value() || pending.isDistributionFinished)
+                {
+                    continue;
+                }
+
+                const auto& message = pending.message.value();
+                if (publisherInterface != capro::Interfaces::INTERNAL
+                    && publisherInterface == message.m_serviceDescription.getSourceInterface())
+                {
+                    pending.isDistributionFinished = true;
+                    continue;
+                }
+
+                SubscriberPortType subscriberPort(pending.portData);
+                if (isCompatiblePubSub(publisherPort, subscriberPort))
+                {
+                    dispatchToPublisherPort(message, subscriberPort, publisherPort);
+                }
+            }
+        }
+
+        for (auto& pending : batch)
+        {
+            SubscriberPortType(pending.portData).releaseAllChunks();
+            m_portIntrospection.removeSubscriber(SubscriberPortUserType(pending.portData));
+
+            LogDebug() << "Destroy subscriber port from runtime '" << pending.portData->m_runtimeName
+                       << "' and with service description '" << pending.portData->m_serviceDescription << "'";
+            // delete subscriber port from list after UNSUB was processed
+            m_portPool->removeSubscriberPort(pending.portData);
+        }
+    }
+}
+
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       const popo::PublisherOptions& publisherOptions,
@@ -28,28 +28,48 @@ PortPool::PortPool(PortPoolData& portPoolData) noexcept
 {
 }
 
-cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> PortPool::getInterfacePortDataList() noexcept
+FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER>::Content
+PortPool::getInterfacePortDataList() noexcept
 {
     return m_portPoolData->m_interfacePortMembers.content();
 }
 
-cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> PortPool::getNodeDataList() noexcept
+FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER>::Content PortPool::getNodeDataList() noexcept
 {
     return m_portPoolData->m_nodeMembers.content();
 }
 
-cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES>::Content
 PortPool::getConditionVariableDataList() noexcept
 {
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>
+PortPool::getInterfacePortDataList(const RuntimeName_t& runtimeName) const noexcept
+{
+    return m_interfacePortIndex.portsOf(runtimeName);
+}
+
+cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> PortPool::getNodeDataList(const RuntimeName_t& runtimeName) const
+    noexcept
+{
+    return m_nodeDataIndex.portsOf(runtimeName);
+}
+
+cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+PortPool::getConditionVariableDataList(const RuntimeName_t& runtimeName) const noexcept
+{
+    return m_conditionVariableDataIndex.portsOf(runtimeName);
+}
+
 cxx::expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces interface) noexcept
 {
     if (m_portPoolData->m_interfacePortMembers.hasFreeSpace())
     {
         auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(runtimeName, interface);
+        m_interfacePortIndex.insert(interfacePortData);
         return cxx::success<popo::InterfacePortData*>(interfacePortData);
     }
     else
@@ -67,6 +87,7 @@ cxx::expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const Run
     if (m_portPoolData->m_nodeMembers.hasFreeSpace())
     {
         auto nodeData = m_portPoolData->m_nodeMembers.insert(runtimeName, nodeName, nodeDeviceIdentifier);
+        m_nodeDataIndex.insert(nodeData);
         return cxx::success<runtime::NodeData*>(nodeData);
     }
     else
@@ -84,6 +105,7 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     if (m_portPoolData->m_conditionVariableMembers.hasFreeSpace())
     {
         auto conditionVariableData = m_portPoolData->m_conditionVariableMembers.insert(runtimeName);
+        m_conditionVariableDataIndex.insert(conditionVariableData);
         return cxx::success<popo::ConditionVariableData*>(conditionVariableData);
     }
     else
@@ -96,29 +118,46 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
+    m_interfacePortIndex.remove(portData);
     m_portPoolData->m_interfacePortMembers.erase(portData);
 }
 
 void PortPool::removeNodeData(const runtime::NodeData* const nodeData) noexcept
 {
+    m_nodeDataIndex.remove(nodeData);
     m_portPoolData->m_nodeMembers.erase(nodeData);
 }
 
 void PortPool::removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept
 {
+    m_conditionVariableDataIndex.remove(conditionVariableData);
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
-cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
+FixedPositionContainer<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS>::Content
+PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers.content();
 }
 
-cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getSubscriberPortDataList() noexcept
+FixedPositionContainer<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS>::Content
+PortPool::getSubscriberPortDataList() noexcept
 {
     return m_portPoolData->m_subscriberPortMembers.content();
 }
 
+cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+PortPool::getPublisherPortDataList(const RuntimeName_t& runtimeName) const noexcept
+{
+    return m_publisherPortIndex.portsOf(runtimeName);
+}
+
+cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+PortPool::getSubscriberPortDataList(const RuntimeName_t& runtimeName) const noexcept
+{
+    return m_subscriberPortIndex.portsOf(runtimeName);
+}
+
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
                            mepoo::MemoryManager* const memoryManager,
@@ -130,6 +169,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        m_publisherPortIndex.insert(publisherPortData);
         return cxx::success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -163,16 +203,28 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     }
 }
 
-cxx::vector<popo::ClientPortData*, MAX_CLIENTS> PortPool::getClientPortDataList() noexcept
+FixedPositionContainer<popo::ClientPortData, MAX_CLIENTS>::Content PortPool::getClientPortDataList() noexcept
 {
     return m_portPoolData->m_clientPortMembers.content();
 }
 
-cxx::vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getServerPortDataList() noexcept
+FixedPositionContainer<popo::ServerPortData, MAX_SERVERS>::Content PortPool::getServerPortDataList() noexcept
 {
     return m_portPoolData->m_serverPortMembers.content();
 }
 
+cxx::vector<popo::ClientPortData*, MAX_CLIENTS> PortPool::getClientPortDataList(const RuntimeName_t& runtimeName) const
+    noexcept
+{
+    return m_clientPortIndex.portsOf(runtimeName);
+}
+
+cxx::vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getServerPortDataList(const RuntimeName_t& runtimeName) const
+    noexcept
+{
+    return m_serverPortIndex.portsOf(runtimeName);
+}
+
 cxx::expected<popo::ClientPortData*, PortPoolError>
 PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
                         mepoo::MemoryManager* const memoryManager,
@@ -190,6 +242,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
 
     auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
         serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+    m_clientPortIndex.insert(clientPortData);
     return cxx::success<popo::ClientPortData*>(clientPortData);
 }
 
@@ -210,25 +263,31 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
 
     auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
         serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+    m_serverPortIndex.insert(serverPortData);
     return cxx::success<popo::ServerPortData*>(serverPortData);
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    m_publisherPortIndex.remove(portData);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    m_subscriberPortIndex.remove(portData);
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
 void PortPool::removeClientPort(const popo::ClientPortData* const portData) noexcept
 {
+    m_clientPortIndex.remove(portData);
     m_portPoolData->m_clientPortMembers.erase(portData);
 }
+
 void PortPool::removeServerPort(const popo::ServerPortData* const portData) noexcept
 {
+    m_serverPortIndex.remove(portData);
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
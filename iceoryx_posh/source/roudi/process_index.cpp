@@ -0,0 +1,125 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/process_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint32_t ProcessIndex::CAPACITY;
+
+bool ProcessIndex::insert(Process* const process) noexcept
+{
+    if (process == nullptr || m_size >= MAX_PROCESS_NUMBER)
+    {
+        return false;
+    }
+
+    const auto name = process->getName();
+    auto bucket = bucketOf(name);
+    while (m_buckets[bucket] != nullptr)
+    {
+        if (m_buckets[bucket]->getName() == name)
+        {
+            return false;
+        }
+        bucket = nextBucket(bucket);
+    }
+
+    m_buckets[bucket] = process;
+    ++m_size;
+    return true;
+}
+
+cxx::optional<Process*> ProcessIndex::find(const RuntimeName_t& name) const noexcept
+{
+    auto bucket = findBucket(name);
+    if (!bucket.has_value())
+    {
+        return cxx::nullopt;
+    }
+    return cxx::make_optional<Process*>(m_buckets[bucket.value()]);
+}
+
+bool ProcessIndex::remove(const RuntimeName_t& name) noexcept
+{
+    auto maybeBucket = findBucket(name);
+    if (!maybeBucket.has_value())
+    {
+        return false;
+    }
+
+    // backward shift deletion; the entries following the removed one in the probe sequence are moved into the gap
+    // if their home bucket does not lie between the gap and their current bucket, this keeps the probe sequences
+    // intact without the need for tombstones
+    auto gap = maybeBucket.value();
+    m_buckets[gap] = nullptr;
+    for (auto bucket = nextBucket(gap); m_buckets[bucket] != nullptr; bucket = nextBucket(bucket))
+    {
+        const auto homeBucket = bucketOf(m_buckets[bucket]->getName());
+        const auto distanceToHome = (bucket - homeBucket) & (CAPACITY - 1U);
+        const auto distanceToGap = (bucket - gap) & (CAPACITY - 1U);
+        if (distanceToHome >= distanceToGap)
+        {
+            m_buckets[gap] = m_buckets[bucket];
+            m_buckets[bucket] = nullptr;
+            gap = bucket;
+        }
+    }
+
+    --m_size;
+    return true;
+}
+
+void ProcessIndex::clear() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket = nullptr;
+    }
+    m_size = 0U;
+}
+
+uint32_t ProcessIndex::size() const noexcept
+{
+    return m_size;
+}
+
+uint32_t ProcessIndex::bucketOf(const RuntimeName_t& name) noexcept
+{
+    return internal::hashRuntimeName(name) & (CAPACITY - 1U);
+}
+
+uint32_t ProcessIndex::nextBucket(const uint32_t bucket) noexcept
+{
+    return (bucket + 1U) & (CAPACITY - 1U);
+}
+
+cxx::optional<uint32_t> ProcessIndex::findBucket(const RuntimeName_t& name) const noexcept
+{
+    for (auto bucket = bucketOf(name); m_buckets[bucket] != nullptr; bucket = nextBucket(bucket))
+    {
+        if (m_buckets[bucket]->getName() == name)
+        {
+            return bucket;
+        }
+    }
+    return cxx::nullopt;
+}
+
+} // namespace roudi
+} // namespace iox
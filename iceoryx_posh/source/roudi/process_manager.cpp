@@ -133,6 +133,7 @@ void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noe
         LogWarn() << "Process ID " << process.getPid() << " named '" << process.getName()
                   << "' is still running after SIGKILL was sent. RouDi is ignoring this process.";
     }
+    m_processIndex.clear();
     m_processList.clear();
 }
 
@@ -260,6 +261,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         return false;
     }
     m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
+    m_processIndex.insert(&m_processList.back());
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
@@ -293,12 +295,17 @@ bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 
 bool ProcessManager::searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept
 {
-    // we need to search for the process (currently linear search)
+    auto maybeProcess = m_processIndex.find(name);
+    if (!maybeProcess.has_value())
+    {
+        return false;
+    }
+
+    // the list iterator is required for the removal, therefore the list is searched for the process object
     auto it = m_processList.begin();
     while (it != m_processList.end())
     {
-        auto otherName = it->getName();
-        if (name == otherName)
+        if (&(*it) == maybeProcess.value())
         {
             if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
             {
@@ -316,6 +323,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
+        m_processIndex.remove(processIter->getName());
         m_portManager.deletePortsOfProcess(processIter->getName());
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
@@ -679,15 +687,7 @@ ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& s
 
 cxx::optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexcept
 {
-    for (auto& process : m_processList)
-    {
-        if (process.getName() == name)
-        {
-            return cxx::make_optional<Process*>(&process);
-        }
-    }
-
-    return cxx::nullopt;
+    return m_processIndex.find(name);
 }
 
 void ProcessManager::monitorProcesses() noexcept
@@ -719,6 +719,7 @@ void ProcessManager::monitorProcesses() noexcept
                 m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
 
                 // delete application
+                m_processIndex.remove(processIterator->getName());
                 processIterator = m_processList.erase(processIterator);
                 continue; // erase returns first element after the removed one --> skip iterator increment
             }
@@ -148,13 +148,27 @@ void ServiceRegistry::find(const cxx::optional<capro::IdString_t>& service,
         return;
     }
 
+    // the keys of the search strings are calculated once, the strings of an entry are only compared when the keys match
+    using capro::ServiceDescription;
+    auto matches = [](const cxx::optional<capro::IdString_t>& searchString,
+                      const ServiceDescription::StringKey_t searchKey,
+                      const ServiceDescription::StringKey_t key,
+                      const capro::IdString_t& idString) {
+        return !searchString || (key == searchKey && idString == *searchString);
+    };
+    const auto serviceKey = (service) ? ServiceDescription::createStringKey(*service) : 0U;
+    const auto instanceKey = (instance) ? ServiceDescription::createStringKey(*instance) : 0U;
+    const auto eventKey = (event) ? ServiceDescription::createStringKey(*event) : 0U;
+
     for (auto& entry : m_serviceDescriptions)
     {
         if (entry)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            const auto& description = entry->serviceDescription;
+            const bool match =
+                matches(service, serviceKey, description.getServiceKey(), description.getServiceIDString())
+                && matches(instance, instanceKey, description.getInstanceKey(), description.getInstanceIDString())
+                && matches(event, eventKey, description.getEventKey(), description.getEventIDString());
 
             if (match)
             {
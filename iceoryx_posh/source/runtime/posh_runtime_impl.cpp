@@ -24,11 +24,13 @@
 #include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/runtime/node.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
 #include <cstdint>
+#include <cstdlib>
 
 namespace iox
 {
@@ -48,6 +50,7 @@ PoshRuntimeImpl::PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name, const
                                                       m_ipcChannelInterface.getSegmentManagerAddressOffset()});
     }())
 {
+    enableChunkTraceFromEnvironment();
 }
 
 PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
@@ -78,6 +81,38 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
+void PoshRuntimeImpl::enableChunkTraceFromEnvironment() noexcept
+{
+    const char* capacityString = std::getenv(popo::CHUNK_TRACE_CAPACITY_ENV_VARIABLE);
+    if (capacityString == nullptr)
+    {
+        return;
+    }
+
+    uint64_t capacity{0U};
+    if (!cxx::convert::fromString(capacityString, capacity))
+    {
+        LogError() << "Invalid value '" << capacityString << "' of " << popo::CHUNK_TRACE_CAPACITY_ENV_VARIABLE
+                   << "; the chunk trace is not enabled";
+        return;
+    }
+
+    if (capacity > popo::MAX_CHUNK_TRACE_CAPACITY)
+    {
+        LogError() << "The chunk trace capacity " << capacity << " of " << popo::CHUNK_TRACE_CAPACITY_ENV_VARIABLE
+                   << " exceeds the maximum of " << popo::MAX_CHUNK_TRACE_CAPACITY
+                   << "; the chunk trace is not enabled";
+        return;
+    }
+
+    popo::ChunkTrace::enable(m_appName, capacity).or_else([&](auto& error) {
+        if (error == popo::ChunkTraceError::INVALID_CAPACITY)
+        {
+            LogError() << "The chunk trace capacity " << capacity << " is not a power of two";
+        }
+    });
+}
+
 PublisherPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
                                         const popo::PublisherOptions& publisherOptions,
@@ -59,6 +59,7 @@ struct ChunkDistributorConfig
 struct ChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL / 3;
+    static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = iox::MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY;
 };
 
 using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
@@ -289,6 +289,45 @@ TEST_F(ServiceDescription_test, ServiceDescriptionStringCtorCreatesServiceDescri
     EXPECT_EQ(uint32_t(45), serviceDescription1.getClassHash()[3]);
 }
 
+TEST_F(ServiceDescription_test, ServiceDescriptionStringCtorCreatesTheKeysOfTheStrings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0205ac17-b78f-4c79-87e0-4777debf9f15");
+    testService = "Service";
+    testInstance = "Instance";
+    testEvent = "Event";
+
+    ServiceDescription serviceDescription(testService, testInstance, testEvent);
+
+    EXPECT_THAT(serviceDescription.getServiceKey(), Eq(ServiceDescription::createStringKey(testService)));
+    EXPECT_THAT(serviceDescription.getInstanceKey(), Eq(ServiceDescription::createStringKey(testInstance)));
+    EXPECT_THAT(serviceDescription.getEventKey(), Eq(ServiceDescription::createStringKey(testEvent)));
+}
+
+TEST_F(ServiceDescription_test, DifferentStringsHaveDifferentKeys)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "033fb1d9-793d-42bd-a4fe-ff5ad0fb0582");
+    EXPECT_THAT(ServiceDescription::createStringKey("Radar"), Ne(ServiceDescription::createStringKey("Lidar")));
+    EXPECT_THAT(ServiceDescription::createStringKey("Left"), Ne(ServiceDescription::createStringKey("Right")));
+    EXPECT_THAT(ServiceDescription::createStringKey(""), Ne(ServiceDescription::createStringKey("Object")));
+}
+
+TEST_F(ServiceDescription_test, DeserializedServiceDescriptionHasTheKeysOfTheSerializedOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52c61a5a-8b30-4f2b-9b89-47b8332cd202");
+    ServiceDescription serviceDescription("Service", "Instance", "Event");
+
+    ServiceDescription::deserialize(iox::cxx::Serialization(serviceDescription))
+        .and_then([&](const auto& service) {
+            EXPECT_THAT(service.getServiceKey(), Eq(serviceDescription.getServiceKey()));
+            EXPECT_THAT(service.getInstanceKey(), Eq(serviceDescription.getInstanceKey()));
+            EXPECT_THAT(service.getEventKey(), Eq(serviceDescription.getEventKey()));
+            EXPECT_THAT(service, Eq(serviceDescription));
+        })
+        .or_else([](const auto& error) {
+            GTEST_FAIL() << "Deserialization should not fail but failed with: " << static_cast<uint32_t>(error);
+        });
+}
+
 TEST_F(ServiceDescription_test, TwoServiceDescriptionsWithDifferentButValidServicesAreNotEqual)
 {
     ::testing::Test::RecordProperty("TEST_ID", "42329498-78b4-4cef-8629-918ca2783529");
@@ -0,0 +1,137 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/mepoo/chunk_layout_cache.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+
+using iox::mepoo::ChunkHeader;
+using iox::mepoo::ChunkLayoutCache;
+using iox::mepoo::ChunkSettings;
+
+class ChunkLayoutCache_test : public Test
+{
+  public:
+    static constexpr uint32_t CHUNK_SIZE{256U};
+    static constexpr uint32_t USER_PAYLOAD_SIZE{42U};
+    static constexpr uint32_t USER_PAYLOAD_ALIGNMENT{8U};
+
+    alignas(ChunkHeader) uint8_t m_chunk[CHUNK_SIZE];
+    alignas(ChunkHeader) uint8_t m_otherChunk[CHUNK_SIZE];
+    ChunkLayoutCache sut;
+};
+
+TEST_F(ChunkLayoutCache_test, GetChunkSettingsReturnsRequestedSettings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d90f7ed-c5af-4318-934c-b979bbb85f8e");
+    auto chunkSettingsResult = sut.getChunkSettings(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U);
+
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    EXPECT_THAT(chunkSettingsResult.value().userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(chunkSettingsResult.value().userPayloadAlignment(), Eq(USER_PAYLOAD_ALIGNMENT));
+}
+
+TEST_F(ChunkLayoutCache_test, GetChunkSettingsWithChangedParametersReturnsNewSettings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ca4f48f-75ad-4969-9be4-d3df568fcb54");
+    IOX_DISCARD_RESULT(sut.getChunkSettings(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U));
+    auto chunkSettingsResult = sut.getChunkSettings(2U * USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U);
+
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    EXPECT_THAT(chunkSettingsResult.value().userPayloadSize(), Eq(2U * USER_PAYLOAD_SIZE));
+}
+
+TEST_F(ChunkLayoutCache_test, GetChunkSettingsWithInvalidParametersFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "450a9e36-8817-4120-8f1a-cf8f22458834");
+    constexpr uint32_t INVALID_ALIGNMENT{3U};
+    auto chunkSettingsResult = sut.getChunkSettings(USER_PAYLOAD_SIZE, INVALID_ALIGNMENT, 0U, 1U);
+
+    ASSERT_TRUE(chunkSettingsResult.has_error());
+    EXPECT_THAT(chunkSettingsResult.get_error(), Eq(ChunkSettings::Error::ALIGNMENT_NOT_POWER_OF_TWO));
+}
+
+TEST_F(ChunkLayoutCache_test, InitializingChunkHeaderWithoutCachedChunkHeaderFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a90ea6cc-3afe-4e3e-8088-8f7ae70cd1d6");
+    IOX_DISCARD_RESULT(sut.getChunkSettings(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U));
+
+    EXPECT_THAT(sut.tryInitializeChunkHeader(m_chunk, CHUNK_SIZE), Eq(nullptr));
+}
+
+TEST_F(ChunkLayoutCache_test, InitializedChunkHeaderEqualsConstructedChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "374cf8d6-3050-45bb-b0e0-4f52b4d70383");
+    auto chunkSettings = sut.getChunkSettings(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U).value();
+    auto constructedChunkHeader = new (m_chunk) ChunkHeader(CHUNK_SIZE, chunkSettings);
+    sut.cacheChunkHeader(*constructedChunkHeader);
+
+    auto initializedChunkHeader = sut.tryInitializeChunkHeader(m_otherChunk, CHUNK_SIZE);
+
+    ASSERT_THAT(initializedChunkHeader, Ne(nullptr));
+    EXPECT_THAT(static_cast<void*>(initializedChunkHeader), Eq(static_cast<void*>(m_otherChunk)));
+    EXPECT_THAT(initializedChunkHeader->chunkSize(), Eq(CHUNK_SIZE));
+    EXPECT_THAT(initializedChunkHeader->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(initializedChunkHeader->userPayloadAlignment(), Eq(USER_PAYLOAD_ALIGNMENT));
+    EXPECT_THAT(initializedChunkHeader->usedSizeOfChunk(), Eq(constructedChunkHeader->usedSizeOfChunk()));
+    EXPECT_THAT(ChunkHeader::fromUserPayload(initializedChunkHeader->userPayload()), Eq(initializedChunkHeader));
+}
+
+TEST_F(ChunkLayoutCache_test, InitializingChunkHeaderWithDifferentChunkSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d5ee50b-a9d1-4db6-969f-bc568e8d7352");
+    auto chunkSettings = sut.getChunkSettings(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U).value();
+    sut.cacheChunkHeader(*new (m_chunk) ChunkHeader(CHUNK_SIZE, chunkSettings));
+
+    EXPECT_THAT(sut.tryInitializeChunkHeader(m_otherChunk, CHUNK_SIZE / 2U), Eq(nullptr));
+}
+
+TEST_F(ChunkLayoutCache_test, ChangedParametersInvalidateCachedChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3810b6ca-8dcc-4a87-bf70-d51c144b2f89");
+    auto chunkSettings = sut.getChunkSettings(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U).value();
+    sut.cacheChunkHeader(*new (m_chunk) ChunkHeader(CHUNK_SIZE, chunkSettings));
+
+    IOX_DISCARD_RESULT(sut.getChunkSettings(2U * USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 0U, 1U));
+
+    EXPECT_THAT(sut.tryInitializeChunkHeader(m_otherChunk, CHUNK_SIZE), Eq(nullptr));
+}
+
+TEST_F(ChunkLayoutCache_test, ChunkHeaderWithUserHeaderIsNotCached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8dd628ed-8adf-42a7-b867-462e416e6a2f");
+    auto chunkSettings = sut.getChunkSettings(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, 8U, 8U).value();
+    sut.cacheChunkHeader(*new (m_chunk) ChunkHeader(CHUNK_SIZE, chunkSettings));
+
+    EXPECT_THAT(sut.tryInitializeChunkHeader(m_otherChunk, CHUNK_SIZE), Eq(nullptr));
+}
+
+TEST_F(ChunkLayoutCache_test, ChunkHeaderWithLargeUserPayloadAlignmentIsNotCached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8aa03da0-740e-4bd5-a47e-e497af7df076");
+    constexpr uint32_t LARGE_USER_PAYLOAD_ALIGNMENT{2U * alignof(ChunkHeader)};
+    auto chunkSettings = sut.getChunkSettings(USER_PAYLOAD_SIZE, LARGE_USER_PAYLOAD_ALIGNMENT, 0U, 1U).value();
+    sut.cacheChunkHeader(*new (m_chunk) ChunkHeader(CHUNK_SIZE, chunkSettings));
+
+    EXPECT_THAT(sut.tryInitializeChunkHeader(m_otherChunk, CHUNK_SIZE), Eq(nullptr));
+}
+
+} // namespace
@@ -0,0 +1,218 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/inline_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_server_port_types.hpp"
+
+#include "test.hpp"
+
+#include <type_traits>
+
+namespace
+{
+using namespace ::testing;
+
+using iox::mepoo::ChunkHeader;
+using iox::mepoo::ChunkSettings;
+using iox::mepoo::InlineChunk;
+
+class InlineChunkSlots_test : public Test
+{
+  public:
+    static constexpr uint32_t CAPACITY{4U};
+    using Sut_t = iox::mepoo::InlineChunkSlots<CAPACITY>;
+
+    static ChunkSettings createChunkSettings(const uint32_t userPayloadSize,
+                                             const uint32_t userPayloadAlignment = 8U,
+                                             const uint32_t userHeaderSize = 0U,
+                                             const uint32_t userHeaderAlignment = 1U)
+    {
+        auto chunkSettingsResult =
+            ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+        iox::cxx::Ensures(!chunkSettingsResult.has_error());
+        return chunkSettingsResult.value();
+    }
+
+    Sut_t sut;
+};
+
+TEST_F(InlineChunkSlots_test, InlineChunkIsTriviallyCopyable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f25cc6fc-9564-4e2e-8314-2a521c3df93d");
+    EXPECT_TRUE(std::is_trivially_copyable<InlineChunk>::value);
+    EXPECT_THAT(alignof(InlineChunk), Eq(alignof(ChunkHeader)));
+}
+
+TEST_F(InlineChunkSlots_test, UserPayloadWithMaxInlineSizeFits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "180679ef-29eb-41bc-950c-f54880f4acce");
+    EXPECT_TRUE(Sut_t::fits(createChunkSettings(iox::MAX_INLINE_USER_PAYLOAD_SIZE)));
+}
+
+TEST_F(InlineChunkSlots_test, UserPayloadLargerThanMaxInlineSizeDoesNotFit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35808d97-7184-461c-9318-36e37ceb8d15");
+    EXPECT_FALSE(Sut_t::fits(createChunkSettings(iox::MAX_INLINE_USER_PAYLOAD_SIZE + 1U)));
+}
+
+TEST_F(InlineChunkSlots_test, UserPayloadWithLargeAlignmentDoesNotFit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4c1b365-ab8a-4094-9c6f-1ec478c484d4");
+    EXPECT_FALSE(Sut_t::fits(createChunkSettings(8U, 2U * alignof(ChunkHeader))));
+}
+
+TEST_F(InlineChunkSlots_test, ChunkWithUserHeaderDoesNotFit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c93e2a90-725a-4160-b834-f46deeec58d3");
+    EXPECT_FALSE(Sut_t::fits(createChunkSettings(8U, 8U, 8U, 8U)));
+}
+
+TEST_F(InlineChunkSlots_test, AcquireProvidesChunkHeaderWithRequestedSettings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "83fa5ae2-f9ba-4c19-88eb-309203356a58");
+    constexpr uint32_t USER_PAYLOAD_SIZE{42U};
+    auto chunkHeader = sut.tryAcquire(createChunkSettings(USER_PAYLOAD_SIZE));
+
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(chunkHeader->chunkSize(), Eq(Sut_t::SLOT_SIZE));
+    EXPECT_TRUE(sut.contains(chunkHeader));
+}
+
+TEST_F(InlineChunkSlots_test, AcquireFailsWhenAllSlotsAreInUse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da865c51-2830-4bb6-b209-8c8b995d5592");
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.hasFreeSlot());
+        EXPECT_THAT(sut.tryAcquire(createChunkSettings(8U)), Ne(nullptr));
+    }
+
+    EXPECT_FALSE(sut.hasFreeSlot());
+    EXPECT_THAT(sut.tryAcquire(createChunkSettings(8U)), Eq(nullptr));
+}
+
+TEST_F(InlineChunkSlots_test, ReleasedSlotCanBeAcquiredAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "60c70f37-8a1c-4696-a52e-3d67542965b9");
+    ChunkHeader* chunkHeaders[CAPACITY];
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        chunkHeaders[i] = sut.tryAcquire(createChunkSettings(8U));
+    }
+
+    EXPECT_TRUE(sut.release(chunkHeaders[1]));
+    EXPECT_FALSE(sut.contains(chunkHeaders[1]));
+
+    EXPECT_THAT(sut.tryAcquire(createChunkSettings(8U)), Eq(chunkHeaders[1]));
+}
+
+TEST_F(InlineChunkSlots_test, ReleasingSlotTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e7aea56-8820-42a2-9f81-060ab4949256");
+    auto chunkHeader = sut.tryAcquire(createChunkSettings(8U));
+
+    EXPECT_TRUE(sut.release(chunkHeader));
+    EXPECT_FALSE(sut.release(chunkHeader));
+}
+
+TEST_F(InlineChunkSlots_test, ReleasingForeignChunkHeaderFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3ca53b4-77ee-4d21-993e-e3903791100e");
+    alignas(ChunkHeader) uint8_t memory[Sut_t::SLOT_SIZE];
+    auto chunkHeader = new (memory) ChunkHeader(Sut_t::SLOT_SIZE, createChunkSettings(8U));
+
+    EXPECT_FALSE(sut.contains(chunkHeader));
+    EXPECT_FALSE(sut.release(chunkHeader));
+}
+
+TEST_F(InlineChunkSlots_test, ReleaseAllReleasesAllSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3a5d487-38ed-4374-99ea-d2831eaa4594");
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        sut.tryAcquire(createChunkSettings(8U));
+    }
+
+    sut.releaseAll();
+
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(sut.tryAcquire(createChunkSettings(8U)), Ne(nullptr));
+    }
+}
+
+TEST_F(InlineChunkSlots_test, PackedChunkIsUnpackedWithSameContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abda003a-2e08-4a90-99c0-678eb8546e49");
+    constexpr uint64_t VALUE{0xC0FFEEU};
+    auto chunkHeader = sut.tryAcquire(createChunkSettings(sizeof(uint64_t), alignof(uint64_t)));
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    *static_cast<uint64_t*>(chunkHeader->userPayload()) = VALUE;
+
+    InlineChunk inlineChunk;
+    Sut_t::pack(*chunkHeader, inlineChunk);
+
+    Sut_t receiverSlots;
+    auto unpackedChunkHeader = receiverSlots.tryAcquire(inlineChunk);
+    ASSERT_THAT(unpackedChunkHeader, Ne(nullptr));
+    EXPECT_TRUE(receiverSlots.contains(unpackedChunkHeader));
+    EXPECT_THAT(unpackedChunkHeader->userPayloadSize(), Eq(sizeof(uint64_t)));
+    EXPECT_THAT(unpackedChunkHeader->chunkHeaderVersion(), Eq(ChunkHeader::CHUNK_HEADER_VERSION));
+    EXPECT_THAT(*static_cast<const uint64_t*>(unpackedChunkHeader->userPayload()), Eq(VALUE));
+    EXPECT_THAT(ChunkHeader::fromUserPayload(unpackedChunkHeader->userPayload()), Eq(unpackedChunkHeader));
+}
+
+TEST(InlineChunkSlotsWithoutCapacity_test, NeverProvidesASlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a96737ed-8187-48a0-b38d-6b8984fe8f0a");
+    using Sut_t = iox::mepoo::InlineChunkSlots<0U>;
+    auto chunkSettingsResult = ChunkSettings::create(8U, 8U);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+
+    Sut_t sut;
+    EXPECT_FALSE(Sut_t::fits(chunkSettingsResult.value()));
+    EXPECT_FALSE(sut.hasFreeSlot());
+    EXPECT_THAT(sut.tryAcquire(chunkSettingsResult.value()), Eq(nullptr));
+    EXPECT_THAT(sut.tryAcquire(InlineChunk()), Eq(nullptr));
+}
+
+TEST(InlineChunkSlotsWithoutCapacity_test, ClientAndServerQueuesHaveNoInlineQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9fe8f4e4-8e85-42fc-8177-c472a1022a98");
+    using ClientQueueData_t = iox::popo::ChunkQueueData<iox::popo::ClientChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using ServerQueueData_t = iox::popo::ChunkQueueData<iox::popo::ServerChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    EXPECT_TRUE((std::is_same<ClientQueueData_t::InlineQueue_t, iox::popo::NoInlineChunkQueue>::value));
+    EXPECT_TRUE((std::is_same<ServerQueueData_t::InlineQueue_t, iox::popo::NoInlineChunkQueue>::value));
+
+    iox::popo::NoInlineChunkQueue queue(iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer);
+    EXPECT_TRUE(queue.push(InlineChunk()).has_value());
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop().has_value());
+    EXPECT_THAT(queue.peek(), Eq(nullptr));
+    EXPECT_THAT(queue.capacity(), Eq(0U));
+}
+
+TEST(InlineChunkSlotsWithoutCapacity_test, SubscriberQueuesHaveAnInlineQueueOnlyIfConfigured)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d3c41a5-5b0f-4d7e-9a36-2f8e0c6a1b94");
+    using SubscriberQueueData_t = iox::popo::ChunkQueueData<iox::DefaultChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    EXPECT_THAT((std::is_same<SubscriberQueueData_t::InlineQueue_t, iox::popo::NoInlineChunkQueue>::value),
+                Eq(iox::MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY == 0U));
+}
+
+} // namespace
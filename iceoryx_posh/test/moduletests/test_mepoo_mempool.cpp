@@ -19,6 +19,8 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+
 namespace
 {
 using namespace ::testing;
@@ -53,8 +55,8 @@ class MemPool_test : public Test
 TEST_F(MemPool_test, MempoolCtorInitialisesTheObjectWithValuesPassedToTheCtor)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b15b0da5-74e0-481b-87b6-53888b8a9890");
-    char memory[8192];
-    iox::posix::Allocator allocator{memory, 8192U};
+    char memory[16384];
+    iox::posix::Allocator allocator{memory, 16384U};
 
     iox::mepoo::MemPool sut(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator);
 
@@ -198,6 +200,43 @@ TEST_F(MemPool_test, FreeChunkMethodWhenTheChunkIndexIsInvalidReturnsError)
     EXPECT_DEATH({ sut.freeChunk(chunks[INVALID_INDEX]); }, ".*");
 }
 
+TEST_F(MemPool_test, GetChunkManagementReturnsTheEntryAtTheIndexOfTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f72ea080-409c-4227-8098-a4b53c61f0bb");
+    std::vector<uint8_t*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(reinterpret_cast<uint8_t*>(sut.getChunk()));
+    }
+
+    auto firstChunk = *std::min_element(chunks.begin(), chunks.end());
+    auto firstChunkManagement = sut.getChunkManagement(firstChunk);
+    EXPECT_THAT(reinterpret_cast<uint64_t>(firstChunkManagement) % alignof(ChunkManagement), Eq(0U));
+
+    for (auto chunk : chunks)
+    {
+        auto index = static_cast<uint64_t>(chunk - firstChunk) / CHUNK_SIZE;
+        EXPECT_THAT(sut.getChunkManagement(chunk), Eq(firstChunkManagement + index));
+    }
+}
+
+TEST_F(MemPool_test, GetChunkManagementReturnsTheSameEntryWhenCalledMultipleTimes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1cfd67d4-61ee-41c0-ae90-d59b650dee45");
+    auto chunk = sut.getChunk();
+    ASSERT_THAT(chunk, Ne(nullptr));
+
+    EXPECT_THAT(sut.getChunkManagement(chunk), Eq(sut.getChunkManagement(chunk)));
+}
+
+TEST_F(MemPool_test, GetChunkManagementWithChunkOutsideOfTheMemPoolGetsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7ae08963-da44-4b9a-82bf-2ec13337bb7c");
+    uint8_t chunkOutsideOfTheMemPool[CHUNK_SIZE];
+
+    EXPECT_DEATH({ sut.getChunkManagement(chunkOutsideOfTheMemPool); }, ".*");
+}
+
 TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b6cf614e-836a-4a15-850e-700031bfa016");
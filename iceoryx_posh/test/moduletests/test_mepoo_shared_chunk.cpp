@@ -39,7 +39,7 @@ class SharedChunk_Test : public Test
 
     ChunkManagement* GetChunkManagement(void* memoryChunk)
     {
-        ChunkManagement* v = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        ChunkManagement* v = mempool.getChunkManagement(memoryChunk);
         auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
         EXPECT_FALSE(chunkSettingsResult.has_error());
         if (chunkSettingsResult.has_error())
@@ -49,18 +49,16 @@ class SharedChunk_Test : public Test
         auto& chunkSettings = chunkSettingsResult.value();
         ChunkHeader* chunkHeader = new (memoryChunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
 
-        new (v) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        new (v) ChunkManagement{chunkHeader, &mempool};
         return v;
     }
 
-    static constexpr uint32_t CHUNK_SIZE{64U};
     static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
     static constexpr uint32_t USER_PAYLOAD_SIZE{64U};
 
     char memory[4096U];
     iox::posix::Allocator allocator{memory, 4096U};
     MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
-    MemPool chunkMgmtPool{CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
     void* memoryChunk{mempool.getChunk()};
     ChunkManagement* chunkManagement = GetChunkManagement(memoryChunk);
     SharedChunk sut{chunkManagement};
@@ -229,20 +227,15 @@ TEST_F(SharedChunk_Test, MultipleSharedChunksCleanup)
                     sut7 = sut4;
                     sut8 = sut2;
 
-                    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(2U));
                     EXPECT_THAT(mempool.getUsedChunks(), Eq(2U));
                 }
-                EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(2U));
                 EXPECT_THAT(mempool.getUsedChunks(), Eq(2U));
             }
             EXPECT_THAT(mempool.getUsedChunks(), Eq(2U));
-            EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(2U));
         }
         EXPECT_THAT(mempool.getUsedChunks(), Eq(2U));
-        EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(2U));
     }
     EXPECT_THAT(mempool.getUsedChunks(), Eq(1U));
-    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(1U));
 }
 
 
@@ -263,22 +256,16 @@ TEST_F(SharedChunk_Test, MultipleChunksCleanup)
                         iox::mepoo::SharedChunk sut2(GetChunkManagement(mempool.getChunk()));
                         iox::mepoo::SharedChunk sut4(GetChunkManagement(mempool.getChunk()));
                         EXPECT_THAT(mempool.getUsedChunks(), Eq(9U));
-                        EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(9U));
                     }
                     EXPECT_THAT(mempool.getUsedChunks(), Eq(7U));
-                    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(7U));
                 }
                 EXPECT_THAT(mempool.getUsedChunks(), Eq(5U));
-                EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(5U));
             }
             EXPECT_THAT(mempool.getUsedChunks(), Eq(3U));
-            EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(3U));
         }
         EXPECT_THAT(mempool.getUsedChunks(), Eq(2U));
-        EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(2U));
     }
     EXPECT_THAT(mempool.getUsedChunks(), Eq(1U));
-    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(1U));
 }
 
 TEST_F(SharedChunk_Test, NonEqualityOperatorOnTwoSharedChunkWithDifferentContentReturnsTrue)
@@ -114,7 +114,7 @@ class SharedPointer_Test : public Test
 
     ChunkManagement* GetChunkManagement(void* memoryChunk)
     {
-        ChunkManagement* v = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        ChunkManagement* v = mempool.getChunkManagement(memoryChunk);
 
         auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
         EXPECT_FALSE(chunkSettingsResult.has_error());
@@ -125,7 +125,7 @@ class SharedPointer_Test : public Test
         auto& chunkSettings = chunkSettingsResult.value();
 
         ChunkHeader* chunkHeader = new (memoryChunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
-        new (v) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        new (v) ChunkManagement{chunkHeader, &mempool};
         return v;
     }
 
@@ -142,7 +142,6 @@ class SharedPointer_Test : public Test
     char memory[4096U];
     iox::posix::Allocator allocator{memory, 4096U};
     MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, 10U, allocator, allocator};
-    MemPool chunkMgmtPool{64U, 10U, allocator, allocator};
 
     void* memoryChunk{mempool.getChunk()};
     ChunkManagement* chunkManagement = GetChunkManagement(memoryChunk);
@@ -0,0 +1,393 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/async_client.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "mocks/client_mock.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::capro;
+using namespace iox::popo;
+using ::testing::_;
+
+struct DummyRequest
+{
+    uint64_t data{0};
+};
+struct DummyResponse
+{
+    uint64_t data{0};
+};
+
+using TestAsyncClient = AsyncClientImpl<DummyRequest, DummyResponse, MockBaseClient>;
+using RequestChunk = ChunkMock<DummyRequest, RequestHeader>;
+using ResponseChunk = ChunkMock<DummyResponse, ResponseHeader>;
+
+class AsyncClient_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    Request<DummyRequest> loanRequest(TestAsyncClient& client, RequestChunk& chunk)
+    {
+        new (chunk.userHeader()) RequestHeader(iox::cxx::UniqueId(), RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
+        const iox::cxx::expected<RequestHeader*, AllocationError> allocateRequestResult =
+            iox::cxx::success<RequestHeader*>{chunk.userHeader()};
+        EXPECT_CALL(client.mockPort, allocateRequest(_, _)).WillOnce(Return(allocateRequestResult));
+
+        auto loanResult = client.loan();
+        EXPECT_FALSE(loanResult.has_error());
+        return std::move(loanResult.value());
+    }
+
+    int64_t sendAsync(TestAsyncClient& client, RequestChunk& chunk, uint64_t& receivedData)
+    {
+        EXPECT_CALL(client.mockPort, sendRequest(chunk.userHeader())).WillOnce(Return(iox::cxx::success<void>()));
+        auto sendResult =
+            client.sendAsync(loanRequest(client, chunk), [&](auto& response) { receivedData = response->data; });
+        EXPECT_FALSE(sendResult.has_error());
+        return sendResult.value();
+    }
+
+    static ClientOptions createOptions()
+    {
+        ClientOptions options;
+        options.responseQueueCapacity = RESPONSE_QUEUE_CAPACITY;
+        options.maxRequestsInFlight = MAX_REQUESTS_IN_FLIGHT;
+        return options;
+    }
+
+    static iox::cxx::expected<const ResponseHeader*, ChunkReceiveResult> respond(ResponseChunk& chunk,
+                                                                                 const int64_t sequenceId,
+                                                                                 const uint64_t data)
+    {
+        new (chunk.userHeader()) ResponseHeader(iox::cxx::UniqueId(), 0U, sequenceId);
+        chunk.sample()->data = data;
+        return iox::cxx::success<const ResponseHeader*>{chunk.userHeader()};
+    }
+
+    const iox::cxx::expected<const ResponseHeader*, ChunkReceiveResult> noResponse{
+        iox::cxx::error<ChunkReceiveResult>{ChunkReceiveResult::NO_CHUNK_AVAILABLE}};
+
+    RequestChunk requestMock1;
+    RequestChunk requestMock2;
+    ResponseChunk responseMock1;
+    ResponseChunk responseMock2;
+
+    ServiceDescription sd{"the", "whole", "dingsbums"};
+    static constexpr uint64_t RESPONSE_QUEUE_CAPACITY{42U};
+    static constexpr uint64_t MAX_REQUESTS_IN_FLIGHT{2U};
+    ClientOptions options{createOptions()};
+    TestAsyncClient sut{sd, options};
+};
+
+TEST_F(AsyncClient_test, ConstructorForwardsArgumentsToBaseClient)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b7a6d8e-3d4c-4f53-a0a5-7e2c1d9b8f61");
+
+    EXPECT_THAT(sut.serviceDescription, Eq(sd));
+    EXPECT_THAT(sut.clientOptions, Eq(options));
+    EXPECT_THAT(sut.maxRequestsInFlight(), Eq(MAX_REQUESTS_IN_FLIGHT));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, MaxRequestsInFlightIsLimitedByCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e91c2f4-8a7b-4c36-9d0e-2b6f3a1c7e58");
+
+    ClientOptions tooManyRequestsOptions;
+    tooManyRequestsOptions.maxRequestsInFlight = TestAsyncClient::MAX_REQUESTS_IN_FLIGHT + 1U;
+    TestAsyncClient client{sd, tooManyRequestsOptions};
+
+    EXPECT_THAT(client.maxRequestsInFlight(), Eq(TestAsyncClient::MAX_REQUESTS_IN_FLIGHT));
+}
+
+TEST_F(AsyncClient_test, SendAsyncSetsUniqueSequenceIdsAndCallsUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4d1e8a3-6f2b-4b97-8e15-9a0d7c3f5b22");
+
+    uint64_t receivedData1{0U};
+    uint64_t receivedData2{0U};
+    const auto sequenceId1 = sendAsync(sut, requestMock1, receivedData1);
+    const auto sequenceId2 = sendAsync(sut, requestMock2, receivedData2);
+
+    EXPECT_THAT(sequenceId1, Ne(sequenceId2));
+    EXPECT_THAT(requestMock1.userHeader()->getSequenceId(), Eq(sequenceId1));
+    EXPECT_THAT(requestMock2.userHeader()->getSequenceId(), Eq(sequenceId2));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(2U));
+}
+
+TEST_F(AsyncClient_test, SendAsyncFailsWhenMaxRequestsInFlightIsReached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f3a2b61-d9c4-4e07-a5b8-1c6e0f2d9a73");
+
+    uint64_t receivedData{0U};
+    sendAsync(sut, requestMock1, receivedData);
+    sendAsync(sut, requestMock2, receivedData);
+
+    RequestChunk requestMock3;
+    EXPECT_CALL(sut.mockPort, sendRequest(_)).Times(0);
+    EXPECT_CALL(sut.mockPort, releaseRequest(requestMock3.userHeader())).Times(1);
+    auto sendResult = sut.sendAsync(loanRequest(sut, requestMock3), [](auto&) {});
+
+    ASSERT_TRUE(sendResult.has_error());
+    EXPECT_THAT(sendResult.get_error(), Eq(AsyncClientSendError::TOO_MANY_REQUESTS_IN_FLIGHT));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(MAX_REQUESTS_IN_FLIGHT));
+}
+
+TEST_F(AsyncClient_test, SendAsyncFreesPendingRequestWhenSendingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a6d9f0c-4b8e-47a1-b3c5-d7e2f1a08b94");
+
+    EXPECT_CALL(sut.mockPort, sendRequest(requestMock1.userHeader()))
+        .WillOnce(Return(iox::cxx::error<ClientSendError>(ClientSendError::SERVER_NOT_AVAILABLE)));
+    auto sendResult = sut.sendAsync(loanRequest(sut, requestMock1), [](auto&) {});
+
+    ASSERT_TRUE(sendResult.has_error());
+    EXPECT_THAT(sendResult.get_error(), Eq(AsyncClientSendError::SERVER_NOT_AVAILABLE));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, DispatchResponsesCallsCallbackOfCorrespondingRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7b0c3d5-1f9a-4a62-8d4b-6c5e2a7f0d19");
+
+    uint64_t receivedData1{0U};
+    uint64_t receivedData2{0U};
+    const auto sequenceId1 = sendAsync(sut, requestMock1, receivedData1);
+    const auto sequenceId2 = sendAsync(sut, requestMock2, receivedData2);
+
+    constexpr uint64_t DATA1{13U};
+    constexpr uint64_t DATA2{37U};
+    // the responses arrive out of order
+    EXPECT_CALL(sut.mockPort, getResponse())
+        .WillOnce(Return(respond(responseMock2, sequenceId2, DATA2)))
+        .WillOnce(Return(respond(responseMock1, sequenceId1, DATA1)))
+        .WillOnce(Return(noResponse));
+    EXPECT_CALL(sut.mockPort, releaseResponse(responseMock1.userHeader())).Times(1);
+    EXPECT_CALL(sut.mockPort, releaseResponse(responseMock2.userHeader())).Times(1);
+
+    EXPECT_THAT(sut.dispatchResponses(), Eq(2U));
+    EXPECT_THAT(receivedData1, Eq(DATA1));
+    EXPECT_THAT(receivedData2, Eq(DATA2));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, DispatchResponsesDiscardsResponseOfCancelledRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94f1a7c2-0e3d-4b58-9a6f-b2d8c5e1f370");
+
+    uint64_t receivedData{0U};
+    const auto sequenceId = sendAsync(sut, requestMock1, receivedData);
+    EXPECT_TRUE(sut.cancel(sequenceId));
+    EXPECT_FALSE(sut.cancel(sequenceId));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+
+    constexpr uint64_t DATA{42U};
+    EXPECT_CALL(sut.mockPort, getResponse())
+        .WillOnce(Return(respond(responseMock1, sequenceId, DATA)))
+        .WillOnce(Return(noResponse));
+    EXPECT_CALL(sut.mockPort, releaseResponse(responseMock1.userHeader())).Times(1);
+
+    EXPECT_THAT(sut.dispatchResponses(), Eq(0U));
+    EXPECT_THAT(receivedData, Eq(0U));
+}
+
+TEST_F(AsyncClient_test, DispatchResponsesDiscardsResponseWithUnknownSequenceId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c8e5f1b-7a2d-4d94-b0e6-f4a9c2d7e815");
+
+    uint64_t receivedData{0U};
+    const auto sequenceId = sendAsync(sut, requestMock1, receivedData);
+
+    const auto unknownSequenceId = sequenceId + static_cast<int64_t>(TestAsyncClient::MAX_REQUESTS_IN_FLIGHT);
+    EXPECT_CALL(sut.mockPort, getResponse())
+        .WillOnce(Return(respond(responseMock1, unknownSequenceId, 1U)))
+        .WillOnce(Return(noResponse));
+    EXPECT_CALL(sut.mockPort, releaseResponse(responseMock1.userHeader())).Times(1);
+
+    EXPECT_THAT(sut.dispatchResponses(), Eq(0U));
+    EXPECT_THAT(receivedData, Eq(0U));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(1U));
+}
+
+TEST_F(AsyncClient_test, CallbackCanSendNewRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b15d0a9e-6c3f-4e27-8b41-a7f2d9c6e053");
+
+    bool followUpSent{false};
+    EXPECT_CALL(sut.mockPort, sendRequest(requestMock1.userHeader())).WillOnce(Return(iox::cxx::success<void>()));
+    auto sendResult = sut.sendAsync(loanRequest(sut, requestMock1), [&](auto&) {
+        EXPECT_CALL(sut.mockPort, sendRequest(requestMock2.userHeader()))
+            .WillOnce(Return(iox::cxx::success<void>()));
+        followUpSent = !sut.sendAsync(loanRequest(sut, requestMock2), [](auto&) {}).has_error();
+    });
+    ASSERT_FALSE(sendResult.has_error());
+
+    EXPECT_CALL(sut.mockPort, getResponse())
+        .WillOnce(Return(respond(responseMock1, sendResult.value(), 1U)))
+        .WillOnce(Return(noResponse));
+    EXPECT_CALL(sut.mockPort, releaseResponse(responseMock1.userHeader())).Times(1);
+
+    EXPECT_THAT(sut.dispatchResponses(), Eq(1U));
+    EXPECT_TRUE(followUpSent);
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(1U));
+}
+
+TEST_F(AsyncClient_test, ResponseQueueCapacityIsRaisedToMaxRequestsInFlight)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64f273b9-a850-4bf3-b0b7-e2947331625f");
+
+    ClientOptions smallQueueOptions;
+    smallQueueOptions.responseQueueCapacity = 1U;
+    smallQueueOptions.maxRequestsInFlight = MAX_REQUESTS_IN_FLIGHT + 1U;
+    TestAsyncClient client{sd, smallQueueOptions};
+
+    EXPECT_THAT(client.clientOptions.responseQueueCapacity, Eq(MAX_REQUESTS_IN_FLIGHT + 1U));
+}
+
+TEST_F(AsyncClient_test, MoreRequestsThanTheResponseQueueCapacityCanBeInFlight)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f0b6c1e-52d7-4a8e-9b43-c7d1e0a25f96");
+
+    // with the default deployment more requests can be in flight than the default response queue can hold
+    constexpr uint64_t NUMBER_OF_REQUESTS{TestAsyncClient::MAX_REQUESTS_IN_FLIGHT};
+    ClientOptions manyRequestsOptions;
+    manyRequestsOptions.maxRequestsInFlight = NUMBER_OF_REQUESTS;
+    TestAsyncClient client{sd, manyRequestsOptions};
+
+    RequestChunk requestMocks[NUMBER_OF_REQUESTS];
+    ResponseChunk responseMocks[NUMBER_OF_REQUESTS];
+    uint64_t receivedData[NUMBER_OF_REQUESTS]{};
+    int64_t sequenceIds[NUMBER_OF_REQUESTS];
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        sequenceIds[i] = sendAsync(client, requestMocks[i], receivedData[i]);
+    }
+    EXPECT_THAT(client.maxRequestsInFlight(), Eq(NUMBER_OF_REQUESTS));
+    EXPECT_THAT(client.numberOfRequestsInFlight(), Eq(NUMBER_OF_REQUESTS));
+    EXPECT_THAT(client.clientOptions.responseQueueCapacity,
+                Eq(std::min(NUMBER_OF_REQUESTS, static_cast<uint64_t>(iox::MAX_RESPONSE_QUEUE_CAPACITY))));
+
+    // the responses are dispatched in rounds which fit into the response queue
+    constexpr uint64_t RESPONSES_PER_ROUND{iox::DEFAULT_RESPONSE_QUEUE_CAPACITY};
+    EXPECT_CALL(client.mockPort, releaseResponse(_)).Times(static_cast<int>(NUMBER_OF_REQUESTS));
+    for (uint64_t roundBegin = 0U; roundBegin < NUMBER_OF_REQUESTS; roundBegin += RESPONSES_PER_ROUND)
+    {
+        const auto roundEnd = std::min(roundBegin + RESPONSES_PER_ROUND, NUMBER_OF_REQUESTS);
+        auto& getResponse = EXPECT_CALL(client.mockPort, getResponse());
+        for (uint64_t i = roundBegin; i < roundEnd; ++i)
+        {
+            getResponse.WillOnce(Return(respond(responseMocks[i], sequenceIds[i], i + 1U)));
+        }
+        getResponse.WillOnce(Return(noResponse));
+
+        EXPECT_THAT(client.dispatchResponses(), Eq(roundEnd - roundBegin));
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        EXPECT_THAT(receivedData[i], Eq(i + 1U));
+    }
+    EXPECT_THAT(client.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, PendingRequestExpiresAfterResponseTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "161e8a20-9ada-40f0-8941-b3ae1b1adf7d");
+
+    TestAsyncClient client{sd, options, iox::units::Duration::fromMilliseconds(1U)};
+    uint64_t receivedData{0U};
+    const auto sequenceId = sendAsync(client, requestMock1, receivedData);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_THAT(client.expireRequests(), Eq(1U));
+    EXPECT_THAT(client.numberOfRequestsInFlight(), Eq(0U));
+
+    EXPECT_CALL(client.mockPort, getResponse())
+        .WillOnce(Return(respond(responseMock1, sequenceId, 1U)))
+        .WillOnce(Return(noResponse));
+    EXPECT_CALL(client.mockPort, releaseResponse(responseMock1.userHeader())).Times(1);
+
+    EXPECT_THAT(client.dispatchResponses(), Eq(0U));
+    EXPECT_THAT(receivedData, Eq(0U));
+}
+
+TEST_F(AsyncClient_test, SendAsyncExpiresRequestsWhenMaxRequestsInFlightIsReached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2f67c63-38b9-4d72-a3a2-73a983e9af86");
+
+    TestAsyncClient client{sd, options, iox::units::Duration::fromMilliseconds(1U)};
+    uint64_t receivedData{0U};
+    sendAsync(client, requestMock1, receivedData);
+    sendAsync(client, requestMock2, receivedData);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    RequestChunk requestMock3;
+    sendAsync(client, requestMock3, receivedData);
+    EXPECT_THAT(client.numberOfRequestsInFlight(), Eq(1U));
+}
+
+TEST_F(AsyncClient_test, PendingRequestWithoutResponseTimeoutDoesNotExpire)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "585c0e97-3838-4b2e-af79-af8922b33d8b");
+
+    uint64_t receivedData{0U};
+    sendAsync(sut, requestMock1, receivedData);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_THAT(sut.expireRequests(), Eq(0U));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(1U));
+}
+
+TEST_F(AsyncClient_test, ResponseQueueOverflowExpiresRequestsSentBeforeTheNewestResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9dea35e-8857-4684-803f-1e6718fa74b3");
+
+    uint64_t receivedData1{0U};
+    uint64_t receivedData2{0U};
+    sendAsync(sut, requestMock1, receivedData1);
+    const auto sequenceId2 = sendAsync(sut, requestMock2, receivedData2);
+
+    constexpr uint64_t DATA2{37U};
+    // the response of the first request was discarded by the overflowing response queue
+    EXPECT_CALL(sut.mockPort, getResponse())
+        .WillOnce(Return(respond(responseMock2, sequenceId2, DATA2)))
+        .WillOnce(Return(noResponse));
+    EXPECT_CALL(sut.mockPort, releaseResponse(responseMock2.userHeader())).Times(1);
+    EXPECT_CALL(sut.mockPort, hasLostResponsesSinceLastCall()).WillOnce(Return(true));
+
+    EXPECT_THAT(sut.dispatchResponses(), Eq(1U));
+    EXPECT_THAT(receivedData2, Eq(DATA2));
+    EXPECT_THAT(receivedData1, Eq(0U));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+}
+
+} // namespace
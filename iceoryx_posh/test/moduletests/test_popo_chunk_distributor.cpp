@@ -23,11 +23,13 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -47,8 +49,8 @@ class ChunkDistributor_test : public Test
   public:
     SharedChunk allocateChunk(uint32_t value)
     {
-        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
         auto chunk = mempool.getChunk();
+        ChunkManagement* chunkMgmt = mempool.getChunkManagement(chunk);
 
         auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
         EXPECT_FALSE(chunkSettingsResult.has_error());
@@ -59,7 +61,7 @@ class ChunkDistributor_test : public Test
         auto& chunkSettings = chunkSettingsResult.value();
 
         ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
-        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool};
         *static_cast<uint32_t*>(chunkHeader->userPayload()) = value;
         return SharedChunk(chunkMgmt);
     }
@@ -77,7 +79,6 @@ class ChunkDistributor_test : public Test
     std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
     iox::posix::Allocator allocator{memory.get(), MEMORY_SIZE};
     MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, MEMPOOL_CHUNK_COUNT, allocator, allocator};
-    MemPool chunkMgmtPool{128U, MEMPOOL_CHUNK_COUNT, allocator, allocator};
 
     struct ChunkDistributorConfig
     {
@@ -88,6 +89,7 @@ class ChunkDistributor_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_NUMBER_QUEUES;
+        static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = iox::MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY;
     };
 
     using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, PolicyType>;
@@ -352,6 +354,46 @@ TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithPreviouslyAddedQueueRemovedRe
     EXPECT_FALSE(maybeIndex.has_value());
 }
 
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexOfStoredQueueIsStableWhenPreviouslyAddedQueueIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8854407a-e709-4a9c-b6de-d2ce1771efb6");
+    constexpr uint32_t UNKNOWN_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{1U};
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+
+    sut.getQueueIndex(queueData2->m_uniqueId, UNKNOWN_QUEUE_INDEX)
+        .and_then([&](const auto& index) { EXPECT_THAT(index, Eq(EXPECTED_QUEUE_INDEX)); })
+        .or_else([] { GTEST_FAIL() << "Expected to get an index!"; });
+}
+
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithReusedSlotReturnsIndexOnlyForNewQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eaf7365e-8a25-4a46-a7c7-3a76cea585e1");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    EXPECT_FALSE(sut.getQueueIndex(queueData1->m_uniqueId, EXPECTED_QUEUE_INDEX).has_value());
+    sut.getQueueIndex(queueData2->m_uniqueId, EXPECTED_QUEUE_INDEX)
+        .and_then([&](const auto& index) { EXPECT_THAT(index, Eq(EXPECTED_QUEUE_INDEX)); })
+        .or_else([] { GTEST_FAIL() << "Expected to get an index!"; });
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithOneQueueDeliversOneChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5bc10e0a-d67b-4123-887c-a50dc16cf680");
@@ -486,6 +528,103 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithMultipleQueuesDeliversChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9f39a86-4361-4290-9ea2-1053d1cb7d25");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 13U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 34));
+    }
+    EXPECT_THAT(sut.deliverToAllStoredQueues(chunks.data(), chunks.size()), Eq(NUMBER_OF_QUEUES));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 34u));
+        }
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesNotifiesEveryQueueOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b0f34b3-2b93-438e-ba7b-b0c0594f44ed");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 3U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 7U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    std::vector<std::unique_ptr<ConditionVariableData>> condVarData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        condVarData.emplace_back(new ConditionVariableData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+            .setConditionVariable(*condVarData.back(), i);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+    sut.deliverToAllStoredQueues(chunks.data(), chunks.size());
+
+    for (auto& condVar : condVarData)
+    {
+        auto numberOfNotifications = condVar->m_semaphore.getValue();
+        ASSERT_FALSE(numberOfNotifications.has_error());
+        EXPECT_THAT(numberOfNotifications.value(), Eq(1));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchWithMoreChunksThanHistoryCapacityKeepsLatestChunksInHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af533ec6-3849-4037-a8bd-3b2f96193e14");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    const uint64_t NUMBER_OF_CHUNKS = this->HISTORY_SIZE + 5U;
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+    sut.deliverToAllStoredQueues(chunks.data(), chunks.size());
+    EXPECT_THAT(sut.getHistorySize(), Eq(this->HISTORY_SIZE));
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+
+    for (auto i = NUMBER_OF_CHUNKS - this->HISTORY_SIZE; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1ed709b1-9129-454b-8440-50463ba1c02e");
@@ -820,4 +959,201 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueBlocksUntilAllChunksAreDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0b82e42-981b-461d-8dd2-eee90b8f9ef7");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(2U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS = 3U;
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool wereChunksDelivered{false};
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        EXPECT_THAT(sut.deliverToAllStoredQueues(chunks.data(), chunks.size()), Eq(1U));
+        wereChunksDelivered = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wereChunksDelivered.load(), Eq(false));
+
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        if (i + 1U == NUMBER_OF_CHUNKS)
+        {
+            // join needs to be before the load to ensure the wereChunksDelivered store happens before the read
+            t1.join();
+            EXPECT_THAT(wereChunksDelivered.load(), Eq(true));
+        }
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
+
+TYPED_TEST(ChunkDistributor_test, DeliverToBlockingQueueLosesChunkWhenWaitForConsumerTimeoutHasPassed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41d4bf6a-2ba3-469d-90e0-f0eabc8936e7");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    sutData->m_waitForConsumerTimeout = iox::units::Duration::fromMilliseconds(10U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(42U)), Eq(1U));
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(73U)), Eq(0U));
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(42U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithBlockingOptionLosesChunkWhenWaitForConsumerTimeoutHasPassed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f59a170-dbaf-4461-9875-bb63ff18f81f");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    sutData->m_waitForConsumerTimeout = iox::units::Duration::fromMilliseconds(10U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(42U)).has_error());
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(73U)).has_error());
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    EXPECT_THAT(queue.size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingBlockingQueueWakesUpWaitingDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93a3c5f4-21a0-4dad-b4fc-7e2b6c6e2f88");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool wasDeliveryFinished{false};
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(73U)), Eq(0U));
+        wasDeliveryFinished = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasDeliveryFinished.load(), Eq(false));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join(); // join needs to be before the load to ensure the wasDeliveryFinished store happens before the read
+    EXPECT_THAT(wasDeliveryFinished.load(), Eq(true));
+    EXPECT_THAT(queue.size(), Eq(1U));
+    EXPECT_THAT(queueData->m_numberOfWaitingProducers.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingBlockingQueueReturnsWhenWaitingDeliveryStoppedAccessingTheQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "453ad26c-87f3-4297-89b2-9de243239d14");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    std::thread t1([&] { sut.deliverToAllStoredQueues(this->allocateChunk(73U)); });
+
+    while (queueData->m_numberOfWaitingProducers.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    // the queue could be released here, the waiting delivery must not access it anymore
+    EXPECT_THAT(queueData->m_numberOfWaitingProducers.load(), Eq(0U));
+    t1.join();
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueWithDeadWaitingProducerDoesNotBlockOtherCallsOfTheDistributor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b2e94c0-1d5f-4a83-b6e7-0c9a3f58d214");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    // a producer which died while waiting for space in the queue never stops waiting
+    sutData->m_queueSlots[0U].m_numberOfWaitingProducers.store(1U);
+
+    std::atomic_bool wasRemovalFinished{false};
+    std::thread t1([&] {
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        wasRemovalFinished = true;
+    });
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_FALSE(sut.hasStoredQueues());
+    EXPECT_THAT(wasRemovalFinished.load(), Eq(false));
+
+    t1.join();
+    EXPECT_THAT(wasRemovalFinished.load(), Eq(true));
+}
+
+TYPED_TEST(ChunkDistributor_test, SlotOfQueueWithDeadWaitingProducerIsReusedLastAndWithoutWaitingProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3c01a7d-58b9-4f26-92d4-6a1f7b0e3c85");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto deadProducerQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(deadProducerQueueData.get(), 0U).has_error());
+    sutData->m_queueSlots[0U].m_numberOfWaitingProducers.store(1U);
+    ASSERT_FALSE(sut.tryRemoveQueue(deadProducerQueueData.get()).has_error());
+
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queues;
+    for (uint32_t i = 0U; i < TestFixture::MAX_NUMBER_QUEUES; ++i)
+    {
+        queues.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queues.back().get(), 0U).has_error());
+    }
+
+    EXPECT_THAT(sutData->m_queueSlots[0U].m_queue.get(), Eq(queues.back().get()));
+    EXPECT_THAT(sutData->m_queueSlots[0U].m_numberOfWaitingProducers.load(), Eq(0U));
+}
+
 } // namespace
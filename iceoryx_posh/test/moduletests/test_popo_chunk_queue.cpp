@@ -24,10 +24,16 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/internal/popo/io_reactor.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -43,8 +49,8 @@ class ChunkQueue_testBase
   public:
     SharedChunk allocateChunk()
     {
-        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
         auto chunk = mempool.getChunk();
+        ChunkManagement* chunkMgmt = mempool.getChunkManagement(chunk);
 
         auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
         EXPECT_FALSE(chunkSettingsResult.has_error());
@@ -55,7 +61,7 @@ class ChunkQueue_testBase
         auto& chunkSettings = chunkSettingsResult.value();
 
         ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
-        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool};
         return SharedChunk(chunkMgmt);
     }
 
@@ -66,7 +72,6 @@ class ChunkQueue_testBase
     iox::posix::Allocator allocator{memory.get(), MEMORY_SIZE};
     MemPool mempool{
         sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, 2U * iox::MAX_SUBSCRIBER_QUEUE_CAPACITY, allocator, allocator};
-    MemPool chunkMgmtPool{128U, 2U * iox::MAX_SUBSCRIBER_QUEUE_CAPACITY, allocator, allocator};
 
     static constexpr uint32_t RESIZED_CAPACITY{5U};
 };
@@ -244,6 +249,176 @@ TYPED_TEST(ChunkQueue_test, PushAndNotifyConditionVariable)
     EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
 }
 
+TYPED_TEST(ChunkQueue_test, PushWithNotificationAfterNumberOfChunksNotifiesWhenThresholdIsReached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b73332b4-80f4-4978-89f5-78735dede56a");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS;
+    this->m_chunkData.m_notificationThreshold = 3U;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.push(this->allocateChunk());
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithNotificationAfterNumberOfChunksNotifiesRemainingChunksAfterMaxDelay)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79207cde-4059-4bc6-b7ee-600540b5c2b5");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS;
+    this->m_chunkData.m_notificationThreshold = 3U;
+    this->m_chunkData.m_maxNotificationDelay = 1_ms;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.push(this->allocateChunk());
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_s).size(), Eq(1U));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithNotificationAfterNumberOfChunksWakesUpListenerWithWatchedFileDescriptorAfterMaxDelay)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bbdbad4b-2be6-4316-b598-bda6b213204e");
+    struct PipeReader
+    {
+        void onReadable()
+        {
+        }
+    };
+
+    int32_t pipeFds[2];
+    ASSERT_THAT(pipe(pipeFds), Eq(0));
+    ConditionVariableData condVar("Horscht");
+    IoReactor ioReactor{condVar};
+    PipeReader pipeReader;
+    auto watchId = ioReactor.watch(pipeFds[0], IoReactor::Readiness::READABLE, {pipeReader, &PipeReader::onReadable});
+    ASSERT_FALSE(watchId.has_error());
+    ConditionListener condVarWaiter{condVar, WaitOptions(), &ioReactor};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS;
+    this->m_chunkData.m_notificationThreshold = 3U;
+    this->m_chunkData.m_maxNotificationDelay = 10_ms;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    // the listener blocks in epoll_wait before the burst is pushed and has to be woken up to wait for its deadline
+    ConditionListener::NotificationVector_t notifications;
+    std::chrono::steady_clock::duration waitDuration{0};
+    std::thread waiter([&] {
+        const auto start = std::chrono::steady_clock::now();
+        notifications = condVarWaiter.timedWait(5_s);
+        waitDuration = std::chrono::steady_clock::now() - start;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    this->m_pusher.push(this->allocateChunk());
+    this->m_pusher.push(this->allocateChunk());
+    waiter.join();
+
+    EXPECT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(waitDuration, Lt(std::chrono::seconds(2)));
+
+    ioReactor.unwatch(watchId.value());
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithNotificationOnEmptyToNonEmptyNotifiesOnlyFirstChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67bcbe26-17d5-4979-b0ad-eaa41b171e05");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::ON_EMPTY_TO_NON_EMPTY;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithNotificationOnEmptyToNonEmptyNotifiesAgainAfterQueueWasDrained)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d5ca3f4-df09-4e6a-b5f9-66c44f1538c0");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::ON_EMPTY_TO_NON_EMPTY;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    EXPECT_FALSE(this->m_popper.tryPop().has_value());
+    this->m_popper.rearmNotification();
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, RearmNotificationWithChunkPushedAfterQueueWasFoundEmptyNotifies)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5b0f1bc-d0b9-4093-ae91-fb2f3f98f7da");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::ON_EMPTY_TO_NON_EMPTY;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+
+    // the consumer found the queue empty but a chunk is pushed before the notification is rearmed
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+    this->m_popper.rearmNotification();
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithNotificationAfterMinIntervalNotifiesSkippedChunkWhenIntervalHasPassed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae00447a-8655-49f7-8fc7-063060392bcd");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::AFTER_MIN_INTERVAL;
+    this->m_chunkData.m_minNotificationInterval = 1_ms;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_s).size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithNotificationAfterMinIntervalSkipsNotificationsWithinInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8be47c75-9ba1-4cb7-ba56-7983f2c64cba");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_notificationPolicy = QueueNotificationPolicy::AFTER_MIN_INTERVAL;
+    this->m_chunkData.m_minNotificationInterval = 1_h;
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+
+    this->m_pusher.push(this->allocateChunk());
+    this->m_pusher.push(this->allocateChunk());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
 TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3e55346f-62e1-44bb-bfe8-cef929935edf");
@@ -418,4 +593,63 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+
+class ChunkQueueSoFiWithMultipleProducers_test : public Test, public ChunkQueue_testBase
+{
+  public:
+    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, ThreadSafePolicy>;
+
+    static constexpr uint64_t NUMBER_OF_PRODUCERS{4U};
+    static constexpr uint64_t CHUNKS_PER_PRODUCER{iox::MAX_SUBSCRIBER_QUEUE_CAPACITY / NUMBER_OF_PRODUCERS};
+    static constexpr uint64_t NUMBER_OF_ROUNDS{50U};
+
+    ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                 iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
+};
+
+TEST_F(ChunkQueueSoFiWithMultipleProducers_test, ConcurrentPushesAreNeitherLostNorReordered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1554eb1-578f-49b7-b363-0aa53e68ec39");
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        std::vector<std::thread> producers;
+        for (uint64_t producer = 0U; producer < NUMBER_OF_PRODUCERS; ++producer)
+        {
+            producers.emplace_back([&, producer] {
+                ChunkQueuePusher<ChunkQueueData_t> pusher{&m_chunkData};
+                for (uint64_t i = 0U; i < CHUNKS_PER_PRODUCER; ++i)
+                {
+                    auto chunk = allocateChunk();
+                    *static_cast<uint64_t*>(chunk.getUserPayload()) = producer * CHUNKS_PER_PRODUCER + i;
+                    EXPECT_TRUE(pusher.push(chunk));
+                }
+            });
+        }
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+
+        uint64_t expectedNextValue[NUMBER_OF_PRODUCERS];
+        for (uint64_t producer = 0U; producer < NUMBER_OF_PRODUCERS; ++producer)
+        {
+            expectedNextValue[producer] = producer * CHUNKS_PER_PRODUCER;
+        }
+        uint64_t numberOfPoppedChunks{0U};
+        while (auto chunk = m_popper.tryPop())
+        {
+            auto value = *static_cast<uint64_t*>(chunk->getUserPayload());
+            auto producer = value / CHUNKS_PER_PRODUCER;
+            ASSERT_THAT(producer, Lt(NUMBER_OF_PRODUCERS));
+            EXPECT_THAT(value, Eq(expectedNextValue[producer]));
+            expectedNextValue[producer] = value + 1U;
+            ++numberOfPoppedChunks;
+        }
+
+        EXPECT_THAT(numberOfPoppedChunks, Eq(NUMBER_OF_PRODUCERS * CHUNKS_PER_PRODUCER));
+        EXPECT_THAT(mempool.getUsedChunks(), Eq(0U));
+    }
+}
+
 } // namespace
@@ -27,6 +27,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "test.hpp"
+#include "test_popo_chunk_trace_recorder.hpp"
 
 #include <memory>
 
@@ -72,6 +73,21 @@ class ChunkReceiver_test : public Test
         return getChunkResult.value();
     }
 
+    iox::mepoo::InlineChunk createInlineChunk(const uint64_t value)
+    {
+        auto chunkSettingsResult = iox::mepoo::ChunkSettings::create(sizeof(DummySample), alignof(DummySample));
+        iox::cxx::Ensures(!chunkSettingsResult.has_error());
+
+        iox::mepoo::InlineChunkSlots<1U> slots;
+        auto chunkHeader = slots.tryAcquire(chunkSettingsResult.value());
+        iox::cxx::Ensures(chunkHeader != nullptr);
+        new (chunkHeader->userPayload()) DummySample{value};
+
+        iox::mepoo::InlineChunk inlineChunk;
+        iox::mepoo::InlineChunkSlots<1U>::pack(*chunkHeader, inlineChunk);
+        return inlineChunk;
+    }
+
     static constexpr size_t MEGABYTE = 1 << 20;
     static constexpr size_t MEMORY_SIZE = 4 * MEGABYTE;
     std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
@@ -83,7 +99,14 @@ class ChunkReceiver_test : public Test
     iox::mepoo::MePooConfig m_mempoolconf;
     iox::mepoo::MemoryManager m_memoryManager;
 
-    using ChunkQueueData_t = iox::popo::ChunkQueueData<iox::DefaultChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    struct ChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY;
+        // the inline queue is disabled by default and therefore enabled with a capacity of its own
+        static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = 32U;
+    };
+
+    using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
     using ChunkReceiverData_t =
         iox::popo::ChunkReceiverData<iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, ChunkQueueData_t>;
     using ChunkQueuePopper_t = iox::popo::ChunkQueuePopper<ChunkQueueData_t>;
@@ -123,6 +146,22 @@ TEST_F(ChunkReceiver_test, getAndReleaseOneChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getChunkWithoutPublishTimestampRecordsNoTakeLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70f88755-9acd-409a-bfd7-93e0942443ee");
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    m_chunkQueuePusher.push(createInlineChunk(13U));
+
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkReceiver.release(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkReceiverData.m_takeLatencyHistogram.snapshot().numberOfSamples(), Eq(0U));
+}
+
 TEST_F(ChunkReceiver_test, getAndReleaseMultipleChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "32bfe8a5-8d17-4912-9591-c4f29bdd390e");
@@ -157,6 +196,123 @@ TEST_F(ChunkReceiver_test, getAndReleaseMultipleChunks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getMultipleFromEmptyQueueFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d0c2e4b-93f1-4a7d-b8e5-1f2a7c9d3e60");
+    uint64_t numberOfCallbackCalls{0U};
+    auto result = m_chunkReceiver.tryGetMultiple(3U, [&](auto) { ++numberOfCallbackCalls; });
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.get_error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfCallbackCalls, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getMultipleProvidesAvailableChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2f87a15-c0d4-4e69-9a3b-5e1d6f0c8a27");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        new (sharedChunk.getUserPayload()) DummySample{i};
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    auto result = m_chunkReceiver.tryGetMultiple(NUMBER_OF_CHUNKS + 1U, [&](auto chunk) { chunks.push_back(chunk); });
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(NUMBER_OF_CHUNKS));
+    ASSERT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunks[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunks[i]);
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getMultipleProvidesAtMostMaxNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e49a0c63-7b2d-4f15-8c6e-2d3f9b1a7e04");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    }
+
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    auto result = m_chunkReceiver.tryGetMultiple(NUMBER_OF_CHUNKS - 1U, [&](auto chunk) { chunks.push_back(chunk); });
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(NUMBER_OF_CHUNKS - 1U));
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS - 1U));
+    EXPECT_FALSE(m_chunkReceiver.empty());
+
+    for (auto chunk : chunks)
+    {
+        m_chunkReceiver.release(chunk);
+    }
+}
+
+TEST_F(ChunkReceiver_test, getMultipleWithZeroMaxNumberOfChunksTakesNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0caecb9a-4821-47b8-89e9-68baa7fb9e68");
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    uint64_t numberOfCalls{0U};
+    auto result = m_chunkReceiver.tryGetMultiple(0U, [&](auto) { ++numberOfCalls; });
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(0U));
+    EXPECT_THAT(numberOfCalls, Eq(0U));
+    EXPECT_FALSE(m_chunkReceiver.empty());
+}
+
+TEST_F(ChunkReceiver_test, getMultipleTakesOnlyAsManyChunksAsCanBeHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ae8a1cc-033f-45bf-8bf5-59bca055e467");
+    constexpr uint64_t MAX_CHUNKS_HELD{iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U};
+    constexpr uint64_t NUMBER_OF_FREE_SLOTS{2U};
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    for (uint64_t i = 0U; i < MAX_CHUNKS_HELD - NUMBER_OF_FREE_SLOTS; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(maybeChunkHeader.value());
+    }
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{NUMBER_OF_FREE_SLOTS + 2U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        new (sharedChunk.getUserPayload()) DummySample{i};
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    auto result = m_chunkReceiver.tryGetMultiple(NUMBER_OF_CHUNKS, [&](auto chunk) { chunks.push_back(chunk); });
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(NUMBER_OF_FREE_SLOTS));
+    ASSERT_THAT(chunks.size(), Eq(MAX_CHUNKS_HELD));
+    EXPECT_THAT(static_cast<const DummySample*>(chunks.back()->userPayload())->dummy, Eq(NUMBER_OF_FREE_SLOTS - 1U));
+
+    // no chunk was dropped, the remaining chunks are still in the queue
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(MAX_CHUNKS_HELD + NUMBER_OF_CHUNKS - NUMBER_OF_FREE_SLOTS));
+    auto tooManyResult = m_chunkReceiver.tryGetMultiple(1U, [&](auto chunk) { chunks.push_back(chunk); });
+    ASSERT_TRUE(tooManyResult.has_error());
+    EXPECT_THAT(tooManyResult.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+
+    m_chunkReceiver.release(chunks.front());
+    auto nextResult = m_chunkReceiver.tryGetMultiple(NUMBER_OF_CHUNKS, [&](auto chunk) { chunks.push_back(chunk); });
+    ASSERT_FALSE(nextResult.has_error());
+    EXPECT_THAT(nextResult.value(), Eq(1U));
+    EXPECT_THAT(static_cast<const DummySample*>(chunks.back()->userPayload())->dummy, Eq(NUMBER_OF_FREE_SLOTS));
+}
+
 TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
 {
     ::testing::Test::RecordProperty("TEST_ID", "58ff9db1-7ab9-471d-9492-4bd8fab47fcf");
@@ -235,6 +391,164 @@ TEST_F(ChunkReceiver_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getAndReleaseOneInlineChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07ab4647-6944-45c3-aacf-4669ed1efd3c");
+    constexpr uint64_t VALUE{73U};
+    m_chunkQueuePusher.push(createInlineChunk(VALUE));
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->userPayloadSize(), Eq(sizeof(DummySample)));
+    EXPECT_THAT(static_cast<const DummySample*>((*maybeChunkHeader)->userPayload())->dummy, Eq(VALUE));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+    m_chunkReceiver.release(*maybeChunkHeader);
+    EXPECT_FALSE(errorHandlerCalled);
+
+    m_chunkReceiver.release(*maybeChunkHeader);
+    EXPECT_TRUE(errorHandlerCalled);
+}
+
+TEST_F(ChunkReceiver_test, inlineAndSharedChunksAreProvidedInArrivalOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "edf66727-8390-423f-8ce3-880e9f14bf02");
+    constexpr uint64_t FIRST_INLINE_VALUE{13U};
+    constexpr uint64_t SECOND_INLINE_VALUE{14U};
+    m_chunkQueuePusher.push(createInlineChunk(FIRST_INLINE_VALUE));
+    auto sharedChunk = getChunkFromMemoryManager();
+    m_chunkQueuePusher.push(sharedChunk);
+    m_chunkQueuePusher.push(createInlineChunk(SECOND_INLINE_VALUE));
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(static_cast<const DummySample*>((*maybeChunkHeader)->userPayload())->dummy, Eq(FIRST_INLINE_VALUE));
+
+    maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_TRUE(sharedChunk.getUserPayload() == (*maybeChunkHeader)->userPayload());
+
+    maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(static_cast<const DummySample*>((*maybeChunkHeader)->userPayload())->dummy, Eq(SECOND_INLINE_VALUE));
+}
+
+TEST_F(ChunkReceiver_test, getMultipleProvidesInlineAndSharedChunksInArrivalOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5edd2a36-f3f8-42ae-9736-156152e85562");
+    auto firstSharedChunk = getChunkFromMemoryManager();
+    auto secondSharedChunk = getChunkFromMemoryManager();
+    m_chunkQueuePusher.push(firstSharedChunk);
+    m_chunkQueuePusher.push(createInlineChunk(1U));
+    m_chunkQueuePusher.push(createInlineChunk(2U));
+    m_chunkQueuePusher.push(secondSharedChunk);
+
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    auto getRet =
+        m_chunkReceiver.tryGetMultiple(10U, [&](const iox::mepoo::ChunkHeader* chunk) { chunks.push_back(chunk); });
+    ASSERT_FALSE(getRet.has_error());
+    ASSERT_THAT(getRet.value(), Eq(4U));
+    ASSERT_THAT(chunks.size(), Eq(4U));
+    EXPECT_TRUE(firstSharedChunk.getUserPayload() == chunks[0]->userPayload());
+    EXPECT_THAT(static_cast<const DummySample*>(chunks[1]->userPayload())->dummy, Eq(1U));
+    EXPECT_THAT(static_cast<const DummySample*>(chunks[2]->userPayload())->dummy, Eq(2U));
+    EXPECT_TRUE(secondSharedChunk.getUserPayload() == chunks[3]->userPayload());
+}
+
+TEST_F(ChunkReceiver_test, inlineChunksCountAgainstTheChunksWhichCanBeHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62a9adad-05ce-47a1-b6dc-68543cc4ee6e");
+    constexpr uint32_t MAX_INLINE_CHUNKS_IN_USE{ChunkReceiverData_t::MAX_INLINE_CHUNKS_IN_USE};
+    constexpr uint32_t MAX_CHUNKS_IN_USE{ChunkReceiverData_t::MAX_CHUNKS_IN_USE};
+    for (uint64_t i = 0U; i < MAX_INLINE_CHUNKS_IN_USE; ++i)
+    {
+        m_chunkQueuePusher.push(createInlineChunk(i));
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+
+    for (uint64_t i = 0U; i < MAX_CHUNKS_IN_USE - MAX_INLINE_CHUNKS_IN_USE; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+}
+
+TEST_F(ChunkReceiver_test, inlineChunkIsNotTakenWhenTheChunksWhichCanBeHeldAreTakenBySharedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52d95f58-5ec3-43d4-b946-5e42c587bb8d");
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    for (uint64_t i = 0U; i < ChunkReceiverData_t::MAX_CHUNKS_IN_USE; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(*maybeChunkHeader);
+    }
+
+    constexpr uint64_t INLINE_VALUE{37U};
+    m_chunkQueuePusher.push(createInlineChunk(INLINE_VALUE));
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+
+    m_chunkReceiver.release(chunks.front());
+    maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(static_cast<const DummySample*>((*maybeChunkHeader)->userPayload())->dummy, Eq(INLINE_VALUE));
+}
+
+TEST_F(ChunkReceiver_test, getTooManyInlineChunksWithoutReleaseKeepsInlineChunkInQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97e2ef05-eb99-450a-9eec-b84203c829f2");
+    constexpr uint32_t MAX_INLINE_CHUNKS_IN_USE{ChunkReceiverData_t::MAX_INLINE_CHUNKS_IN_USE};
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    for (uint64_t i = 0U; i < MAX_INLINE_CHUNKS_IN_USE + 1U; ++i)
+    {
+        m_chunkQueuePusher.push(createInlineChunk(i));
+    }
+
+    for (uint64_t i = 0U; i < MAX_INLINE_CHUNKS_IN_USE; ++i)
+    {
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        EXPECT_THAT(static_cast<const DummySample*>((*maybeChunkHeader)->userPayload())->dummy, Eq(i));
+        chunks.push_back(*maybeChunkHeader);
+    }
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+
+    m_chunkReceiver.release(chunks.front());
+    maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(static_cast<const DummySample*>((*maybeChunkHeader)->userPayload())->dummy,
+                Eq(MAX_INLINE_CHUNKS_IN_USE));
+}
+
+TEST_F(ChunkReceiver_test, CleanupReleasesInlineChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4fb6e7dd-d6b8-4f22-8be5-8ac3532d96d5");
+    m_chunkQueuePusher.push(createInlineChunk(1U));
+    m_chunkQueuePusher.push(createInlineChunk(2U));
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_chunkReceiver.releaseAll();
+
+    EXPECT_TRUE(ChunkQueuePopper_t(&m_chunkReceiverData).empty());
+    EXPECT_TRUE(m_chunkReceiverData.m_inlineChunksInUse.hasFreeSlot());
+    EXPECT_FALSE(m_chunkReceiverData.m_inlineChunksInUse.contains(*maybeChunkHeader));
+}
+
 TEST_F(ChunkReceiver_test, asStringLiteralConvertsChunkReceiveResultValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5cbbda34-8a22-4eab-a8b6-20da345c1707");
@@ -282,4 +596,20 @@ TEST_F(ChunkReceiver_test, LogStreamConvertsChunkReceiveResultValueToString)
     EXPECT_THAT(loggerMock.m_logs[0].message, StrEq(iox::popo::asStringLiteral(sut)));
 }
 
+TEST_F(ChunkReceiver_test, PushTakeAndReleaseAreTraced)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "74260d6d-98f3-4c98-90cb-8a8c0666858c");
+    iox_test_popo_chunk_trace::ChunkTraceRecorder chunkTrace;
+
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkReceiver.release(*maybeChunkHeader);
+
+    EXPECT_THAT(chunkTrace.eventTypes(),
+                ElementsAre(iox::popo::ChunkTraceEventType::PUSH,
+                            iox::popo::ChunkTraceEventType::TAKE,
+                            iox::popo::ChunkTraceEventType::RELEASE));
+}
+
 } // namespace
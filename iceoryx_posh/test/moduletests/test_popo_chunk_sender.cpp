@@ -33,7 +33,9 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "test.hpp"
+#include "test_popo_chunk_trace_recorder.hpp"
 
+#include <chrono>
 #include <memory>
 
 namespace
@@ -94,6 +96,8 @@ class ChunkSender_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+        // the inline queue is disabled by default and therefore enabled with a capacity of its own
+        static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = 32U;
     };
 
     using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
@@ -113,6 +117,13 @@ class ChunkSender_test : public Test
 
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+
+    ChunkSenderData_t m_chunkSenderDataWithInlineChunks{&m_memoryManager,
+                                                        iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                        0U,
+                                                        iox::mepoo::MemoryInfo(),
+                                                        true};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithInlineChunks{&m_chunkSenderDataWithInlineChunks};
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunkWithoutUserHeaderAndSmallUserPayloadAlignmentResultsInSmallChunk)
@@ -158,6 +169,44 @@ TEST_F(ChunkSender_test, allocate_ChunkHasOriginIdSet)
     EXPECT_THAT((*maybeChunkHeader)->originId(), Eq(uniqueId));
 }
 
+TEST_F(ChunkSender_test, allocate_RepeatedlyWithSameLayoutResultsInValidChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de28979b-e4de-477c-b845-b2c0140c9513");
+    constexpr uint32_t USER_PAYLOAD_SIZE{SMALL_CHUNK / 2};
+    UniquePortId uniqueId;
+    auto maybeFirstChunkHeader = m_chunkSender.tryAllocate(
+        uniqueId, USER_PAYLOAD_SIZE, alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    auto maybeSecondChunkHeader = m_chunkSender.tryAllocate(
+        uniqueId, USER_PAYLOAD_SIZE, alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+
+    ASSERT_FALSE(maybeFirstChunkHeader.has_error());
+    ASSERT_FALSE(maybeSecondChunkHeader.has_error());
+    auto firstChunkHeader = *maybeFirstChunkHeader;
+    auto secondChunkHeader = *maybeSecondChunkHeader;
+    EXPECT_THAT(secondChunkHeader, Ne(firstChunkHeader));
+    EXPECT_THAT(secondChunkHeader->originId(), Eq(uniqueId));
+    EXPECT_THAT(secondChunkHeader->chunkSize(), Eq(firstChunkHeader->chunkSize()));
+    EXPECT_THAT(secondChunkHeader->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(secondChunkHeader->usedSizeOfChunk(), Eq(firstChunkHeader->usedSizeOfChunk()));
+    EXPECT_THAT(iox::mepoo::ChunkHeader::fromUserPayload(secondChunkHeader->userPayload()), Eq(secondChunkHeader));
+}
+
+TEST_F(ChunkSender_test, allocate_WithChangedLayoutResultsInValidChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c35f6f8-b312-4672-b1cc-f2c398e46f5f");
+    constexpr uint32_t USER_PAYLOAD_SIZE{SMALL_CHUNK / 2};
+    auto maybeFirstChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), USER_PAYLOAD_SIZE, alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    auto maybeSecondChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), USER_PAYLOAD_SIZE / 2U, alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+
+    ASSERT_FALSE(maybeFirstChunkHeader.has_error());
+    ASSERT_FALSE(maybeSecondChunkHeader.has_error());
+    auto secondChunkHeader = *maybeSecondChunkHeader;
+    EXPECT_THAT(secondChunkHeader->userPayloadSize(), Eq(USER_PAYLOAD_SIZE / 2U));
+    EXPECT_THAT(iox::mepoo::ChunkHeader::fromUserPayload(secondChunkHeader->userPayload()), Eq(secondChunkHeader));
+}
+
 TEST_F(ChunkSender_test, allocate_MultipleChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0be0972d-f7d4-4400-bbc9-31767aef2e2b");
@@ -359,6 +408,43 @@ TEST_F(ChunkSender_test, sendOneWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendWithoutPublishTimestampOptionDoesNotStampChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2b4db4d-fbae-48a9-a21e-c17aa1447716");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_chunkSender.send(*maybeChunkHeader);
+
+    auto lastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(lastChunk.has_value());
+    EXPECT_THAT((*lastChunk)->publishTimestamp(), Eq(iox::mepoo::ChunkHeader::NO_PUBLISH_TIMESTAMP));
+}
+
+TEST_F(ChunkSender_test, sendWithPublishTimestampOptionStampsChunkWithCurrentTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4f481ad-adc0-4d01-bfc3-d85b2245a610");
+    m_chunkSenderData.m_stampPublishTimestamp = true;
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto now = []() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         iox::mepoo::BaseClock_t::now().time_since_epoch())
+                                         .count());
+    };
+    const auto timeBeforeSend = now();
+    m_chunkSender.send(*maybeChunkHeader);
+    const auto timeAfterSend = now();
+
+    auto lastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(lastChunk.has_value());
+    EXPECT_THAT((*lastChunk)->publishTimestamp(), Ge(timeBeforeSend));
+    EXPECT_THAT((*lastChunk)->publishTimestamp(), Le(timeAfterSend));
+}
+
 TEST_F(ChunkSender_test, sendMultipleWithReceiver)
 {
     ::testing::Test::RecordProperty("TEST_ID", "07e6a360-f5ae-4cd9-9bee-54b3c31c3390");
@@ -394,6 +480,66 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "530b3279-5d80-4671-b10e-e9c0f0f2120a");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> checkQueue(&m_chunkQueueData);
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        auto sample = (*maybeChunkHeader)->userPayload();
+        new (sample) DummySample();
+        static_cast<DummySample*>(sample)->dummy = i;
+        chunkHeaders[i] = *maybeChunkHeader;
+    }
+
+    auto numberOfDeliveries = m_chunkSender.send(chunkHeaders, NUMBER_OF_CHUNKS);
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto popRet = checkQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        auto dummySample = *reinterpret_cast<DummySample*>(popRet->getUserPayload());
+        EXPECT_THAT(dummySample.dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(checkQueue.empty());
+
+    auto maybeLastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(*maybeLastChunk, Eq(chunkHeaders[NUMBER_OF_CHUNKS - 1U]));
+}
+
+TEST_F(ChunkSender_test, sendBatchWithoutReceiverKeepsLatestChunksInHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13f5e28d-861e-4e5f-8fce-03a99a945263");
+    constexpr uint64_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    static_assert(NUMBER_OF_CHUNKS > HISTORY_CAPACITY, "the batch must exceed the history capacity for this test");
+
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithHistory.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders[i] = *maybeChunkHeader;
+    }
+
+    auto numberOfDeliveries = m_chunkSenderWithHistory.send(chunkHeaders, NUMBER_OF_CHUNKS);
+    EXPECT_THAT(numberOfDeliveries, Eq(0U));
+    EXPECT_THAT(m_chunkSenderWithHistory.getHistorySize(), Eq(HISTORY_CAPACITY));
+
+    // Used chunks == history size
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(HISTORY_CAPACITY));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -788,4 +934,139 @@ TEST_F(ChunkSender_test, LogStreamConvertsAllocationErrorValueToString)
     EXPECT_THAT(loggerMock.m_logs[0].message, StrEq(iox::popo::asStringLiteral(sut)));
 }
 
+TEST_F(ChunkSender_test, allocateSmallChunkWithInlineChunksEnabledDoesNotUseMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6565a6c5-8e45-48ed-8d56-84c0ce17edeb");
+    auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->userPayloadSize(), Eq(sizeof(DummySample)));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, allocateLargeChunkWithInlineChunksEnabledUsesMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8967261b-b27e-4e1b-99bf-a0defd5b4f49");
+    constexpr uint32_t USER_PAYLOAD_SIZE{iox::MAX_INLINE_USER_PAYLOAD_SIZE + 1U};
+    auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+        UniquePortId(), USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, allocateSmallChunkWithUserHeaderAndInlineChunksEnabledUsesMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71b2fc04-ee27-4dd4-95ee-95e052f1a521");
+    auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), sizeof(DummySample), alignof(DummySample));
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, allocateTooManyInlineChunksFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e54b64c-2dc7-42f7-a876-8392b1aebdf3");
+    for (uint32_t i = 0U; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        EXPECT_FALSE(maybeChunkHeader.has_error());
+    }
+
+    auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+}
+
+TEST_F(ChunkSender_test, releasedInlineChunkCanBeAllocatedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ea46ac5-af05-4408-93ee-ed3d0b106f4b");
+    for (uint32_t i = 0U; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY * 2U; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSenderWithInlineChunks.release(*maybeChunkHeader);
+    }
+}
+
+TEST_F(ChunkSender_test, sendMultipleInlineChunksWithReceiver)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4382d97a-2967-4239-b2f6-5f8635abbc97");
+    ASSERT_FALSE(m_chunkSenderWithInlineChunks.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint64_t NUMBER_OF_SAMPLES{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY * 2U};
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+
+        auto sample = new ((*maybeChunkHeader)->userPayload()) DummySample();
+        sample->dummy = i;
+        EXPECT_THAT(m_chunkSenderWithInlineChunks.send(*maybeChunkHeader), Eq(1U));
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_THAT(myQueue.size(), Eq(NUMBER_OF_SAMPLES));
+    EXPECT_FALSE(myQueue.tryPop().has_value());
+    for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        auto popRet = myQueue.tryPopInline();
+        ASSERT_TRUE(popRet.has_value());
+        auto chunkHeader = reinterpret_cast<const iox::mepoo::ChunkHeader*>(&popRet->m_chunk[0]);
+        EXPECT_THAT(chunkHeader->sequenceNumber(), Eq(i));
+        EXPECT_THAT(static_cast<const DummySample*>(chunkHeader->userPayload())->dummy, Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+}
+
+TEST_F(ChunkSender_test, sendInlineChunkIsNotAddedToPreviousChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d54312e-ffcc-42ab-aaac-5e36ca8f188e");
+    auto maybeChunkHeader = m_chunkSenderWithInlineChunks.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_chunkSenderWithInlineChunks.send(*maybeChunkHeader);
+
+    EXPECT_FALSE(m_chunkSenderWithInlineChunks.tryGetPreviousChunk().has_value());
+}
+
+TEST_F(ChunkSender_test, SendTracesLoanPublishAndPushOfTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb751398-8375-4f33-ae34-2e9252573bcc");
+    iox_test_popo_chunk_trace::ChunkTraceRecorder chunkTrace;
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    EXPECT_THAT(chunkTrace.eventTypes(),
+                ElementsAre(iox::popo::ChunkTraceEventType::LOAN,
+                            iox::popo::ChunkTraceEventType::PUBLISH,
+                            iox::popo::ChunkTraceEventType::PUSH));
+}
+
+TEST_F(ChunkSender_test, ReleaseTracesDiscardOfTheLoanedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be3f0938-deb2-4bcd-95b5-31e71ec567bb");
+    iox_test_popo_chunk_trace::ChunkTraceRecorder chunkTrace;
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.release(*maybeChunkHeader);
+
+    EXPECT_THAT(chunkTrace.eventTypes(),
+                ElementsAre(iox::popo::ChunkTraceEventType::LOAN, iox::popo::ChunkTraceEventType::DISCARD));
+}
+
 } // namespace
@@ -0,0 +1,229 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "test.hpp"
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class ChunkTrace_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        auto chunkSettings = iox::mepoo::ChunkSettings::create(sizeof(uint64_t)).value();
+        m_chunkHeader = new (m_chunkMemory) iox::mepoo::ChunkHeader(sizeof(m_chunkMemory), chunkSettings);
+    }
+
+    void TearDown() override
+    {
+        ChunkTrace::disable();
+    }
+
+    /// @brief opens the ring like iox-trace-export does
+    iox::posix::SharedMemoryObject openRing(const iox::posix::AccessMode accessMode = iox::posix::AccessMode::READ_ONLY)
+    {
+        return iox::posix::SharedMemoryObjectBuilder()
+            .name(ChunkTrace::shmName(RUNTIME_NAME))
+            .memorySizeInBytes(ChunkTraceRing::requiredMemorySize(CAPACITY))
+            .accessMode(accessMode)
+            .openMode(iox::posix::OpenMode::OPEN_EXISTING)
+            .create()
+            .value();
+    }
+
+    static constexpr uint64_t CAPACITY{4U};
+    const iox::RuntimeName_t RUNTIME_NAME{"ChunkTrace_test"};
+    alignas(iox::mepoo::ChunkHeader) uint8_t m_chunkMemory[128];
+    iox::mepoo::ChunkHeader* m_chunkHeader{nullptr};
+};
+
+constexpr uint64_t ChunkTrace_test::CAPACITY;
+
+TEST_F(ChunkTrace_test, EnableWithCapacityWhichIsNoPowerOfTwoFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0cf354f6-e6a5-4e66-8b8b-f1764bfd6ded");
+    auto result = ChunkTrace::enable(RUNTIME_NAME, 3U);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ChunkTraceError::INVALID_CAPACITY));
+    EXPECT_FALSE(ChunkTrace::isEnabled());
+}
+
+TEST_F(ChunkTrace_test, EnableWithZeroCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30556810-5a51-4ea7-b1dd-c76d6656ff08");
+    auto result = ChunkTrace::enable(RUNTIME_NAME, 0U);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ChunkTraceError::INVALID_CAPACITY));
+}
+
+TEST_F(ChunkTrace_test, EnableWithCapacityAboveMaximumFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e454a0dc-84db-4de6-a330-9ea1d12ad4fc");
+    auto result = ChunkTrace::enable(RUNTIME_NAME, 2U * iox::popo::MAX_CHUNK_TRACE_CAPACITY);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ChunkTraceError::INVALID_CAPACITY));
+}
+
+TEST_F(ChunkTrace_test, EnableAndDisableChangesState)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "afd6eb69-8f34-419d-9858-fb4ef6441de1");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+    EXPECT_TRUE(ChunkTrace::isEnabled());
+
+    ChunkTrace::disable();
+    EXPECT_FALSE(ChunkTrace::isEnabled());
+}
+
+TEST_F(ChunkTrace_test, EnableTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a6c97d7-8d5f-4796-bf1f-678f398311ba");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+    auto result = ChunkTrace::enable(RUNTIME_NAME, CAPACITY);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ChunkTraceError::ALREADY_ENABLED));
+}
+
+TEST_F(ChunkTrace_test, EnabledRingContainsHeaderOfProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "642bfb1c-c629-4377-84e3-dcedd6b2c33a");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+
+    auto memory = openRing();
+    auto& ring = *static_cast<const ChunkTraceRing*>(memory.getBaseAddress());
+    EXPECT_THAT(ring.version, Eq(ChunkTraceRing::VERSION));
+    EXPECT_THAT(ring.eventSize, Eq(sizeof(ChunkTraceEvent)));
+    EXPECT_THAT(ring.capacity, Eq(CAPACITY));
+    EXPECT_THAT(ring.pid, Eq(static_cast<uint64_t>(getpid())));
+    EXPECT_THAT(ring.runtimeName, Eq(RUNTIME_NAME));
+    EXPECT_THAT(ring.writeIndex.load(), Eq(0U));
+}
+
+TEST_F(ChunkTrace_test, TraceWhenDisabledDoesNotWriteEvent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b9d7e491-7140-4132-8ea0-18a57aa63c6a");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+    auto memory = openRing();
+    auto& ring = *static_cast<const ChunkTraceRing*>(memory.getBaseAddress());
+    ChunkTrace::disable();
+
+    ChunkTrace::trace(ChunkTraceEventType::LOAN, 1U, m_chunkHeader);
+
+    EXPECT_THAT(ring.writeIndex.load(), Eq(0U));
+    EXPECT_THAT(ring.events()[0].position.load(), Eq(0U));
+}
+
+TEST_F(ChunkTrace_test, TraceWritesEventWithTypeIdAndSequenceNumber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36bb81e7-a68c-43a9-9eb3-1b069a408027");
+    constexpr uint64_t ID{73U};
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+
+    ChunkTrace::trace(ChunkTraceEventType::TAKE, ID, m_chunkHeader);
+
+    auto memory = openRing();
+    auto& ring = *static_cast<const ChunkTraceRing*>(memory.getBaseAddress());
+    ASSERT_THAT(ring.writeIndex.load(), Eq(1U));
+    const auto& event = ring.events()[0];
+    EXPECT_THAT(event.position.load(), Eq(1U));
+    EXPECT_THAT(event.type, Eq(ChunkTraceEventType::TAKE));
+    EXPECT_THAT(event.id, Eq(ID));
+    EXPECT_THAT(event.sequenceNumber, Eq(m_chunkHeader->sequenceNumber()));
+    EXPECT_THAT(event.timestamp, Gt(0U));
+}
+
+TEST_F(ChunkTrace_test, EventsOfSameChunkHaveSameChunkIdentifier)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6f73a7d-bfce-44d6-b96e-9cab797e1115");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+
+    ChunkTrace::trace(ChunkTraceEventType::PUSH, 1U, m_chunkHeader);
+    ChunkTrace::trace(ChunkTraceEventType::TAKE, 1U, m_chunkHeader);
+
+    auto memory = openRing();
+    auto& ring = *static_cast<const ChunkTraceRing*>(memory.getBaseAddress());
+    EXPECT_THAT(ring.events()[0].chunk, Eq(ring.events()[1].chunk));
+    EXPECT_THAT(ring.events()[0].timestamp, Le(ring.events()[1].timestamp));
+}
+
+TEST_F(ChunkTrace_test, FullRingOverwritesOldestEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af3cecd6-0b8d-4d0a-91a2-3284308d8456");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+
+    for (uint64_t i = 0U; i < CAPACITY + 1U; ++i)
+    {
+        ChunkTrace::trace(ChunkTraceEventType::PUBLISH, i, m_chunkHeader);
+    }
+
+    auto memory = openRing();
+    auto& ring = *static_cast<const ChunkTraceRing*>(memory.getBaseAddress());
+    EXPECT_THAT(ring.writeIndex.load(), Eq(CAPACITY + 1U));
+    EXPECT_THAT(ring.events()[0].position.load(), Eq(CAPACITY + 1U));
+    EXPECT_THAT(ring.events()[0].id, Eq(CAPACITY));
+    EXPECT_THAT(ring.events()[1].position.load(), Eq(2U));
+    EXPECT_THAT(ring.events()[1].id, Eq(1U));
+}
+
+TEST_F(ChunkTrace_test, EventTypesHaveStringLiterals)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d4d1d07-19b2-47ae-ac04-23c18561b3d7");
+    EXPECT_THAT(std::strcmp(asStringLiteral(ChunkTraceEventType::LOAN), "loan"), Eq(0));
+    EXPECT_THAT(std::strcmp(asStringLiteral(ChunkTraceEventType::PUBLISH), "publish"), Eq(0));
+    EXPECT_THAT(std::strcmp(asStringLiteral(ChunkTraceEventType::PUSH), "push"), Eq(0));
+    EXPECT_THAT(std::strcmp(asStringLiteral(ChunkTraceEventType::TAKE), "take"), Eq(0));
+    EXPECT_THAT(std::strcmp(asStringLiteral(ChunkTraceEventType::RELEASE), "release"), Eq(0));
+    EXPECT_THAT(std::strcmp(asStringLiteral(ChunkTraceEventType::DISCARD), "discard"), Eq(0));
+}
+
+TEST_F(ChunkTrace_test, TraceDropsEventWhenTheEventIsClaimedByAnotherWriter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4b1c2a1-c6cb-4412-b4cd-3cd2afdaf0dd");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+    auto memory = openRing(iox::posix::AccessMode::READ_WRITE);
+    auto& ring = *static_cast<ChunkTraceRing*>(memory.getBaseAddress());
+    ring.events()[0].position.store(ChunkTraceEvent::POSITION_BUSY);
+
+    ChunkTrace::trace(ChunkTraceEventType::TAKE, 73U, m_chunkHeader);
+
+    EXPECT_THAT(ring.writeIndex.load(), Eq(1U));
+    EXPECT_THAT(ring.events()[0].position.load(), Eq(ChunkTraceEvent::POSITION_BUSY));
+    EXPECT_THAT(ring.events()[0].id, Ne(73U));
+}
+
+TEST_F(ChunkTrace_test, TraceDoesNotReplaceEventOfALaterRound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "450d8c74-f459-4c76-8bd6-7a398c2db6fe");
+    ASSERT_FALSE(ChunkTrace::enable(RUNTIME_NAME, CAPACITY).has_error());
+    auto memory = openRing(iox::posix::AccessMode::READ_WRITE);
+    auto& ring = *static_cast<ChunkTraceRing*>(memory.getBaseAddress());
+    // a writer of the next round of the ring completed the event before the writer of the first round claims it
+    ring.events()[0].position.store(CAPACITY + 1U);
+
+    ChunkTrace::trace(ChunkTraceEventType::TAKE, 73U, m_chunkHeader);
+
+    EXPECT_THAT(ring.events()[0].position.load(), Eq(CAPACITY + 1U));
+    EXPECT_THAT(ring.events()[0].id, Ne(73U));
+}
+
+} // namespace
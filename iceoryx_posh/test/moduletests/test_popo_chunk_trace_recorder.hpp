@@ -0,0 +1,77 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MODULETESTS_TEST_POPO_CHUNK_TRACE_RECORDER_HPP
+#define IOX_POSH_MODULETESTS_TEST_POPO_CHUNK_TRACE_RECORDER_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace iox_test_popo_chunk_trace
+{
+constexpr uint64_t CHUNK_TRACE_RECORDER_CAPACITY{64U};
+
+/// @brief enables the ChunkTrace for its lifetime and reads the traced events like iox-trace-export does
+class ChunkTraceRecorder
+{
+  public:
+    ChunkTraceRecorder() noexcept
+    {
+        iox::cxx::Expects(!iox::popo::ChunkTrace::enable(RUNTIME_NAME, CHUNK_TRACE_RECORDER_CAPACITY).has_error());
+        const auto ringSize = iox::popo::ChunkTraceRing::requiredMemorySize(CHUNK_TRACE_RECORDER_CAPACITY);
+        m_ringMemory.emplace(iox::posix::SharedMemoryObjectBuilder()
+                                 .name(iox::popo::ChunkTrace::shmName(RUNTIME_NAME))
+                                 .memorySizeInBytes(ringSize)
+                                 .accessMode(iox::posix::AccessMode::READ_ONLY)
+                                 .openMode(iox::posix::OpenMode::OPEN_EXISTING)
+                                 .create()
+                                 .value());
+    }
+
+    ChunkTraceRecorder(const ChunkTraceRecorder&) = delete;
+    ChunkTraceRecorder(ChunkTraceRecorder&&) = delete;
+    ChunkTraceRecorder& operator=(const ChunkTraceRecorder&) = delete;
+    ChunkTraceRecorder& operator=(ChunkTraceRecorder&&) = delete;
+
+    ~ChunkTraceRecorder() noexcept
+    {
+        iox::popo::ChunkTrace::disable();
+    }
+
+    /// @brief the types of the events in the order in which they were traced
+    std::vector<iox::popo::ChunkTraceEventType> eventTypes() const noexcept
+    {
+        const auto& ring = *static_cast<const iox::popo::ChunkTraceRing*>(m_ringMemory->getBaseAddress());
+        std::vector<iox::popo::ChunkTraceEventType> types;
+        for (uint64_t i = 0U; i < std::min(ring.writeIndex.load(), CHUNK_TRACE_RECORDER_CAPACITY); ++i)
+        {
+            types.push_back(ring.events()[i].type);
+        }
+        return types;
+    }
+
+  private:
+    const iox::RuntimeName_t RUNTIME_NAME{"ChunkTraceRecorder"};
+    iox::cxx::optional<iox::posix::SharedMemoryObject> m_ringMemory;
+};
+
+} // namespace iox_test_popo_chunk_trace
+
+#endif // IOX_POSH_MODULETESTS_TEST_POPO_CHUNK_TRACE_RECORDER_HPP
@@ -34,6 +34,7 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.connectOnCreate = false;
     testOptions.responseQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.serverTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.maxRequestsInFlight = 13;
 
     iox::popo::ClientOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +52,9 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Ne(defaultOptions.serverTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Eq(testOptions.serverTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.maxRequestsInFlight, Ne(defaultOptions.maxRequestsInFlight));
+            EXPECT_THAT(roundTripOptions.maxRequestsInFlight, Eq(testOptions.maxRequestsInFlight));
         })
         .or_else([&](auto&) {
             constexpr bool DESERIALZATION_ERROR_OCCURED{true};
@@ -81,9 +85,14 @@ iox::cxx::Serialization enumSerialization(QueueFullPolicyUT responseQueueFullPol
     constexpr uint64_t RESPONSE_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool CONNECT_ON_CREATE{true};
-
-    return iox::cxx::Serialization::create(
-        RESPONSE_QUEUE_CAPACITY, NODE_NAME, CONNECT_ON_CREATE, responseQueueFullPolicy, serverTooSlowPolicy);
+    constexpr uint64_t MAX_REQUESTS_IN_FLIGHT{7U};
+
+    return iox::cxx::Serialization::create(RESPONSE_QUEUE_CAPACITY,
+                                           NODE_NAME,
+                                           CONNECT_ON_CREATE,
+                                           responseQueueFullPolicy,
+                                           serverTooSlowPolicy,
+                                           MAX_REQUESTS_IN_FLIGHT);
 }
 
 TEST(ClientOptions_test, DeserializingValidResponseQueueFullAndServerTooSlowPolicyIsSuccessful)
@@ -215,4 +224,16 @@ TEST(ClientOptions_test, ComparisonOperatorReturnsFalseServerTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ClientOptions_test, ComparisonOperatorReturnsFalseMaxRequestsInFlightDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5c0e7a2-51a4-4b8e-9d63-0f2b7c1e9a84");
+    ClientOptions options1;
+    options1.maxRequestsInFlight = 2;
+    ClientOptions options2;
+    options2.maxRequestsInFlight = 8;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -31,6 +31,12 @@ using namespace ::testing;
 using namespace iox::capro;
 using namespace iox::popo;
 
+class RpcBaseHeaderAccess : public RpcBaseHeader
+{
+  public:
+    using RpcBaseHeader::m_lastKnownClientQueueIndex;
+};
+
 class ClientPort_test : public Test
 {
     static constexpr iox::units::Duration DEADLOCK_TIMEOUT{5_s};
@@ -412,6 +418,63 @@ TEST_F(ClientPort_test, GetResponseOnConnectedClientPortWithNonEmptyResponseQueu
         });
 }
 
+TEST_F(ClientPort_test, GetResponseProvidesQueueIndexFromResponseToNextRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "075f1a9d-86a1-4c5a-978c-7f92929fff0a");
+    constexpr uint32_t QUEUE_INDEX{7U};
+    auto& sut = clientPortWithConnectOnCreate;
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{10};
+    auto sharedChunk = getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(ResponseHeader));
+    new (sharedChunk.getChunkHeader()->userHeader()) ResponseHeader(iox::cxx::UniqueId(), QUEUE_INDEX, 0);
+    sut.responseQueuePusher.push(sharedChunk);
+
+    ASSERT_FALSE(sut.portUser.getResponse().has_error());
+
+    auto maybeRequest = sut.portUser.allocateRequest(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeRequest.has_error());
+    EXPECT_THAT(reinterpret_cast<RpcBaseHeaderAccess*>(maybeRequest.value())->m_lastKnownClientQueueIndex,
+                Eq(QUEUE_INDEX));
+}
+
+TEST_F(ClientPort_test, GetResponsesProvidesAllResponsesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e6b2d8f-4c19-4a73-95d2-3f7a1c8e6b40");
+    constexpr uint32_t QUEUE_INDEX{3U};
+    constexpr uint64_t NUMBER_OF_RESPONSES{3U};
+    auto& sut = clientPortWithConnectOnCreate;
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{10};
+    for (uint64_t i = 0; i < NUMBER_OF_RESPONSES; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(ResponseHeader));
+        new (sharedChunk.getChunkHeader()->userHeader())
+            ResponseHeader(iox::cxx::UniqueId(), QUEUE_INDEX, static_cast<int64_t>(i));
+        sut.responseQueuePusher.push(sharedChunk);
+    }
+
+    int64_t expectedSequenceId{0};
+    std::vector<const ResponseHeader*> responses;
+    auto result = sut.portUser.getResponses(NUMBER_OF_RESPONSES + 1U, [&](auto* responseHeader) {
+        EXPECT_THAT(responseHeader->getSequenceId(), Eq(expectedSequenceId++));
+        responses.push_back(responseHeader);
+    });
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(NUMBER_OF_RESPONSES));
+    EXPECT_THAT(responses.size(), Eq(NUMBER_OF_RESPONSES));
+
+    auto maybeRequest = sut.portUser.allocateRequest(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeRequest.has_error());
+    EXPECT_THAT(reinterpret_cast<RpcBaseHeaderAccess*>(maybeRequest.value())->m_lastKnownClientQueueIndex,
+                Eq(QUEUE_INDEX));
+
+    for (auto* responseHeader : responses)
+    {
+        sut.portUser.releaseResponse(responseHeader);
+    }
+    sut.portUser.releaseRequest(maybeRequest.value());
+}
+
 TEST_F(ClientPort_test, ReleaseResponseWithNullptrIsTerminating)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b6ad4c2a-7c52-45ee-afd3-29c286489311");
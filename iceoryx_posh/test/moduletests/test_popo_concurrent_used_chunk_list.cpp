@@ -0,0 +1,263 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/concurrent_used_chunk_list.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+class ConcurrentUsedChunkList_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        static constexpr uint32_t NUM_CHUNKS_IN_POOL = 100U;
+        static constexpr uint32_t CHUNK_SIZE = 128U;
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+
+        iox::posix::Allocator memoryAllocator{m_memory.get(), MEMORY_SIZE};
+        memoryManager.configureMemoryManager(mempoolconf, memoryAllocator, memoryAllocator);
+    };
+
+    void TearDown() override{};
+
+    SharedChunk getChunkFromMemoryManager()
+    {
+        constexpr uint32_t USER_PAYLOAD_SIZE{32U};
+        auto chunkSettingsResult =
+            iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        iox::cxx::Ensures(!chunkSettingsResult.has_error());
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        auto getChunkResult = memoryManager.getChunk(chunkSettings);
+        iox::cxx::Ensures(!getChunkResult.has_error());
+        return getChunkResult.value();
+    }
+
+    MemoryManager memoryManager;
+
+    static constexpr uint32_t USED_CHUNK_LIST_CAPACITY{10U};
+    ConcurrentUsedChunkList<USED_CHUNK_LIST_CAPACITY> sut;
+
+  private:
+    static constexpr size_t MEGABYTE = 1U << 20U;
+    static constexpr size_t MEMORY_SIZE = 4U * MEGABYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+};
+
+TEST_F(ConcurrentUsedChunkList_test, DefaultLimitIsCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0367cfb-babc-4183-9f33-065c983a5c89");
+    EXPECT_THAT(sut.limit(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, LimitLargerThanCapacityIsReducedToCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b7d94c6-1557-4e52-9f91-0ae8545b8c15");
+    sut.setLimit(USED_CHUNK_LIST_CAPACITY + 1U);
+    EXPECT_THAT(sut.limit(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, AddChunksUpToCapacityWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b6939cb-eac3-46c1-94a4-d711cbde87ee");
+    for (uint32_t i = 0U; i < USED_CHUNK_LIST_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    }
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, AddChunksUpToLimitWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65613da9-944e-4dc5-ae52-a611b05e4b24");
+    constexpr uint32_t LIMIT{3U};
+    sut.setLimit(LIMIT);
+
+    for (uint32_t i = 0U; i < LIMIT; ++i)
+    {
+        EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    }
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, RemovingChunkFromFullListAllowsToAddAnotherChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4dc63272-2bf2-43c4-9cc7-1d4d720987d2");
+    constexpr uint32_t LIMIT{3U};
+    sut.setLimit(LIMIT);
+
+    auto chunk = getChunkFromMemoryManager();
+    auto chunkHeader = chunk.getChunkHeader();
+    EXPECT_TRUE(sut.insert(chunk));
+    for (uint32_t i = 1U; i < LIMIT; ++i)
+    {
+        EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    }
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
+    EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunkHeader));
+    EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, ReserveIsLimitedByLimit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff9964e9-067b-4f57-b296-c8542c1eaddf");
+    constexpr uint32_t LIMIT{5U};
+    sut.setLimit(LIMIT);
+    EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+
+    EXPECT_THAT(sut.reserve(USED_CHUNK_LIST_CAPACITY), Eq(LIMIT - 1U));
+    EXPECT_THAT(sut.reserve(1U), Eq(0U));
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, CancelledReservationAllowsToAddAnotherChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "650e456b-200d-4af2-8d78-1d492e999285");
+    constexpr uint32_t LIMIT{3U};
+    sut.setLimit(LIMIT);
+
+    EXPECT_THAT(sut.reserve(LIMIT), Eq(LIMIT));
+    sut.insertReserved(getChunkFromMemoryManager());
+    sut.cancelReservation(LIMIT - 1U);
+
+    for (uint32_t i = 1U; i < LIMIT; ++i)
+    {
+        EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    }
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, RemoveChunkNotInListIsHandledGracefully)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e18827a3-b804-4a7f-a8b3-952409b2d225");
+    sut.insert(getChunkFromMemoryManager());
+
+    auto chunk = getChunkFromMemoryManager();
+    SharedChunk removedChunk;
+    EXPECT_FALSE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    EXPECT_FALSE(removedChunk);
+}
+
+TEST_F(ConcurrentUsedChunkList_test, RemovingChunkFromListLetsTheSharedChunkReturnOwnershipToTheMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "82ea78ca-50b0-4727-a5de-ce9c03ee6696");
+    {
+        auto chunk = getChunkFromMemoryManager();
+        auto chunkHeader = chunk.getChunkHeader();
+        sut.insert(chunk);
+        EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+
+        SharedChunk removedChunk;
+        sut.remove(chunkHeader, removedChunk);
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ConcurrentUsedChunkList_test, CallingCleanupReleasesAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9347dd87-abbe-49f0-bc7f-19627b37ba4a");
+    for (uint32_t i = 0U; i < USED_CHUNK_LIST_CAPACITY; ++i)
+    {
+        sut.insert(getChunkFromMemoryManager());
+    }
+
+    sut.cleanup();
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    for (uint32_t i = 0U; i < USED_CHUNK_LIST_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    }
+}
+
+TEST_F(ConcurrentUsedChunkList_test, ConcurrentInsertAndRemoveNeverExceedsLimitAndLosesNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5116938-34cf-46ee-b884-c6162801ff0d");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t CHUNKS_PER_THREAD{5U};
+    constexpr uint32_t ITERATIONS{1000U};
+    constexpr uint32_t LIMIT{NUMBER_OF_THREADS * CHUNKS_PER_THREAD / 2U};
+    sut.setLimit(LIMIT);
+
+    std::vector<std::vector<SharedChunk>> chunksPerThread(NUMBER_OF_THREADS);
+    for (auto& chunks : chunksPerThread)
+    {
+        for (uint32_t i = 0U; i < CHUNKS_PER_THREAD; ++i)
+        {
+            chunks.emplace_back(getChunkFromMemoryManager());
+        }
+    }
+
+    std::atomic<uint32_t> numberOfInsertedChunks{0U};
+    std::atomic<bool> limitExceeded{false};
+    std::atomic<bool> chunkLost{false};
+    std::vector<std::thread> threads;
+    for (auto& chunks : chunksPerThread)
+    {
+        threads.emplace_back([&] {
+            for (uint32_t iteration = 0U; iteration < ITERATIONS; ++iteration)
+            {
+                for (auto& chunk : chunks)
+                {
+                    if (!chunk || !sut.insert(chunk))
+                    {
+                        continue;
+                    }
+                    if (numberOfInsertedChunks.fetch_add(1U) + 1U > LIMIT)
+                    {
+                        limitExceeded = true;
+                    }
+
+                    auto chunkHeader = chunk.getChunkHeader();
+                    chunk = SharedChunk();
+                    numberOfInsertedChunks.fetch_sub(1U);
+                    if (!sut.remove(chunkHeader, chunk))
+                    {
+                        chunkLost = true;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_FALSE(limitExceeded.load());
+    EXPECT_FALSE(chunkLost.load());
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(NUMBER_OF_THREADS * CHUNKS_PER_THREAD));
+}
+} // namespace
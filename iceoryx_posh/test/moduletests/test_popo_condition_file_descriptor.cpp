@@ -0,0 +1,178 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_file_descriptor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include "test.hpp"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+
+class ConditionFileDescriptor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        auto result = ConditionFileDescriptor::create(m_condVarData);
+        ASSERT_FALSE(result.has_error());
+        m_sut.emplace(std::move(result.value()));
+    }
+
+    bool isReadable(const int32_t fileDescriptor) const noexcept
+    {
+        pollfd pollFd{fileDescriptor, POLLIN, 0};
+        return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+    }
+
+    ConditionVariableData m_condVarData{"Ferdinand"};
+    ConditionNotifier m_notifier{m_condVarData, 0U};
+    cxx::optional<ConditionFileDescriptor> m_sut;
+};
+
+TEST_F(ConditionFileDescriptor_test, CreateEnablesTheSignalingInTheConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4e9d91e-edb7-47db-9144-f9e58dec1085");
+    EXPECT_THAT(m_sut->getFileDescriptor(), Ge(0));
+    EXPECT_THAT(m_condVarData.m_fileDescriptorId.load(), Ne(0U));
+}
+
+TEST_F(ConditionFileDescriptor_test, DestructionDisablesTheSignalingInTheConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aeefc6cc-6dd2-4a6b-a04a-c9d45ed9a033");
+    m_sut.reset();
+    EXPECT_THAT(m_condVarData.m_fileDescriptorId.load(), Eq(0U));
+
+    m_notifier.notify();
+    EXPECT_FALSE(m_condVarData.m_fileDescriptorSignaled.load());
+}
+
+TEST_F(ConditionFileDescriptor_test, DestructionRemovesTheSocketFile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64e73dfd-b95e-4c76-82b0-135325936876");
+    sockaddr_un address{};
+    socklen_t addressLength = sizeof(address);
+    ASSERT_THAT(getsockname(m_sut->getFileDescriptor(), reinterpret_cast<sockaddr*>(&address), &addressLength), Eq(0));
+    ASSERT_THAT(address.sun_path[0], Ne('\0'));
+    EXPECT_THAT(access(address.sun_path, F_OK), Eq(0));
+
+    m_sut.reset();
+
+    EXPECT_THAT(access(address.sun_path, F_OK), Eq(-1));
+}
+
+TEST_F(ConditionFileDescriptor_test, NotifyDisablesTheSignalingWhenTheSocketOfTheWaiterIsGone)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "484092e0-6580-4f0b-9b2c-3aec5a7297dd");
+    ConditionVariableData orphanedCondVarData{"Karl"};
+    ConditionNotifier orphanedNotifier{orphanedCondVarData, 0U};
+    // no socket is bound to this id, like for a waiter which crashed
+    constexpr uint64_t ID_WITHOUT_SOCKET{0xFFFFFFFFFFFFFFFFU};
+    orphanedCondVarData.m_fileDescriptorId.store(ID_WITHOUT_SOCKET);
+
+    orphanedNotifier.notify();
+
+    EXPECT_THAT(orphanedCondVarData.m_fileDescriptorId.load(), Eq(0U));
+    EXPECT_FALSE(orphanedCondVarData.m_fileDescriptorSignaled.load());
+}
+
+TEST_F(ConditionFileDescriptor_test, IsNotReadableWithoutNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "542ba0c9-48b9-4ebb-996b-429b0fe4e291");
+    EXPECT_FALSE(isReadable(m_sut->getFileDescriptor()));
+}
+
+TEST_F(ConditionFileDescriptor_test, NotifyMakesTheFileDescriptorReadable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ec1061d-29cf-4648-878c-762efe41140e");
+    m_notifier.notify();
+    EXPECT_TRUE(isReadable(m_sut->getFileDescriptor()));
+}
+
+TEST_F(ConditionFileDescriptor_test, DeferredNotificationMakesTheFileDescriptorReadable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c72065b1-492c-4f8e-9557-2d59b74ad21b");
+    m_notifier.deferNotification(units::Duration(std::chrono::steady_clock::now().time_since_epoch())
+                                 + units::Duration::fromSeconds(1U));
+    EXPECT_TRUE(isReadable(m_sut->getFileDescriptor()));
+}
+
+TEST_F(ConditionFileDescriptor_test, ResetDiscardsTheSignal)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "561d03fd-a3a7-48f2-ad3d-1e351e24f3bf");
+    m_notifier.notify();
+    m_sut->reset();
+    EXPECT_FALSE(isReadable(m_sut->getFileDescriptor()));
+}
+
+TEST_F(ConditionFileDescriptor_test, MultipleNotificationsBeforeResetSendOneSignal)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a6e1072-3424-4c6e-b038-49e758f57641");
+    m_notifier.notify();
+    m_notifier.notify();
+    m_notifier.notify();
+
+    uint8_t data{0U};
+    EXPECT_THAT(recv(m_sut->getFileDescriptor(), &data, sizeof(data), MSG_DONTWAIT), Eq(1));
+    EXPECT_THAT(recv(m_sut->getFileDescriptor(), &data, sizeof(data), MSG_DONTWAIT), Eq(-1));
+}
+
+TEST_F(ConditionFileDescriptor_test, NotifyAfterResetSignalsAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8697639-e4a2-4990-865e-b6d5c4ce4756");
+    m_notifier.notify();
+    m_sut->reset();
+
+    m_notifier.notify();
+    EXPECT_TRUE(isReadable(m_sut->getFileDescriptor()));
+}
+
+TEST_F(ConditionFileDescriptor_test, OnlyTheFileDescriptorOfTheNotifiedConditionVariableIsSignaled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28715310-57d8-4926-91fb-b439d401bf6e");
+    ConditionVariableData otherCondVarData{"Sophie"};
+    auto other = ConditionFileDescriptor::create(otherCondVarData);
+    ASSERT_FALSE(other.has_error());
+    EXPECT_THAT(otherCondVarData.m_fileDescriptorId.load(), Ne(m_condVarData.m_fileDescriptorId.load()));
+
+    m_notifier.notify();
+
+    EXPECT_TRUE(isReadable(m_sut->getFileDescriptor()));
+    EXPECT_FALSE(isReadable(other->getFileDescriptor()));
+}
+
+TEST_F(ConditionFileDescriptor_test, MoveTransfersTheFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a921b807-7475-4c4b-868f-ed763e2c1727");
+    const auto fileDescriptor = m_sut->getFileDescriptor();
+    ConditionFileDescriptor movedSut(std::move(*m_sut));
+    m_sut.reset();
+
+    EXPECT_THAT(movedSut.getFileDescriptor(), Eq(fileDescriptor));
+    EXPECT_THAT(m_condVarData.m_fileDescriptorId.load(), Ne(0U));
+    m_notifier.notify();
+    EXPECT_TRUE(isReadable(movedSut.getFileDescriptor()));
+}
+} // namespace
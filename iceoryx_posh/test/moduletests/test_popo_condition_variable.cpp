@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <type_traits>
@@ -93,6 +94,40 @@ TEST_F(ConditionVariable_test, NoNotifyResultsInNotBeingTriggered)
     EXPECT_FALSE(m_waiter.wasNotified());
 }
 
+TEST_F(ConditionVariable_test, DeferredNotificationIsActivatedByWaitAfterDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b1e5016-32d0-43a9-ac23-7bea7c57f78c");
+    const auto deadline = iox::units::Duration(std::chrono::steady_clock::now().time_since_epoch()) + 10_ms;
+    m_notifiers[3U].deferNotification(deadline);
+
+    auto notifications = m_waiter.wait();
+
+    EXPECT_THAT(iox::units::Duration(std::chrono::steady_clock::now().time_since_epoch()), Ge(deadline));
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(3U));
+}
+
+TEST_F(ConditionVariable_test, DeferredNotificationIsNotActivatedByTimedWaitBeforeDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c080505-da40-4d2d-af94-e59bc627651a");
+    const auto deadline = iox::units::Duration(std::chrono::steady_clock::now().time_since_epoch()) + 1_h;
+    m_notifiers[5U].deferNotification(deadline);
+
+    EXPECT_THAT(m_waiter.timedWait(1_ms).empty(), Eq(true));
+}
+
+TEST_F(ConditionVariable_test, NotifyMakesDeferredNotificationObsolete)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49d5abf9-9dd6-42fa-a5e9-5abb14c79695");
+    m_notifiers[2U].deferNotification(iox::units::Duration(std::chrono::steady_clock::now().time_since_epoch()));
+    m_notifiers[2U].notify();
+
+    auto notifications = m_waiter.timedWait(1_ms);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(2U));
+    EXPECT_THAT(m_waiter.timedWait(1_ms).empty(), Eq(true));
+}
+
 TEST_F(ConditionVariable_test, WaitResetsAllNotificationsInWait)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ebc9c42a-14e7-471c-a9df-9c5641b5767d");
@@ -493,4 +528,81 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+
+TEST_F(ConditionVariable_test, BusyPollingWaitReturnsNotificationOfOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71d45d9e-d7ac-4aec-b5e1-e76b8a41480e");
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLLING, 0_s});
+
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ConditionNotifier(m_condVarData, 7U).notify();
+    });
+
+    auto indices = sut.wait();
+    notifier.join();
+
+    ASSERT_THAT(indices.size(), Eq(1U));
+    EXPECT_THAT(indices[0U], Eq(7U));
+}
+
+TEST_F(ConditionVariable_test, BusyPollingTimedWaitWithoutNotificationReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf87aa4e-19c2-4921-a721-6c2a1bd8fe5e");
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLLING, 0_s});
+    EXPECT_TRUE(sut.timedWait(10_ms).empty());
+}
+
+TEST_F(ConditionVariable_test, BusyPollingWaitIsWokenUpByDestroy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5554df58-9635-43b4-9102-6e937fb977d3");
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLLING, 0_s});
+
+    std::thread waiter([&] { EXPECT_TRUE(sut.wait().empty()); });
+
+    sut.destroy();
+    waiter.join();
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockWaitReturnsNotificationArrivingAfterSpinDuration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "846cacec-c68d-4f35-915f-61b8b4d94d5a");
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 1_ms});
+
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ConditionNotifier(m_condVarData, 3U).notify();
+    });
+
+    auto indices = sut.wait();
+    notifier.join();
+
+    ASSERT_THAT(indices.size(), Eq(1U));
+    EXPECT_THAT(indices[0U], Eq(3U));
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockWaitReturnsNotificationArrivingWhileSpinning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e3a8674-23e1-4987-a9dc-a61f676ed2b3");
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 1_s});
+
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ConditionNotifier(m_condVarData, 11U).notify();
+    });
+
+    auto indices = sut.wait();
+    notifier.join();
+
+    ASSERT_THAT(indices.size(), Eq(1U));
+    EXPECT_THAT(indices[0U], Eq(11U));
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockTimedWaitWithSpinDurationLongerThanTimeoutReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14cbd854-4abe-4d52-8a5c-c2836b465601");
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 1_s});
+    EXPECT_TRUE(sut.timedWait(10_ms).empty());
+}
+
 } // namespace
@@ -0,0 +1,337 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/file_descriptor_trigger.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <poll.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public iox::popo::WaitSet<>
+{
+  public:
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class TestListener : public Listener
+{
+  public:
+    TestListener(ConditionVariableData& data) noexcept
+        : Listener(data)
+    {
+    }
+};
+
+class FileDescriptorTrigger_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        ASSERT_THAT(pipe(m_pipe), Eq(0));
+        m_callbackOrigin = nullptr;
+    }
+
+    void TearDown() override
+    {
+        close(m_pipe[0]);
+        close(m_pipe[1]);
+    }
+
+    void writeToPipe() noexcept
+    {
+        const char data{'x'};
+        ASSERT_THAT(write(m_pipe[1], &data, 1U), Eq(1));
+    }
+
+    void readFromPipe() noexcept
+    {
+        char data{0};
+        ASSERT_THAT(read(m_pipe[0], &data, 1U), Eq(1));
+    }
+
+    int m_pipe[2]{-1, -1};
+    ConditionVariableData m_condVar{"Spaetzle"};
+    WaitSetTest m_waitSet{m_condVar};
+
+    static std::atomic<FileDescriptorTrigger*> m_callbackOrigin;
+    static void callback(FileDescriptorTrigger* origin)
+    {
+        m_callbackOrigin = origin;
+    }
+};
+
+std::atomic<FileDescriptorTrigger*> FileDescriptorTrigger_test::m_callbackOrigin{nullptr};
+
+TEST_F(FileDescriptorTrigger_test, IsNotTriggeredWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "88a09753-7c3e-4a28-af83-812b85ff703e");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    EXPECT_FALSE(sut.hasTriggered());
+    EXPECT_THAT(sut.getFileDescriptor(), Eq(m_pipe[0]));
+}
+
+TEST_F(FileDescriptorTrigger_test, IsReadableWhenDataIsAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "50019d8a-c18b-4db0-9512-a649ea39efe9");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    EXPECT_FALSE(sut.isReadable());
+
+    writeToPipe();
+    EXPECT_TRUE(sut.isReadable());
+
+    readFromPipe();
+    EXPECT_FALSE(sut.isReadable());
+}
+
+TEST_F(FileDescriptorTrigger_test, ReadableEventTriggersWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dbda5b1b-e8e1-445a-9ec1-eacbcd3ec34f");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, FileDescriptorEvent::READABLE, 4711U).has_error());
+
+    writeToPipe();
+
+    auto result = m_waitSet.timedWait(1_s);
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0U]->getNotificationId(), Eq(4711U));
+    EXPECT_TRUE(result[0U]->doesOriginateFrom(&sut));
+}
+
+TEST_F(FileDescriptorTrigger_test, AttachingWithoutEnumAttachesReadableEvent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b1e2e49-b6ca-42f2-bc0d-d5e1566e9411");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, 13U).has_error());
+
+    writeToPipe();
+
+    auto result = m_waitSet.timedWait(1_s);
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0U]->getNotificationId(), Eq(13U));
+}
+
+TEST_F(FileDescriptorTrigger_test, WritableEventTriggersWaitSetWhenFileDescriptorIsWritable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d0a8d07-2daa-47da-a9b7-d0a35ec59e4b");
+    FileDescriptorTrigger sut(m_pipe[1]);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, FileDescriptorEvent::WRITABLE, 42U).has_error());
+
+    auto result = m_waitSet.timedWait(1_s);
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0U]->getNotificationId(), Eq(42U));
+}
+
+TEST_F(FileDescriptorTrigger_test, ReadableStateIsActiveUntilTheDataIsRead)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "acf00254-9d14-4c70-a281-031ceeb07a3f");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    ASSERT_FALSE(m_waitSet.attachState(sut, FileDescriptorState::READABLE, 7U).has_error());
+
+    writeToPipe();
+
+    EXPECT_THAT(m_waitSet.timedWait(1_s).size(), Eq(1U));
+    EXPECT_THAT(m_waitSet.timedWait(1_ms).size(), Eq(1U));
+
+    readFromPipe();
+    EXPECT_THAT(m_waitSet.timedWait(1_ms).size(), Eq(0U));
+}
+
+TEST_F(FileDescriptorTrigger_test, DetachedTriggerDoesNotNotifyWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a745a59-7b15-4f02-9981-f1f72d6801a6");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, FileDescriptorEvent::READABLE).has_error());
+    m_waitSet.detachEvent(sut, FileDescriptorEvent::READABLE);
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+
+    writeToPipe();
+
+    EXPECT_THAT(m_waitSet.timedWait(10_ms).size(), Eq(0U));
+    EXPECT_FALSE(sut.hasTriggered());
+}
+
+TEST_F(FileDescriptorTrigger_test, TriggerGoesOutOfScopeCleansUpAtWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "413bc9a8-b156-4cdd-be39-e97ce424230c");
+    {
+        FileDescriptorTrigger sut(m_pipe[0]);
+        ASSERT_FALSE(m_waitSet.attachEvent(sut, FileDescriptorEvent::READABLE).has_error());
+    }
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    writeToPipe();
+    EXPECT_THAT(m_waitSet.timedWait(10_ms).size(), Eq(0U));
+}
+
+TEST_F(FileDescriptorTrigger_test, WaitSetGoesOutOfScopeDetachesTrigger)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be85416d-98bb-4433-aff9-468b4279f8b6");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    {
+        ConditionVariableData condVar{"Maultasche"};
+        WaitSetTest waitSet{condVar};
+        ASSERT_FALSE(waitSet.attachEvent(sut, FileDescriptorEvent::READABLE).has_error());
+    }
+
+    writeToPipe();
+    EXPECT_FALSE(sut.hasTriggered());
+}
+
+TEST_F(FileDescriptorTrigger_test, AttachingToAnotherWaitSetCallsErrorHandlerAndDetachesFromTheFirstOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce7ab73a-cea3-4ce0-9a79-fc529c1da3e7");
+    ConditionVariableData condVar{"Kaesspaetzle"};
+    WaitSetTest waitSet{condVar};
+    FileDescriptorTrigger sut(m_pipe[0]);
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, FileDescriptorEvent::READABLE).has_error());
+    ASSERT_FALSE(waitSet.attachEvent(sut, FileDescriptorEvent::READABLE).has_error());
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(),
+                Eq(iox::PoshError::POPO__FILE_DESCRIPTOR_TRIGGER_OVERRIDING_ALREADY_ATTACHED_TRIGGER));
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    EXPECT_THAT(waitSet.size(), Eq(1U));
+
+    writeToPipe();
+    EXPECT_THAT(waitSet.timedWait(1_s).size(), Eq(1U));
+}
+
+TEST_F(FileDescriptorTrigger_test, TwoTriggersOfTheSameFileDescriptorNotifyTheWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e31a8e0-5502-4704-a6fa-c21033a10c55");
+    FileDescriptorTrigger sut1(m_pipe[0]);
+    FileDescriptorTrigger sut2(m_pipe[0]);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut1, FileDescriptorEvent::READABLE, 1U).has_error());
+    ASSERT_FALSE(m_waitSet.attachEvent(sut2, FileDescriptorEvent::READABLE, 2U).has_error());
+
+    writeToPipe();
+
+    auto result = m_waitSet.timedWait(1_s);
+    ASSERT_THAT(result.size(), Eq(2U));
+    EXPECT_TRUE(result[0U]->doesOriginateFrom(&sut1) || result[1U]->doesOriginateFrom(&sut1));
+    EXPECT_TRUE(result[0U]->doesOriginateFrom(&sut2) || result[1U]->doesOriginateFrom(&sut2));
+}
+
+TEST_F(FileDescriptorTrigger_test, ReadableAndWritableTriggersOfTheSameFileDescriptorNotifyTheWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6dce0ed7-da1a-4853-94e5-5598369fa406");
+    int sockets[2]{-1, -1};
+    ASSERT_THAT(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), Eq(0));
+    {
+        FileDescriptorTrigger readableSut(sockets[0]);
+        FileDescriptorTrigger writableSut(sockets[0]);
+        ASSERT_FALSE(m_waitSet.attachEvent(readableSut, FileDescriptorEvent::READABLE, 1U).has_error());
+        ASSERT_FALSE(m_waitSet.attachEvent(writableSut, FileDescriptorEvent::WRITABLE, 2U).has_error());
+
+        const char data{'x'};
+        ASSERT_THAT(write(sockets[1], &data, 1U), Eq(1));
+
+        auto result = m_waitSet.timedWait(1_s);
+        ASSERT_THAT(result.size(), Eq(2U));
+        EXPECT_TRUE(result[0U]->doesOriginateFrom(&readableSut) || result[1U]->doesOriginateFrom(&readableSut));
+        EXPECT_TRUE(result[0U]->doesOriginateFrom(&writableSut) || result[1U]->doesOriginateFrom(&writableSut));
+    }
+    close(sockets[0]);
+    close(sockets[1]);
+}
+
+TEST_F(FileDescriptorTrigger_test, FileDescriptorOfWaitSetBecomesReadableWhenAttachedFileDescriptorIsReady)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c89edf39-a578-4771-b33b-afe8c8425f1c");
+    FileDescriptorTrigger sut(m_pipe[0]);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, FileDescriptorEvent::READABLE, 73U).has_error());
+    auto fileDescriptor = m_waitSet.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    pollfd pollFd{fileDescriptor.value(), POLLIN, 0};
+    EXPECT_THAT(poll(&pollFd, 1U, 0), Eq(0));
+
+    writeToPipe();
+    EXPECT_THAT(poll(&pollFd, 1U, 1000), Eq(1));
+
+    // the external event loop calls timedWait without blocking when the file descriptor is readable
+    auto result = m_waitSet.timedWait(0_s);
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0U]->getNotificationId(), Eq(73U));
+}
+
+TEST_F(FileDescriptorTrigger_test, AttachingAnInvalidFileDescriptorCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b907f72-ee37-4ccd-99de-b3784e674517");
+    FileDescriptorTrigger sut(-1);
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    IOX_DISCARD_RESULT(m_waitSet.attachEvent(sut, FileDescriptorEvent::READABLE));
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POPO__IO_REACTOR_UNABLE_TO_WATCH_FILE_DESCRIPTOR));
+}
+
+TEST_F(FileDescriptorTrigger_test, ReadableEventCallsListenerCallback)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97b7f387-6999-4e0b-9442-e11754ec04ec");
+    ConditionVariableData condVar{"Flaedlesupp"};
+    TestListener listener(condVar);
+    FileDescriptorTrigger sut(m_pipe[0]);
+    ASSERT_FALSE(listener
+                     .attachEvent(sut,
+                                  FileDescriptorEvent::READABLE,
+                                  createNotificationCallback(FileDescriptorTrigger_test::callback))
+                     .has_error());
+
+    writeToPipe();
+
+    for (uint64_t i = 0U; i < 1000U && m_callbackOrigin.load() == nullptr; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_THAT(m_callbackOrigin.load(), Eq(&sut));
+    listener.detachEvent(sut, FileDescriptorEvent::READABLE);
+}
+} // namespace
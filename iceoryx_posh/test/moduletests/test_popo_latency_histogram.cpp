@@ -0,0 +1,160 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "test.hpp"
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::popo::LatencyHistogram;
+
+class LatencyHistogram_test : public Test
+{
+  protected:
+    static uint64_t upperBoundOf(const uint64_t latency)
+    {
+        return LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(latency));
+    }
+
+    LatencyHistogram m_sut;
+};
+
+TEST_F(LatencyHistogram_test, NewHistogramIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c38b3b31-5978-4e1e-993f-b5d15329721d");
+    auto snapshot = m_sut.snapshot();
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(0U));
+    EXPECT_THAT(snapshot.percentile(99.0), Eq(0U));
+    EXPECT_THAT(snapshot.max(), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, SmallLatenciesHaveExactBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9909d2a-c553-45f5-bf60-93bb448d1263");
+    for (uint64_t latency = 0U; latency < LatencyHistogram::NUMBER_OF_SUB_BUCKETS; ++latency)
+    {
+        EXPECT_THAT(LatencyHistogram::bucketIndex(latency), Eq(latency));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(latency), Eq(latency));
+    }
+}
+
+TEST_F(LatencyHistogram_test, EveryLatencyIsInBucketWithinBounds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a26939f8-12b2-40cb-a3ff-6a86d5f16583");
+    for (uint64_t latency = 0U; latency < 100000U; ++latency)
+    {
+        const auto index = LatencyHistogram::bucketIndex(latency);
+        ASSERT_THAT(latency, Le(LatencyHistogram::bucketUpperBound(index)));
+        if (index > 0U)
+        {
+            ASSERT_THAT(latency, Gt(LatencyHistogram::bucketUpperBound(index - 1U)));
+        }
+    }
+}
+
+TEST_F(LatencyHistogram_test, BucketUpperBoundIsAtMostAQuarterAboveLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c490e00-e699-4200-a42e-c48cd1d7bf3f");
+    for (uint64_t latency = 1U; latency < 100000U; latency += 7U)
+    {
+        EXPECT_THAT(upperBoundOf(latency) - latency, Le(latency / 4U));
+    }
+}
+
+TEST_F(LatencyHistogram_test, LatenciesBeyondRangeAreCountedInLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "42d79b8f-f0c1-41d3-8916-c35c3e7cf331");
+    constexpr uint64_t LAST_BUCKET{LatencyHistogram::NUMBER_OF_BUCKETS - 1U};
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()), Eq(LAST_BUCKET));
+
+    m_sut.record(std::numeric_limits<uint64_t>::max());
+
+    auto snapshot = m_sut.snapshot();
+    EXPECT_THAT(snapshot.counts[LAST_BUCKET], Eq(1U));
+    EXPECT_THAT(snapshot.max(), Eq(LatencyHistogram::bucketUpperBound(LAST_BUCKET)));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesAreUpperBoundsOfTheirBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c57aefc-f1b3-4ca1-9bff-6d77b1323384");
+    constexpr uint64_t FAST{1000U};
+    constexpr uint64_t SLOW{100000U};
+    for (uint64_t i = 0U; i < 98U; ++i)
+    {
+        m_sut.record(FAST);
+    }
+    m_sut.record(SLOW);
+    m_sut.record(SLOW);
+
+    auto snapshot = m_sut.snapshot();
+    EXPECT_THAT(snapshot.numberOfSamples(), Eq(100U));
+    EXPECT_THAT(snapshot.percentile(0.0), Eq(upperBoundOf(FAST)));
+    EXPECT_THAT(snapshot.percentile(50.0), Eq(upperBoundOf(FAST)));
+    EXPECT_THAT(snapshot.percentile(98.0), Eq(upperBoundOf(FAST)));
+    EXPECT_THAT(snapshot.percentile(99.0), Eq(upperBoundOf(SLOW)));
+    EXPECT_THAT(snapshot.max(), Eq(upperBoundOf(SLOW)));
+}
+
+TEST_F(LatencyHistogram_test, SnapshotAndResetEmptiesHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "83ad2592-0afb-4ab4-9418-3e67c44d83ee");
+    m_sut.record(42U);
+    m_sut.record(4242U);
+
+    EXPECT_THAT(m_sut.snapshotAndReset().numberOfSamples(), Eq(2U));
+    EXPECT_THAT(m_sut.snapshot().numberOfSamples(), Eq(0U));
+
+    m_sut.record(42U);
+    EXPECT_THAT(m_sut.snapshotAndReset().numberOfSamples(), Eq(1U));
+}
+
+TEST_F(LatencyHistogram_test, ConcurrentRecordsAreNotLostBySnapshotAndReset)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4bce28e8-0bed-4103-abdc-de986afa57d1");
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t SAMPLES_PER_THREAD{10000U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&] {
+            for (uint64_t i = 0U; i < SAMPLES_PER_THREAD; ++i)
+            {
+                m_sut.record(i);
+            }
+        });
+    }
+
+    uint64_t numberOfSamples{0U};
+    for (uint64_t i = 0U; i < 100U; ++i)
+    {
+        numberOfSamples += m_sut.snapshotAndReset().numberOfSamples();
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    numberOfSamples += m_sut.snapshotAndReset().numberOfSamples();
+
+    EXPECT_THAT(numberOfSamples, Eq(NUMBER_OF_THREADS * SAMPLES_PER_THREAD));
+}
+
+} // namespace
@@ -134,8 +134,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const WaitOptions& waitOptions = {}) noexcept
+        : Listener(data, waitOptions)
     {
     }
 };
@@ -697,6 +697,39 @@ TIMING_TEST_F(Listener_test, CallbackWithUserTypeIsCalledAfterNotify, Repeat(5),
     TIMING_TEST_EXPECT_TRUE(userType == 1U);
 });
 
+TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotifyWithBusyPolling, Repeat(5), [&] {
+    m_sut.emplace(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLLING, 0_s});
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+});
+
+TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotifyWithSpinThenBlock, Repeat(5), [&] {
+    m_sut.emplace(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 1_ms});
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+});
+
 TIMING_TEST_F(Listener_test, CallbackIsCalledOnlyOnceWhenTriggered, Repeat(5), [&] {
     m_sut.emplace(m_condVarData);
     SimpleEventClass fuu1;
@@ -15,6 +15,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "mocks/publisher_mock.hpp"
@@ -275,6 +276,33 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, PublishingBatchSendsAllUnderlyingMemoryChunksInOneCallOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d953d6b-991b-4145-911a-ff16839aec6f");
+    ChunkMock<DummyData> anotherChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(anotherChunkMock.chunkHeader()))));
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) {
+            sentChunkHeaders.assign(chunkHeaders, chunkHeaders + numberOfChunks);
+        }));
+    EXPECT_CALL(portMock, sendChunk(_)).Times(0);
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    iox::cxx::vector<iox::popo::Sample<DummyData>, 2U> samples;
+    sut.loan().and_then([&](auto& sample) { samples.emplace_back(std::move(sample)); });
+    sut.loan().and_then([&](auto& sample) { samples.emplace_back(std::move(sample)); });
+    ASSERT_THAT(samples.size(), Eq(2U));
+    sut.publishBatch(samples.data(), samples.size());
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_THAT(sentChunkHeaders[0], Eq(chunkMock.chunkHeader()));
+    EXPECT_THAT(sentChunkHeaders[1], Eq(anotherChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -32,6 +32,9 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.inlineSamplePolicy = iox::popo::InlineSamplePolicy::ENABLED;
+    testOptions.waitForConsumerTimeout = iox::units::Duration::fromMilliseconds(73U);
+    testOptions.stampPublishTimestamp = true;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +49,27 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.inlineSamplePolicy, Ne(defaultOptions.inlineSamplePolicy));
+            EXPECT_THAT(roundTripOptions.inlineSamplePolicy, Eq(testOptions.inlineSamplePolicy));
+
+            EXPECT_THAT(roundTripOptions.waitForConsumerTimeout, Ne(defaultOptions.waitForConsumerTimeout));
+            EXPECT_THAT(roundTripOptions.waitForConsumerTimeout, Eq(testOptions.waitForConsumerTimeout));
+
+            EXPECT_THAT(roundTripOptions.stampPublishTimestamp, Ne(defaultOptions.stampPublishTimestamp));
+            EXPECT_THAT(roundTripOptions.stampPublishTimestamp, Eq(testOptions.stampPublishTimestamp));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
+}
+
+TEST(PublisherOptions_test, SerializationRoundTripKeepsInfiniteWaitForConsumerTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d1820a1-f8a0-4e44-98ae-dc0eef86c0f4");
+    iox::popo::PublisherOptions testOptions;
+
+    iox::popo::PublisherOptions::deserialize(testOptions.serialize())
+        .and_then([&](auto& roundTripOptions) {
+            EXPECT_THAT(roundTripOptions.waitForConsumerTimeout, Eq(iox::units::Duration::max()));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +90,47 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr std::underlying_type_t<iox::popo::InlineSamplePolicy> INLINE_SAMPLE_POLICY{
+        static_cast<std::underlying_type_t<iox::popo::InlineSamplePolicy>>(iox::popo::InlineSamplePolicy::DISABLED)};
+    constexpr bool HAS_WAIT_FOR_CONSUMER_TIMEOUT{false};
+    constexpr uint64_t WAIT_FOR_CONSUMER_TIMEOUT_NS{0U};
+    constexpr bool STAMP_PUBLISH_TIMESTAMP{false};
+
+    const auto serialized = iox::cxx::Serialization::create(HISTORY_CAPACITY,
+                                                            NODE_NAME,
+                                                            OFFER_ON_CREATE,
+                                                            SUBSCRIBER_TOO_SLOW_POLICY,
+                                                            INLINE_SAMPLE_POLICY,
+                                                            HAS_WAIT_FOR_CONSUMER_TIMEOUT,
+                                                            WAIT_FOR_CONSUMER_TIMEOUT_NS,
+                                                            STAMP_PUBLISH_TIMESTAMP);
+    iox::popo::PublisherOptions::deserialize(serialized)
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
+TEST(PublisherOptions_test, DeserializingInvalidInlineSamplePolicyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39c63934-f2b0-4e64-943e-7b6194a3024f");
+    constexpr uint64_t HISTORY_CAPACITY{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool OFFER_ON_CREATE{true};
+    constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{
+        static_cast<std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy>>(
+            iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)};
+    constexpr std::underlying_type_t<iox::popo::InlineSamplePolicy> INLINE_SAMPLE_POLICY{111};
+    constexpr bool HAS_WAIT_FOR_CONSUMER_TIMEOUT{false};
+    constexpr uint64_t WAIT_FOR_CONSUMER_TIMEOUT_NS{0U};
+    constexpr bool STAMP_PUBLISH_TIMESTAMP{false};
 
-    const auto serialized =
-        iox::cxx::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::cxx::Serialization::create(HISTORY_CAPACITY,
+                                                            NODE_NAME,
+                                                            OFFER_ON_CREATE,
+                                                            SUBSCRIBER_TOO_SLOW_POLICY,
+                                                            INLINE_SAMPLE_POLICY,
+                                                            HAS_WAIT_FOR_CONSUMER_TIMEOUT,
+                                                            WAIT_FOR_CONSUMER_TIMEOUT_NS,
+                                                            STAMP_PUBLISH_TIMESTAMP);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
@@ -34,6 +34,7 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.offerOnCreate = false;
     testOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.maxRequestsInFlight = 13;
 
     iox::popo::ServerOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +52,9 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Ne(defaultOptions.clientTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Eq(testOptions.clientTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.maxRequestsInFlight, Ne(defaultOptions.maxRequestsInFlight));
+            EXPECT_THAT(roundTripOptions.maxRequestsInFlight, Eq(testOptions.maxRequestsInFlight));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of ServerOptions failed!"; });
 }
@@ -72,9 +76,14 @@ iox::cxx::Serialization enumSerialization(QueueFullPolicyUT requsetQueueFullPoli
     constexpr uint64_t REQUEST_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
-
-    return iox::cxx::Serialization::create(
-        REQUEST_QUEUE_CAPACITY, NODE_NAME, OFFER_ON_CREATE, requsetQueueFullPolicy, clientTooSlowPolicy);
+    constexpr uint64_t MAX_REQUESTS_IN_FLIGHT{7U};
+
+    return iox::cxx::Serialization::create(REQUEST_QUEUE_CAPACITY,
+                                           NODE_NAME,
+                                           OFFER_ON_CREATE,
+                                           requsetQueueFullPolicy,
+                                           clientTooSlowPolicy,
+                                           MAX_REQUESTS_IN_FLIGHT);
 }
 
 TEST(ServerOptions_test, DeserializingValidRequestQueueFullPolicyAndClientTooSlowPolicyIsSuccessful)
@@ -188,4 +197,16 @@ TEST(ServerOptions_test, ComparisonOperatorReturnsFalseClientTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ServerOptions_test, ComparisonOperatorReturnsFalseMaxRequestsInFlightDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52d0fa04-63fa-4f9f-891d-2eb5c86a13ff");
+    ServerOptions options1;
+    options1.maxRequestsInFlight = 2;
+    ServerOptions options2;
+    options2.maxRequestsInFlight = 8;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -177,6 +177,7 @@ class ServerPort_test : public Test
     }
 
     static constexpr uint64_t QUEUE_CAPACITY{iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY * 2U};
+    static constexpr uint64_t MAX_REQUESTS_IN_FLIGHT{iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY + 2U};
 
   private:
     static constexpr uint32_t NUM_CHUNKS =
@@ -218,6 +219,13 @@ class ServerPort_test : public Test
         options.clientTooSlowPolicy = ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
         return options;
     }();
+    ServerOptions m_serverOptionsWithCustomMaxRequestsInFlight = [&] {
+        ServerOptions options;
+        options.offerOnCreate = true;
+        options.requestQueueCapacity = QUEUE_CAPACITY;
+        options.maxRequestsInFlight = MAX_REQUESTS_IN_FLIGHT;
+        return options;
+    }();
 
     iox::cxx::optional<SutServerPort> clientPortForStateTransitionTests;
 
@@ -237,6 +245,8 @@ class ServerPort_test : public Test
         m_serviceDescription, m_runtimeName, m_serverOptionsWithBlockProducerRequestQueueFullPolicy, m_memoryManager};
     SutServerPort serverOptionsWithWaitForConsumerClientTooSlowPolicy{
         m_serviceDescription, m_runtimeName, m_serverOptionsWithWaitForConsumerClientTooSlowPolicy, m_memoryManager};
+    SutServerPort serverPortWithCustomMaxRequestsInFlight{
+        m_serviceDescription, m_runtimeName, m_serverOptionsWithCustomMaxRequestsInFlight, m_memoryManager};
 };
 
 } // namespace iox_test_popo_server_port
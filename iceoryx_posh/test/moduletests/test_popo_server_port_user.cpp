@@ -17,6 +17,10 @@
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
 #include "test_popo_server_port_common.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace iox_test_popo_server_port
 {
 // NOTE tests related to QueueFullPolicy are done in test_client_server.cpp integration test
@@ -323,6 +327,34 @@ TEST_F(ServerPort_test, GetRequestWithMultipleRequestsResultsInAsManyRequestHead
         .or_else([&](const auto& error) { GTEST_FAIL() << "Expected RequestHeader but got error: " << error; });
 }
 
+TEST_F(ServerPort_test, GetRequestsWithMultipleRequestsProvidesAllRequestsInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f1c3b9e-2a5d-4e80-b6c4-d91e0a3f5c28");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t REQUEST_DATA_BASE{73};
+    constexpr uint64_t NUMBER_OF_REQUESTS{3U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS, REQUEST_DATA_BASE);
+
+    uint64_t expectedRequestData{REQUEST_DATA_BASE};
+    sut.portUser
+        .getRequests(NUMBER_OF_REQUESTS + 1U,
+                     [&](const auto* req) { EXPECT_THAT(this->getRequestData(req), Eq(expectedRequestData++)); })
+        .and_then([&](const auto numberOfRequests) { EXPECT_THAT(numberOfRequests, Eq(NUMBER_OF_REQUESTS)); })
+        .or_else([&](const auto& error) { GTEST_FAIL() << "Expected requests but got error: " << error; });
+    EXPECT_THAT(expectedRequestData, Eq(REQUEST_DATA_BASE + NUMBER_OF_REQUESTS));
+}
+
+TEST_F(ServerPort_test, GetRequestsWithNoRequestsResultsInNoPendingRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c83e0d41-5f7a-4b29-9e16-a2b4f8c07d35");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    sut.portUser.getRequests(2U, [&](const auto*) { GTEST_FAIL() << "Expected no request"; })
+        .and_then([&](const auto) { GTEST_FAIL() << "Expected ServerRequestResult::NO_PENDING_REQUESTS"; })
+        .or_else([&](const auto& error) { EXPECT_THAT(error, Eq(ServerRequestResult::NO_PENDING_REQUESTS)); });
+}
+
 TEST_F(ServerPort_test, GetRequestWithMaximalHeldChunksInParallelResultsInRequestHeader)
 {
     ::testing::Test::RecordProperty("TEST_ID", "19c19b39-2dd1-4784-a1c1-adfba56248e8");
@@ -373,6 +405,71 @@ TEST_F(ServerPort_test, GetRequestWhenProcessingTooManyRequestsInParallelResults
         });
 }
 
+TEST_F(ServerPort_test, GetRequestWithCustomMaxRequestsInFlightResultsIn_TOO_MANY_REQUESTS_HELD_IN_PARALLEL)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e582db3e-36f3-481b-8fda-41b36b57c3c0");
+    auto& sut = serverPortWithCustomMaxRequestsInFlight;
+
+    // like for the default, one additional request can be held to be able to release one request after the next
+    // one was fetched
+    constexpr uint64_t MAX_REQUEST_HELD_IN_PARALLEL = MAX_REQUESTS_IN_FLIGHT + 1;
+
+    pushRequests(sut.requestQueuePusher, MAX_REQUEST_HELD_IN_PARALLEL + 1);
+
+    for (uint64_t i = 0; i < MAX_REQUEST_HELD_IN_PARALLEL; ++i)
+    {
+        EXPECT_FALSE(sut.portUser.getRequest().has_error());
+    }
+
+    sut.portUser.getRequest()
+        .and_then([&](const auto&) {
+            GTEST_FAIL() << "Expected ServerRequestResult::TOO_MANY_REQUESTS_HELD_IN_PARALLEL but got request";
+        })
+        .or_else([&](const auto& error) {
+            EXPECT_THAT(error, Eq(ServerRequestResult::TOO_MANY_REQUESTS_HELD_IN_PARALLEL));
+        });
+}
+
+TEST_F(ServerPort_test, GetAndReleaseRequestFromMultipleThreadsProcessesEachRequestOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "37bbda99-bd1d-4c88-9f6b-864e922f094a");
+    auto& sut = serverPortWithCustomMaxRequestsInFlight;
+
+    constexpr uint64_t REQUEST_DATA_BASE{313};
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    pushRequests(sut.requestQueuePusher, QUEUE_CAPACITY, REQUEST_DATA_BASE);
+
+    std::atomic<uint64_t> processedRequests{0U};
+    std::atomic<uint64_t> sumOfRequestData{0U};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            while (true)
+            {
+                auto requestResult = sut.portUser.getRequest();
+                if (requestResult.has_error())
+                {
+                    EXPECT_THAT(requestResult.get_error(), Eq(ServerRequestResult::NO_PENDING_REQUESTS));
+                    return;
+                }
+                sumOfRequestData += this->getRequestData(requestResult.value());
+                ++processedRequests;
+                sut.portUser.releaseRequest(requestResult.value());
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    constexpr uint64_t EXPECTED_SUM{QUEUE_CAPACITY * REQUEST_DATA_BASE + QUEUE_CAPACITY * (QUEUE_CAPACITY - 1) / 2};
+    EXPECT_THAT(processedRequests.load(), Eq(QUEUE_CAPACITY));
+    EXPECT_THAT(sumOfRequestData.load(), Eq(EXPECTED_SUM));
+}
+
 // END getRequest tests
 
 // BEGIN releaseRequest tests
@@ -34,6 +34,10 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.subscribeOnCreate = false;
     testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.requiresPublisherHistorySupport = true;
+    testOptions.notificationPolicy = iox::popo::QueueNotificationPolicy::AFTER_MIN_INTERVAL;
+    testOptions.notificationThreshold = 13;
+    testOptions.maxNotificationDelay = iox::units::Duration::fromMilliseconds(73U);
+    testOptions.minNotificationInterval = iox::units::Duration::fromMicroseconds(666);
 
     iox::popo::SubscriberOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -53,6 +57,17 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
             EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
             EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
                         Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.notificationPolicy, Ne(defaultOptions.notificationPolicy));
+            EXPECT_THAT(roundTripOptions.notificationPolicy, Eq(testOptions.notificationPolicy));
+
+            EXPECT_THAT(roundTripOptions.notificationThreshold, Ne(defaultOptions.notificationThreshold));
+            EXPECT_THAT(roundTripOptions.notificationThreshold, Eq(testOptions.notificationThreshold));
+            EXPECT_THAT(roundTripOptions.maxNotificationDelay, Ne(defaultOptions.maxNotificationDelay));
+            EXPECT_THAT(roundTripOptions.maxNotificationDelay, Eq(testOptions.maxNotificationDelay));
+
+            EXPECT_THAT(roundTripOptions.minNotificationInterval, Ne(defaultOptions.minNotificationInterval));
+            EXPECT_THAT(roundTripOptions.minNotificationInterval, Eq(testOptions.minNotificationInterval));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of SubscriberOptions failed!"; });
 }
@@ -82,4 +97,32 @@ TEST(SubscriberOptions_test, DeserializingInvalidQueueFullPolicyFails)
         .or_else([&](auto&) { GTEST_SUCCEED(); });
 }
 
+TEST(SubscriberOptions_test, DeserializingInvalidQueueNotificationPolicyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a645d70a-f44e-431b-aead-94e70dada5c2");
+    constexpr uint64_t QUEUE_CAPACITY{73U};
+    constexpr uint64_t HISTORY_REQUEST{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool SUBSCRIBE_ON_CREATE{true};
+    constexpr std::underlying_type_t<iox::popo::QueueFullPolicy> QUEUE_FULL_POLICY{
+        static_cast<std::underlying_type_t<iox::popo::QueueFullPolicy>>(iox::popo::QueueFullPolicy::BLOCK_PRODUCER)};
+    constexpr bool REQUIRES_PUBLISHER_HISTORY_SUPPORT{false};
+    constexpr std::underlying_type_t<iox::popo::QueueNotificationPolicy> QUEUE_NOTIFICATION_POLICY{111};
+    constexpr uint64_t NOTIFICATION_THRESHOLD{1U};
+    constexpr uint64_t MIN_NOTIFICATION_INTERVAL_NS{0U};
+
+    const auto serialized = iox::cxx::Serialization::create(QUEUE_CAPACITY,
+                                                            HISTORY_REQUEST,
+                                                            NODE_NAME,
+                                                            SUBSCRIBE_ON_CREATE,
+                                                            QUEUE_FULL_POLICY,
+                                                            REQUIRES_PUBLISHER_HISTORY_SUPPORT,
+                                                            QUEUE_NOTIFICATION_POLICY,
+                                                            NOTIFICATION_THRESHOLD,
+                                                            MIN_NOTIFICATION_INTERVAL_NS);
+    iox::popo::SubscriberOptions::deserialize(serialized)
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
 } // namespace
@@ -96,6 +96,30 @@ TEST_F(SubscriberPortSingleProducer_test, InitialStateNoChunksAvailable)
     EXPECT_FALSE(m_sutUserSideSingleProducer.hasNewChunks());
 }
 
+TEST_F(SubscriberPortSingleProducer_test, NotificationPolicyOfOptionsIsAppliedToTheChunkQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "637dfba2-b2c7-4f68-8904-f54e451a4b4e");
+    iox::popo::SubscriberOptions options;
+    options.notificationPolicy = iox::popo::QueueNotificationPolicy::AFTER_NUMBER_OF_CHUNKS;
+    options.notificationThreshold = 7U;
+    options.maxNotificationDelay = iox::units::Duration::fromMilliseconds(3U);
+    options.minNotificationInterval = iox::units::Duration::fromMilliseconds(5U);
+    iox::popo::SubscriberPortData portData{
+        TEST_SERVICE_DESCRIPTION, "myApp", iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer, options};
+
+    EXPECT_THAT(portData.m_chunkReceiverData.m_notificationPolicy, Eq(options.notificationPolicy));
+    EXPECT_THAT(portData.m_chunkReceiverData.m_notificationThreshold, Eq(options.notificationThreshold));
+    EXPECT_THAT(portData.m_chunkReceiverData.m_maxNotificationDelay, Eq(options.maxNotificationDelay));
+    EXPECT_THAT(portData.m_chunkReceiverData.m_minNotificationInterval, Eq(options.minNotificationInterval));
+}
+
+TEST_F(SubscriberPortSingleProducer_test, DefaultOptionsNotifyOnEveryChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08cd3e0a-ca7b-4db3-98b7-93610393968e");
+    EXPECT_THAT(m_subscriberPortDataDefaultOptions.m_chunkReceiverData.m_notificationPolicy,
+                Eq(iox::popo::QueueNotificationPolicy::ON_EVERY_CHUNK));
+}
+
 TEST_F(SubscriberPortSingleProducer_test, InitialStateNoChunksLost)
 {
     ::testing::Test::RecordProperty("TEST_ID", "d59df0c5-8635-41ab-b0fe-51c57fb9d66a");
@@ -0,0 +1,164 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public iox::popo::WaitSet<>
+{
+  public:
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class TimerTrigger_test : public Test
+{
+  public:
+    ConditionVariableData m_condVar{"Brezel"};
+    WaitSetTest m_waitSet{m_condVar};
+};
+
+TEST_F(TimerTrigger_test, IsNotTriggeredWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "434debb8-5052-4def-9b99-651379d8eb79");
+    TimerTrigger sut(1_ms);
+    EXPECT_FALSE(sut.hasTriggered());
+    EXPECT_THAT(sut.takeExpirations(), Eq(0U));
+}
+
+TEST_F(TimerTrigger_test, StartingWithZeroIntervalFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7436122a-8c5f-4015-89b1-ccdb33511c69");
+    TimerTrigger sut(0_ms);
+    auto result = sut.start();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(TimerTriggerError::INVALID_INTERVAL));
+}
+
+TEST_F(TimerTrigger_test, StoppedTimerDoesNotTriggerWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dd579cb-ec94-41f8-9000-b653dc286ae6");
+    TimerTrigger sut(1_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, 1U).has_error());
+
+    EXPECT_THAT(m_waitSet.timedWait(20_ms).size(), Eq(0U));
+    EXPECT_FALSE(sut.hasTriggered());
+}
+
+TEST_F(TimerTrigger_test, OneShotTimerTriggersWaitSetOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b931fad-eff5-49e8-934f-843667214413");
+    TimerTrigger sut(5_ms, TimerMode::ONE_SHOT);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, 73U).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    auto result = m_waitSet.timedWait(1_s);
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0U]->getNotificationId(), Eq(73U));
+    EXPECT_TRUE(result[0U]->doesOriginateFrom(&sut));
+    EXPECT_THAT(sut.takeExpirations(), Eq(1U));
+
+    EXPECT_THAT(m_waitSet.timedWait(30_ms).size(), Eq(0U));
+    EXPECT_THAT(sut.takeExpirations(), Eq(0U));
+}
+
+TEST_F(TimerTrigger_test, PeriodicTimerTriggersWaitSetRepeatedly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e63dd1c-c4df-411c-a184-3c653ded51ea");
+    TimerTrigger sut(2_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    uint64_t expirations{0U};
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        ASSERT_THAT(m_waitSet.timedWait(1_s).size(), Eq(1U));
+        expirations += sut.takeExpirations();
+    }
+    EXPECT_THAT(expirations, Ge(3U));
+}
+
+TEST_F(TimerTrigger_test, ExpirationsAreCountedWhileTheNotificationIsNotHandled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f97bfe3-e361-48d0-9c60-d78a0ca9fcd8");
+    TimerTrigger sut(1_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    sut.stop();
+
+    EXPECT_THAT(m_waitSet.timedWait(1_s).size(), Eq(1U));
+    EXPECT_THAT(sut.takeExpirations(), Ge(2U));
+}
+
+TEST_F(TimerTrigger_test, StopHaltsThePeriodicTimer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "694b11e3-1075-400a-8386-718e9e1ff322");
+    TimerTrigger sut(2_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+    ASSERT_THAT(m_waitSet.timedWait(1_s).size(), Eq(1U));
+
+    sut.stop();
+    // a notification which was in flight when the timer was stopped is consumed here
+    IOX_DISCARD_RESULT(m_waitSet.timedWait(10_ms));
+    IOX_DISCARD_RESULT(sut.takeExpirations());
+
+    EXPECT_THAT(m_waitSet.timedWait(30_ms).size(), Eq(0U));
+    EXPECT_THAT(sut.takeExpirations(), Eq(0U));
+}
+
+TEST_F(TimerTrigger_test, TimerGoesOutOfScopeCleansUpAtWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f89d16e-8d98-4d8e-9525-5e336a19da10");
+    {
+        TimerTrigger sut(1_ms);
+        ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+        ASSERT_FALSE(sut.start().has_error());
+    }
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+}
+
+TEST_F(TimerTrigger_test, DetachedTimerDoesNotTriggerWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c31d65cf-4825-4601-8907-c7b1120de238");
+    TimerTrigger sut(1_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    m_waitSet.detachEvent(sut);
+    ASSERT_FALSE(sut.start().has_error());
+
+    EXPECT_THAT(m_waitSet.timedWait(20_ms).size(), Eq(0U));
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+}
+} // namespace
@@ -138,6 +138,27 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, PublishesBatchOfUserPayloadsInOneCallViaUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "172dae2d-04bf-4d1e-872a-eca4f7150ccf");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> anotherChunkMock;
+    void* userPayloads[] = {chunkMock.chunkHeader()->userPayload(), anotherChunkMock.chunkHeader()->userPayload()};
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) {
+            sentChunkHeaders.assign(chunkHeaders, chunkHeaders + numberOfChunks);
+        }));
+    EXPECT_CALL(portMock, sendChunk).Times(0);
+    // ===== Test ===== //
+    sut.publishBatch(userPayloads, 2U);
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_THAT(sentChunkHeaders[0], Eq(chunkMock.chunkHeader()));
+    EXPECT_THAT(sentChunkHeaders[1], Eq(anotherChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
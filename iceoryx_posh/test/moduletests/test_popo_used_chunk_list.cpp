@@ -123,6 +123,31 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, ReserveIsLimitedToFreeEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9fbc73a-64c6-4038-b334-ab4cb26130f7");
+    constexpr uint32_t NUMBER_OF_INSERTED_CHUNKS{7U};
+    createMultipleChunks(NUMBER_OF_INSERTED_CHUNKS, [this](SharedChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
+
+    EXPECT_THAT(sut.reserve(USED_CHUNK_LIST_CAPACITY), Eq(USED_CHUNK_LIST_CAPACITY - NUMBER_OF_INSERTED_CHUNKS));
+    EXPECT_THAT(sut.reserve(1U), Eq(0U));
+}
+
+TEST_F(UsedChunkList_test, ReservedEntriesCannotBeTakenByInsert)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "51e6a845-822a-4071-ace3-3deaf6c03d9a");
+    constexpr uint32_t NUMBER_OF_RESERVED_CHUNKS{2U};
+    EXPECT_THAT(sut.reserve(NUMBER_OF_RESERVED_CHUNKS), Eq(NUMBER_OF_RESERVED_CHUNKS));
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY - NUMBER_OF_RESERVED_CHUNKS,
+                         [this](SharedChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+
+    sut.insertReserved(getChunkFromMemoryManager());
+    sut.cancelReservation(1U);
+    EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
@@ -27,6 +28,7 @@
 
 #include <chrono>
 #include <memory>
+#include <poll.h>
 #include <thread>
 
 namespace
@@ -40,8 +42,8 @@ using namespace iox::units::duration_literals;
 class WaitSetTest : public iox::popo::WaitSet<>
 {
   public:
-    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
-        : WaitSet(condVarData)
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData, const iox::popo::WaitOptions& waitOptions = {}) noexcept
+        : WaitSet(condVarData, waitOptions)
     {
     }
 };
@@ -974,6 +976,35 @@ TEST_F(WaitSet_test, TimedWaitReturnsTheOneTriggeredCondition)
     WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->timedWait(10_ms); });
 }
 
+TEST_F(WaitSet_test, BusyPollingWaitReturnsTheOneConditionTriggeredByOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a39d9c1-7727-449f-af54-dbfab673254b");
+    m_sut.emplace(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLLING, 0_s});
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+
+    std::thread t([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_simpleEvents[0].trigger();
+    });
+
+    auto triggerVector = m_sut->wait();
+    t.join();
+
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), 5U);
+    EXPECT_TRUE(triggerVector[0U]->doesOriginateFrom(&m_simpleEvents[0]));
+}
+
+TEST_F(WaitSet_test, SpinThenBlockTimedWaitReturnsNothingWhenNothingTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd66be20-ff10-4c9c-9944-6ce40c027d77");
+    m_sut.emplace(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 1_ms});
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+
+    auto triggerVector = m_sut->timedWait(10_ms);
+    EXPECT_THAT(triggerVector.size(), Eq(0U));
+}
+
 void WaitReturnsAllTriggeredConditionWhenMultipleAreTriggered(
     WaitSet_test* test, const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -1532,4 +1563,108 @@ TEST_F(WaitSet_test, TimedWaitUnblocksAfterMarkForDestructionCall)
     t.join();
 }
 
+bool isFileDescriptorReadable(const int32_t fileDescriptor)
+{
+    pollfd pollFd{fileDescriptor, POLLIN, 0};
+    return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+}
+
+TEST_F(WaitSet_test, GetFileDescriptorReturnsTheSameFileDescriptorOnEveryCall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "01650934-0bca-468d-896b-caecb017bf1f");
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    EXPECT_THAT(fileDescriptor.value(), Ge(0));
+
+    auto secondFileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(secondFileDescriptor.has_error());
+    EXPECT_THAT(secondFileDescriptor.value(), Eq(fileDescriptor.value()));
+}
+
+TEST_F(WaitSet_test, FileDescriptorIsNotReadableWhenNothingWasNotified)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2807df55-3c0f-4640-ac24-2ba01a01aa50");
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    EXPECT_FALSE(isFileDescriptorReadable(fileDescriptor.value()));
+}
+
+TEST_F(WaitSet_test, FileDescriptorBecomesReadableWhenTriggerIsTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd4bbb24-6e90-426d-ae9f-50c8c9ec6ba0");
+    UserTrigger userTrigger;
+    ASSERT_FALSE(m_sut->attachEvent(userTrigger, 5U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    userTrigger.trigger();
+
+    EXPECT_TRUE(isFileDescriptorReadable(fileDescriptor.value()));
+    auto triggerVector = m_sut->timedWait(0_s);
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(5U));
+    EXPECT_FALSE(isFileDescriptorReadable(fileDescriptor.value()));
+}
+
+TEST_F(WaitSet_test, FileDescriptorBecomesReadableAgainForNotificationsAfterTheWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a3ab1fb-2e65-4ada-9383-c31575ef6a0c");
+    UserTrigger userTrigger;
+    ASSERT_FALSE(m_sut->attachEvent(userTrigger).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    userTrigger.trigger();
+    userTrigger.trigger();
+    ASSERT_THAT(m_sut->timedWait(0_s).size(), Eq(1U));
+    EXPECT_FALSE(isFileDescriptorReadable(fileDescriptor.value()));
+
+    userTrigger.trigger();
+    EXPECT_TRUE(isFileDescriptorReadable(fileDescriptor.value()));
+    EXPECT_THAT(m_sut->timedWait(0_s).size(), Eq(1U));
+}
+
+TEST_F(WaitSet_test, FileDescriptorIsSignaledByNotifierInAnotherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cce6f368-21ed-4f6b-ac91-325af26512d3");
+    UserTrigger userTrigger;
+    ASSERT_FALSE(m_sut->attachEvent(userTrigger, 9U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    std::thread t([&] { userTrigger.trigger(); });
+
+    pollfd pollFd{fileDescriptor.value(), POLLIN, 0};
+    EXPECT_THAT(poll(&pollFd, 1U, 1000), Eq(1));
+    t.join();
+
+    auto triggerVector = m_sut->timedWait(0_s);
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(9U));
+}
+
+TEST_F(WaitSet_test, FileDescriptorBecomesReadableAtTheDeadlineOfADeferredNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c288cbc2-c8a5-4848-ab72-b05cf513838d");
+    UserTrigger userTrigger;
+    ASSERT_FALSE(m_sut->attachEvent(userTrigger, 3U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    // the indices are handed out from a stack, the first attached trigger has the last one
+    ConditionNotifier notifier(m_condVarData, WaitSetTest::capacity() - 1U);
+    notifier.deferNotification(iox::units::Duration(std::chrono::steady_clock::now().time_since_epoch()) + 50_ms);
+    EXPECT_TRUE(isFileDescriptorReadable(fileDescriptor.value()));
+    EXPECT_TRUE(m_sut->timedWait(0_s).empty());
+    EXPECT_FALSE(isFileDescriptorReadable(fileDescriptor.value()));
+
+    pollfd pollFd{fileDescriptor.value(), POLLIN, 0};
+    EXPECT_THAT(poll(&pollFd, 1U, 1000), Eq(1));
+
+    auto triggerVector = m_sut->timedWait(0_s);
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(3U));
+}
+
 } // namespace
@@ -0,0 +1,211 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+struct ElementMock
+{
+    ElementMock(const uint64_t value, uint64_t* const destructorCounter = nullptr)
+        : m_value(value)
+        , m_destructorCounter(destructorCounter)
+    {
+    }
+
+    ~ElementMock()
+    {
+        if (m_destructorCounter != nullptr)
+        {
+            ++(*m_destructorCounter);
+        }
+    }
+
+    uint64_t m_value{0U};
+    uint64_t* m_destructorCounter{nullptr};
+};
+
+/// @note the capacity spans multiple bitmap words and is not a multiple of the word size
+constexpr uint64_t CAPACITY{150U};
+
+class FixedPositionContainer_test : public Test
+{
+  public:
+    void fillContainer()
+    {
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_THAT(sut.insert(i), Ne(nullptr));
+        }
+    }
+
+    std::vector<uint64_t> contentValues()
+    {
+        std::vector<uint64_t> values;
+        for (auto element : sut.content())
+        {
+            values.push_back(element->m_value);
+        }
+        return values;
+    }
+
+    FixedPositionContainer<ElementMock, CAPACITY> sut;
+};
+
+TEST_F(FixedPositionContainer_test, InitialContainerIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf48ca87-626f-40f4-a62d-f73fb6441fe6");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(sut.content().empty());
+    EXPECT_TRUE(sut.begin() == sut.end());
+    EXPECT_TRUE(sut.hasFreeSpace());
+}
+
+TEST_F(FixedPositionContainer_test, InsertedElementsAreIteratedInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64bb1696-0b4d-4b3a-856a-d5769efd2e96");
+    for (uint64_t i = 0U; i < 5U; ++i)
+    {
+        auto element = sut.insert(i);
+        ASSERT_THAT(element, Ne(nullptr));
+        EXPECT_THAT(element->m_value, Eq(i));
+    }
+
+    EXPECT_THAT(sut.content().size(), Eq(5U));
+    EXPECT_THAT(contentValues(), ElementsAre(0U, 1U, 2U, 3U, 4U));
+}
+
+TEST_F(FixedPositionContainer_test, InsertingIntoFullContainerFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb269782-f1b0-4585-b4da-6d519b43f947");
+    fillContainer();
+
+    EXPECT_FALSE(sut.hasFreeSpace());
+    EXPECT_THAT(sut.insert(CAPACITY), Eq(nullptr));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    EXPECT_THAT(contentValues().size(), Eq(CAPACITY));
+}
+
+TEST_F(FixedPositionContainer_test, ErasedElementIsNotIteratedAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a19a4dce-6a9c-4554-a3d4-f3db2831cf37");
+    sut.insert(0U);
+    auto element = sut.insert(1U);
+    sut.insert(2U);
+
+    sut.erase(element);
+
+    EXPECT_THAT(sut.size(), Eq(2U));
+    EXPECT_THAT(contentValues(), ElementsAre(0U, 2U));
+}
+
+TEST_F(FixedPositionContainer_test, ErasingUnknownElementHasNoEffect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "38065599-d8e4-48ed-b63c-f64a1ed3b4f1");
+    ElementMock unknownElement{73U};
+    auto element = sut.insert(0U);
+    sut.erase(element);
+
+    sut.erase(&unknownElement);
+    sut.erase(element);
+    sut.erase(nullptr);
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(sut.hasFreeSpace());
+}
+
+TEST_F(FixedPositionContainer_test, ErasedSlotIsReusedAtTheSamePosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cae5d911-dba8-49a9-86d6-0f8791ef8b82");
+    fillContainer();
+    auto element = *sut.begin();
+    for (auto e : sut.content())
+    {
+        if (e->m_value == 100U)
+        {
+            element = e;
+        }
+    }
+
+    sut.erase(element);
+    EXPECT_TRUE(sut.hasFreeSpace());
+
+    auto newElement = sut.insert(1000U);
+    EXPECT_THAT(newElement, Eq(element));
+    EXPECT_THAT(newElement->m_value, Eq(1000U));
+    EXPECT_FALSE(sut.hasFreeSpace());
+}
+
+TEST_F(FixedPositionContainer_test, ErasingTheCurrentElementWhileIteratingVisitsAllElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87681a86-699c-4bc8-a7a4-cee0ed05409a");
+    fillContainer();
+
+    uint64_t numberOfVisitedElements{0U};
+    for (auto element : sut.content())
+    {
+        ++numberOfVisitedElements;
+        if (element->m_value % 3U != 0U)
+        {
+            sut.erase(element);
+        }
+    }
+
+    EXPECT_THAT(numberOfVisitedElements, Eq(CAPACITY));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY / 3U));
+    for (auto value : contentValues())
+    {
+        EXPECT_THAT(value % 3U, Eq(0U));
+    }
+}
+
+TEST_F(FixedPositionContainer_test, IterationSkipsEmptyRegionsAcrossBitmapWords)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8cc8ca02-1a77-46c0-be64-5484c3bd35c2");
+    fillContainer();
+    for (auto element : sut.content())
+    {
+        if (element->m_value != 0U && element->m_value != 64U && element->m_value != CAPACITY - 1U)
+        {
+            sut.erase(element);
+        }
+    }
+
+    EXPECT_THAT(contentValues(), ElementsAre(0U, 64U, CAPACITY - 1U));
+}
+
+TEST_F(FixedPositionContainer_test, EraseAndDestructionCallTheElementDestructor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40b1d1bd-319a-490d-9ff9-acecfbb3e77b");
+    uint64_t destructorCounter{0U};
+    {
+        FixedPositionContainer<ElementMock, CAPACITY> container;
+        auto element = container.insert(0U, &destructorCounter);
+        container.insert(1U, &destructorCounter);
+        container.insert(2U, &destructorCounter);
+
+        container.erase(element);
+        EXPECT_THAT(destructorCounter, Eq(1U));
+    }
+    EXPECT_THAT(destructorCounter, Eq(3U));
+}
+
+} // namespace
@@ -999,4 +999,67 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, DeletePortsOfProcessWithMorePortsThanABatchDisconnectsAllPeers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6ce8a1a-fac1-43d9-aaa7-e58c751c33ca");
+    constexpr uint64_t NUMBER_OF_SERVICES{70U};
+    const iox::RuntimeName_t dyingRuntimeName{"dying"};
+    const iox::RuntimeName_t survivingRuntimeName{"surviving"};
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), true};
+
+    std::vector<PublisherPortRouDiType::MemberType_t*> survivingPublishers;
+    std::vector<SubscriberPortType::MemberType_t*> survivingSubscribers;
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        const iox::capro::IdString_t service(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(i));
+        const ServiceDescription dyingService{service, "dying", "event"};
+        const ServiceDescription survivingService{service, "surviving", "event"};
+
+        ASSERT_FALSE(m_portManager
+                         ->acquirePublisherPortData(dyingService,
+                                                    publisherOptions,
+                                                    dyingRuntimeName,
+                                                    m_payloadDataSegmentMemoryManager,
+                                                    PortConfigInfo())
+                         .has_error());
+        ASSERT_FALSE(m_portManager
+                         ->acquireSubscriberPortData(
+                             survivingService, subscriberOptions, dyingRuntimeName, PortConfigInfo())
+                         .has_error());
+
+        survivingPublishers.push_back(m_portManager
+                                          ->acquirePublisherPortData(survivingService,
+                                                                     publisherOptions,
+                                                                     survivingRuntimeName,
+                                                                     m_payloadDataSegmentMemoryManager,
+                                                                     PortConfigInfo())
+                                          .value());
+        survivingSubscribers.push_back(
+            m_portManager
+                ->acquireSubscriberPortData(dyingService, subscriberOptions, survivingRuntimeName, PortConfigInfo())
+                .value());
+    }
+    m_portManager->doDiscovery();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        ASSERT_TRUE(PublisherPortUser(survivingPublishers[i]).hasSubscribers());
+        ASSERT_THAT(SubscriberPortUser(survivingSubscribers[i]).getSubscriptionState(),
+                    Eq(iox::SubscribeState::SUBSCRIBED));
+    }
+
+    m_portManager->deletePortsOfProcess(dyingRuntimeName);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        EXPECT_FALSE(PublisherPortUser(survivingPublishers[i]).hasSubscribers());
+        if (std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+        {
+            EXPECT_THAT(SubscriberPortUser(survivingSubscribers[i]).getSubscriptionState(),
+                        Eq(iox::SubscribeState::WAIT_FOR_OFFER));
+        }
+    }
+}
+
 } // namespace iox_test_roudi_portmanager
@@ -155,10 +155,11 @@ TEST_F(PortPool_test, GetNodeDataListIsSuccessful)
 
     auto nodeDataList = sut.getNodeDataList();
 
-    EXPECT_EQ(nodeDataList.size(), 1U);
-    EXPECT_EQ(nodeDataList[0]->m_runtimeName, m_runtimeName);
-    EXPECT_EQ(nodeDataList[0]->m_nodeName, m_nodeName);
-    EXPECT_EQ(nodeDataList[0]->m_nodeDeviceIdentifier, m_nodeDeviceId);
+    ASSERT_EQ(nodeDataList.size(), 1U);
+    auto nodeData = *nodeDataList.begin();
+    EXPECT_EQ(nodeData->m_runtimeName, m_runtimeName);
+    EXPECT_EQ(nodeData->m_nodeName, m_nodeName);
+    EXPECT_EQ(nodeData->m_nodeDeviceIdentifier, m_nodeDeviceId);
 }
 
 TEST_F(PortPool_test, GetNodeDataListWhenEmptyIsSuccessful)
@@ -195,6 +196,22 @@ TEST_F(PortPool_test, RemoveNodeDataIsSuccessful)
     EXPECT_EQ(nodeDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetNodeDataListOfRuntimeReturnsOnlyTheNodesOfTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd8b2921-9dd7-45bd-854f-981b953ccbb1");
+    ASSERT_FALSE(sut.addNodeData(m_runtimeName, m_nodeName, 1U).has_error());
+    ASSERT_FALSE(sut.addNodeData(m_applicationName, m_nodeName, 2U).has_error());
+    ASSERT_FALSE(sut.addNodeData(m_runtimeName, m_nodeName, 3U).has_error());
+
+    auto nodeDataList = sut.getNodeDataList(m_runtimeName);
+
+    ASSERT_EQ(nodeDataList.size(), 2U);
+    for (auto nodeData : nodeDataList)
+    {
+        EXPECT_EQ(nodeData->m_runtimeName, m_runtimeName);
+    }
+}
+
 // END Node tests
 
 // BEGIN PublisherPort tests
@@ -326,6 +343,32 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(publisherPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetPublisherPortDataListOfRuntimeReturnsOnlyThePortsOfTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e65044a6-1b5c-408b-b59a-93b1fb975524");
+    ASSERT_FALSE(
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_runtimeName, m_publisherOptions).has_error());
+    ASSERT_FALSE(sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions)
+                     .has_error());
+
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_runtimeName);
+
+    ASSERT_EQ(publisherPortDataList.size(), 1U);
+    EXPECT_EQ(publisherPortDataList[0]->m_runtimeName, m_runtimeName);
+}
+
+TEST_F(PortPool_test, GetPublisherPortDataListOfRuntimeDoesNotContainRemovedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3c4aa05-4e71-40eb-8bf0-475664393824");
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+
+    sut.removePublisherPort(publisherPort.value());
+
+    EXPECT_EQ(sut.getPublisherPortDataList(m_applicationName).size(), 0U);
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -452,6 +495,21 @@ TEST_F(PortPool_test, RemoveSubscriberPortIsSuccessful)
     EXPECT_EQ(subscriberPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetSubscriberPortDataListOfRuntimeReturnsOnlyThePortsOfTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e0aef96-3ad4-4b2a-9608-a676bcbbc8c6");
+    ASSERT_FALSE(sut.addSubscriberPort(m_serviceDescription, m_runtimeName, m_subscriberOptions).has_error());
+    ASSERT_FALSE(sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions).has_error());
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+
+    sut.removeSubscriberPort(subscriberPort.value());
+    auto subscriberPortDataList = sut.getSubscriberPortDataList(m_applicationName);
+
+    ASSERT_EQ(subscriberPortDataList.size(), 1U);
+    EXPECT_EQ(subscriberPortDataList[0]->m_runtimeName, m_applicationName);
+}
+
 // END SubscriberPort tests
 
 // BEGIN ClientPort tests
@@ -844,6 +902,18 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
     ASSERT_EQ(condtionalVariableData.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetConditionVariableDataListOfRuntimeReturnsOnlyTheDataOfTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4aa36f27-ace3-49e5-b498-2c060e3472cb");
+    ASSERT_FALSE(sut.addConditionVariableData(m_runtimeName).has_error());
+    ASSERT_FALSE(sut.addConditionVariableData(m_applicationName).has_error());
+
+    auto conditionVariableDataList = sut.getConditionVariableDataList(m_applicationName);
+
+    ASSERT_EQ(conditionVariableDataList.size(), 1U);
+    EXPECT_EQ(conditionVariableDataList[0]->m_runtimeName, m_applicationName);
+}
+
 // END ConditionVariable tests
 
 } // namespace
@@ -0,0 +1,213 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/list.hpp"
+#include "iceoryx_posh/internal/roudi/process_index.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+class ProcessIndex_test : public Test
+{
+  public:
+    Process* createProcess(const uint64_t id)
+    {
+        const iox::RuntimeName_t name(iox::cxx::TruncateToCapacity,
+                                      "ProcessIndexTest" + iox::cxx::convert::toString(id));
+        m_processes.emplace_back(name, 42U, iox::posix::PosixUser("foo"), true, 1U);
+        return &m_processes.back();
+    }
+
+    void createProcesses(const uint64_t numberOfProcesses)
+    {
+        for (uint64_t i = 0U; i < numberOfProcesses; ++i)
+        {
+            createProcess(i);
+        }
+    }
+
+    iox::cxx::list<Process, iox::MAX_PROCESS_NUMBER + 1U> m_processes;
+    ProcessIndex sut;
+};
+
+TEST_F(ProcessIndex_test, InitialIndexIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e82dc4b9-237c-4d34-b27d-2a260e42d43e");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_FALSE(sut.find("ProcessIndexTest0").has_value());
+}
+
+TEST_F(ProcessIndex_test, InsertedProcessCanBeFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "48584e35-7950-48bc-aba8-c4ff137d4aef");
+    auto process = createProcess(0U);
+
+    ASSERT_TRUE(sut.insert(process));
+
+    auto result = sut.find(process->getName());
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result.value(), Eq(process));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(ProcessIndex_test, InsertingNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be39be7d-193a-4336-b048-d547a211132b");
+    EXPECT_FALSE(sut.insert(nullptr));
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(ProcessIndex_test, InsertingProcessWithSameNameTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d13773f2-aef9-4273-a9ce-802607e7fd87");
+    auto process = createProcess(0U);
+    auto processWithSameName = createProcess(0U);
+
+    ASSERT_TRUE(sut.insert(process));
+    EXPECT_FALSE(sut.insert(processWithSameName));
+
+    EXPECT_THAT(sut.find(process->getName()).value(), Eq(process));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(ProcessIndex_test, InsertingMoreThanMaxProcessNumberFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ada0bdec-57d3-4c68-968e-9d07d1863850");
+    createProcesses(iox::MAX_PROCESS_NUMBER + 1U);
+
+    uint32_t insertedProcesses{0U};
+    for (auto& process : m_processes)
+    {
+        if (sut.insert(&process))
+        {
+            ++insertedProcesses;
+        }
+    }
+
+    EXPECT_THAT(insertedProcesses, Eq(iox::MAX_PROCESS_NUMBER));
+    EXPECT_THAT(sut.size(), Eq(iox::MAX_PROCESS_NUMBER));
+}
+
+TEST_F(ProcessIndex_test, AllProcessesOfFullIndexCanBeFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abd69dfd-5096-4332-92ff-8914a6eb66d2");
+    createProcesses(iox::MAX_PROCESS_NUMBER);
+    for (auto& process : m_processes)
+    {
+        ASSERT_TRUE(sut.insert(&process));
+    }
+
+    for (auto& process : m_processes)
+    {
+        auto result = sut.find(process.getName());
+        ASSERT_TRUE(result.has_value());
+        EXPECT_THAT(result.value(), Eq(&process));
+    }
+}
+
+TEST_F(ProcessIndex_test, RemovingNotContainedProcessFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36583b10-c760-46e0-9a8a-e5ad7d1b0455");
+    EXPECT_FALSE(sut.remove("ProcessIndexTest0"));
+}
+
+TEST_F(ProcessIndex_test, RemovedProcessCanNotBeFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6ea76b5-0086-4928-b86b-5fc77170375f");
+    auto process = createProcess(0U);
+    ASSERT_TRUE(sut.insert(process));
+
+    EXPECT_TRUE(sut.remove(process->getName()));
+
+    EXPECT_FALSE(sut.find(process->getName()).has_value());
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(ProcessIndex_test, RemovingEveryOtherProcessKeepsRemainingProcessesFindable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "858913e6-a318-4b41-b4f1-a3a84d9d87c7");
+    createProcesses(iox::MAX_PROCESS_NUMBER);
+    for (auto& process : m_processes)
+    {
+        ASSERT_TRUE(sut.insert(&process));
+    }
+
+    bool removeProcess{true};
+    for (auto& process : m_processes)
+    {
+        if (removeProcess)
+        {
+            ASSERT_TRUE(sut.remove(process.getName()));
+        }
+        removeProcess = !removeProcess;
+    }
+
+    bool isRemoved{true};
+    for (auto& process : m_processes)
+    {
+        auto result = sut.find(process.getName());
+        if (isRemoved)
+        {
+            EXPECT_FALSE(result.has_value());
+        }
+        else
+        {
+            ASSERT_TRUE(result.has_value());
+            EXPECT_THAT(result.value(), Eq(&process));
+        }
+        isRemoved = !isRemoved;
+    }
+    EXPECT_THAT(sut.size(), Eq(iox::MAX_PROCESS_NUMBER / 2U));
+}
+
+TEST_F(ProcessIndex_test, ProcessCanBeInsertedAgainAfterRemoval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1401207e-dc9e-4214-838a-c9f1e9ecc09d");
+    auto process = createProcess(0U);
+    auto processWithSameName = createProcess(0U);
+    ASSERT_TRUE(sut.insert(process));
+    ASSERT_TRUE(sut.remove(process->getName()));
+
+    EXPECT_TRUE(sut.insert(processWithSameName));
+
+    EXPECT_THAT(sut.find(process->getName()).value(), Eq(processWithSameName));
+}
+
+TEST_F(ProcessIndex_test, ClearRemovesAllProcesses)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "09336c6e-3138-4353-9756-2ae5dc6d6220");
+    createProcesses(10U);
+    for (auto& process : m_processes)
+    {
+        ASSERT_TRUE(sut.insert(&process));
+    }
+
+    sut.clear();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    for (auto& process : m_processes)
+    {
+        EXPECT_FALSE(sut.find(process.getName()).has_value());
+    }
+}
+
+} // namespace
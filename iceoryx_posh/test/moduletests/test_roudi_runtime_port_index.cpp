@@ -0,0 +1,205 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_port_index.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+struct PortDataMock
+{
+    iox::RuntimeName_t m_runtimeName;
+};
+
+constexpr uint64_t CAPACITY{20U};
+
+class RuntimePortIndex_test : public Test
+{
+  public:
+    PortDataMock* createPort(const iox::RuntimeName_t& runtimeName)
+    {
+        m_ports[m_numberOfPorts].m_runtimeName = runtimeName;
+        return &m_ports[m_numberOfPorts++];
+    }
+
+    PortDataMock m_ports[CAPACITY + 1U];
+    uint64_t m_numberOfPorts{0U};
+    RuntimePortIndex<PortDataMock, CAPACITY> sut;
+};
+
+TEST_F(RuntimePortIndex_test, InitialIndexIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e5d4722-9f54-4210-b0ce-1fb6112873da");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(sut.portsOf("hypnotoad").empty());
+}
+
+TEST_F(RuntimePortIndex_test, InsertedPortIsReturnedForItsRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39b8933a-3e46-4c39-8322-734600cab27a");
+    auto port = createPort("hypnotoad");
+
+    ASSERT_TRUE(sut.insert(port));
+
+    auto ports = sut.portsOf("hypnotoad");
+    ASSERT_THAT(ports.size(), Eq(1U));
+    EXPECT_THAT(ports[0], Eq(port));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(RuntimePortIndex_test, InsertingNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35bae966-7521-4efe-bf6d-72b2d2a989f7");
+    EXPECT_FALSE(sut.insert(nullptr));
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(RuntimePortIndex_test, InsertingMoreThanCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6310d4e8-3395-404e-be1b-51bd3fecd10d");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(createPort("hypnotoad")));
+    }
+
+    EXPECT_FALSE(sut.insert(createPort("hypnotoad")));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    EXPECT_THAT(sut.portsOf("hypnotoad").size(), Eq(CAPACITY));
+}
+
+TEST_F(RuntimePortIndex_test, PortsOfReturnsOnlyThePortsOfTheRequestedRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89aae513-d79e-4aab-9fdc-8c38ea7dad86");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        iox::RuntimeName_t runtimeName(iox::cxx::TruncateToCapacity, "app" + iox::cxx::convert::toString(i % 4U));
+        ASSERT_TRUE(sut.insert(createPort(runtimeName)));
+    }
+
+    for (uint64_t i = 0U; i < 4U; ++i)
+    {
+        iox::RuntimeName_t runtimeName(iox::cxx::TruncateToCapacity, "app" + iox::cxx::convert::toString(i));
+        auto ports = sut.portsOf(runtimeName);
+        EXPECT_THAT(ports.size(), Eq(CAPACITY / 4U));
+        for (auto port : ports)
+        {
+            EXPECT_THAT(port->m_runtimeName, Eq(runtimeName));
+        }
+    }
+}
+
+TEST_F(RuntimePortIndex_test, RemovedPortIsNotReturnedAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "77ccfbf7-80ba-4cb4-ad19-068fcb4e6ad2");
+    auto port1 = createPort("hypnotoad");
+    auto port2 = createPort("hypnotoad");
+    ASSERT_TRUE(sut.insert(port1));
+    ASSERT_TRUE(sut.insert(port2));
+
+    EXPECT_TRUE(sut.remove(port1));
+
+    auto ports = sut.portsOf("hypnotoad");
+    ASSERT_THAT(ports.size(), Eq(1U));
+    EXPECT_THAT(ports[0], Eq(port2));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(RuntimePortIndex_test, RemovingPortWhichIsNotIndexedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3dec18cb-4249-4912-bd62-667da24c9508");
+    auto port1 = createPort("hypnotoad");
+    auto port2 = createPort("hypnotoad");
+    ASSERT_TRUE(sut.insert(port1));
+
+    EXPECT_FALSE(sut.remove(port2));
+    EXPECT_FALSE(sut.remove(nullptr));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(RuntimePortIndex_test, RemovingPortsKeepsTheRemainingPortsOfAllRuntimesAccessible)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "860a0f76-d2c4-4d6f-b6ad-d0b6ea461f36");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        iox::RuntimeName_t runtimeName(iox::cxx::TruncateToCapacity, "app" + iox::cxx::convert::toString(i % 3U));
+        ASSERT_TRUE(sut.insert(createPort(runtimeName)));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        EXPECT_TRUE(sut.remove(&m_ports[i]));
+    }
+
+    uint64_t numberOfPorts{0U};
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        iox::RuntimeName_t runtimeName(iox::cxx::TruncateToCapacity, "app" + iox::cxx::convert::toString(i));
+        numberOfPorts += sut.portsOf(runtimeName).size();
+    }
+    EXPECT_THAT(numberOfPorts, Eq(CAPACITY / 2U));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY / 2U));
+
+    for (uint64_t i = 1U; i < CAPACITY; i += 2U)
+    {
+        EXPECT_TRUE(sut.remove(&m_ports[i]));
+    }
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(RuntimePortIndex_test, PortsOfOneRuntimeAreReturnedInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3af25ac3-9550-427f-9afd-d34b31de9bf1");
+    const iox::RuntimeName_t runtimeName{"hypnotoad"};
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(createPort(runtimeName)));
+    }
+
+    auto ports = sut.portsOf(runtimeName);
+    ASSERT_THAT(ports.size(), Eq(CAPACITY));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(ports[i], Eq(&m_ports[i]));
+    }
+}
+
+TEST_F(RuntimePortIndex_test, RuntimeWithoutPortsCanBeIndexedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7a5c0de-41d7-437f-aafa-823df0773ba7");
+    const iox::RuntimeName_t runtimeName{"brain-slug"};
+    auto port = createPort(runtimeName);
+    ASSERT_TRUE(sut.insert(port));
+    ASSERT_TRUE(sut.remove(port));
+    EXPECT_TRUE(sut.portsOf(runtimeName).empty());
+
+    for (uint64_t i = 1U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(createPort(runtimeName)));
+    }
+    ASSERT_TRUE(sut.insert(port));
+
+    auto ports = sut.portsOf(runtimeName);
+    ASSERT_THAT(ports.size(), Eq(CAPACITY));
+    EXPECT_THAT(ports.back(), Eq(port));
+    EXPECT_FALSE(sut.insert(createPort(runtimeName)));
+}
+
+} // namespace
@@ -0,0 +1,253 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+namespace
+{
+#if defined(__clang__)
+std::string compiler =
+    "clang-" + iox::cxx::convert::toString(__clang_major__) + "." + iox::cxx::convert::toString(__clang_minor__);
+#elif defined(__GNUC__)
+std::string compiler =
+    "gcc-" + iox::cxx::convert::toString(__GNUC__) + "." + iox::cxx::convert::toString(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+std::string compiler = "msvc-" + iox::cxx::convert::toString(_MSC_VER);
+#endif
+
+#define BENCHMARK(f, duration) PerformBenchmark(f, #f, duration)
+
+template <typename Return>
+void PerformBenchmark(Return (&f)(), const char* functionName, const iox::units::Duration& duration)
+{
+    std::atomic_bool keepRunning{true};
+    uint64_t numberOfCalls{0U};
+    std::thread t([&] {
+        while (keepRunning)
+        {
+            f();
+            ++numberOfCalls;
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration.toMilliseconds()));
+    keepRunning = false;
+    t.join();
+
+    std::cout << std::setw(16) << compiler << " [ " << duration << " ] " << std::setw(15) << numberOfCalls << " : "
+              << functionName << std::endl;
+}
+
+constexpr uint32_t NUMBER_OF_QUEUES{8U};
+constexpr uint32_t USER_PAYLOAD_SIZE{128U};
+constexpr uint32_t NUMBER_OF_CHUNKS{1000U};
+constexpr uint64_t MEMORY_SIZE{16U * 1024U * 1024U};
+constexpr uint64_t NUMBER_OF_QUEUE_TYPES{4U};
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES = NUMBER_OF_QUEUES;
+    static constexpr uint64_t MAX_HISTORY_CAPACITY = 1U;
+};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = 16U;
+    static constexpr uint64_t MAX_INLINE_QUEUE_CAPACITY = iox::MAX_INLINE_SUBSCRIBER_QUEUE_CAPACITY;
+};
+
+using ChunkQueueData_t = popo::ChunkQueueData<ChunkQueueConfig, popo::ThreadSafePolicy>;
+using ChunkDistributorData_t =
+    popo::ChunkDistributorData<ChunkDistributorConfig, popo::ThreadSafePolicy, popo::ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkDistributor_t = popo::ChunkDistributor<ChunkDistributorData_t>;
+
+/// @brief all data is placed in a memory segment which is registered like a shared memory segment, therefore all
+/// relative pointers are resolved with the segment base address
+struct Segment
+{
+    Segment()
+    {
+        segmentId = rp::BaseRelativePointer::registerPtr(memory.get(), MEMORY_SIZE);
+
+        mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS});
+        memoryManager = allocator.allocate(sizeof(mepoo::MemoryManager), alignof(mepoo::MemoryManager));
+        new (memoryManager) mepoo::MemoryManager();
+        static_cast<mepoo::MemoryManager*>(memoryManager)->configureMemoryManager(mempoolConfig, allocator, allocator);
+
+        distributorData = new (allocator.allocate(sizeof(ChunkDistributorData_t), alignof(ChunkDistributorData_t)))
+            ChunkDistributorData_t(popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+        for (auto& queue : queues)
+        {
+            queue = new (allocator.allocate(sizeof(ChunkQueueData_t), alignof(ChunkQueueData_t)))
+                ChunkQueueData_t(popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                 cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer);
+            IOX_DISCARD_RESULT(ChunkDistributor_t(distributorData).tryAddQueue(queue));
+        }
+
+        for (uint64_t i = 0U; i < NUMBER_OF_QUEUE_TYPES; ++i)
+        {
+            const auto queueType = static_cast<cxx::VariantQueueTypes>(i);
+            const auto queueFullPolicy = (queueType == cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer
+                                          || queueType == cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer)
+                                             ? popo::QueueFullPolicy::BLOCK_PRODUCER
+                                             : popo::QueueFullPolicy::DISCARD_OLDEST_DATA;
+            queuesByType[i] = new (allocator.allocate(sizeof(ChunkQueueData_t), alignof(ChunkQueueData_t)))
+                ChunkQueueData_t(queueFullPolicy, queueType);
+        }
+
+        chunkSettings.emplace(
+            mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value());
+    }
+
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    posix::Allocator allocator{memory.get(), MEMORY_SIZE};
+    rp::BaseRelativePointer::id_t segmentId{0U};
+    void* memoryManager{nullptr};
+    ChunkDistributorData_t* distributorData{nullptr};
+    ChunkQueueData_t* queues[NUMBER_OF_QUEUES]{};
+    ChunkQueueData_t* queuesByType[NUMBER_OF_QUEUE_TYPES]{};
+    cxx::optional<mepoo::ChunkSettings> chunkSettings;
+};
+
+Segment& segment()
+{
+    static Segment s;
+    return s;
+}
+
+uint64_t globalCounter{0U};
+
+/// @brief resolves a relative pointer like it was done before the segment base address table existed, i.e. with a
+/// lookup in the PointerRepository which is guarded by a function local static
+void resolveRelativePointerWithRepositoryLookup()
+{
+    auto& s = segment();
+    rp::RelativePointer<uint8_t> pointer(s.memory.get() + (globalCounter % MEMORY_SIZE), s.segmentId);
+    auto basePtr = reinterpret_cast<rp::BaseRelativePointer::offset_t>(
+        rp::BaseRelativePointer::getRepository().getBasePtr(pointer.getId()));
+    globalCounter += *reinterpret_cast<uint8_t*>(basePtr + pointer.getOffset()) + 1U;
+}
+
+void resolveRelativePointer()
+{
+    auto& s = segment();
+    rp::RelativePointer<uint8_t> pointer(s.memory.get() + (globalCounter % MEMORY_SIZE), s.segmentId);
+    globalCounter += *pointer.get() + 1U;
+}
+
+/// @brief one publish with the ChunkDistributor and the take and release on all subscriber queues
+void deliverChunkToAllQueues()
+{
+    auto& s = segment();
+    auto memoryManager = static_cast<mepoo::MemoryManager*>(s.memoryManager);
+    auto chunk = memoryManager->getChunk(s.chunkSettings.value());
+    if (chunk.has_error())
+    {
+        std::cerr << "out of chunks" << std::endl;
+        std::terminate();
+    }
+
+    ChunkDistributor_t distributor(s.distributorData);
+    globalCounter += distributor.deliverToAllStoredQueues(chunk.value());
+
+    for (auto queue : s.queues)
+    {
+        popo::ChunkQueuePopper<ChunkQueueData_t> popper(queue);
+        popper.tryPop().and_then([](auto& sharedChunk) { globalCounter += sharedChunk.getChunkHeader()->chunkSize(); });
+    }
+}
+/// @brief one push with the ChunkQueuePusher and the pop and release with the ChunkQueuePopper on a queue of the
+/// given type
+void pushAndPopChunk(const cxx::VariantQueueTypes queueType)
+{
+    auto& s = segment();
+    auto memoryManager = static_cast<mepoo::MemoryManager*>(s.memoryManager);
+    auto chunk = memoryManager->getChunk(s.chunkSettings.value());
+    if (chunk.has_error())
+    {
+        std::cerr << "out of chunks" << std::endl;
+        std::terminate();
+    }
+
+    auto queue = s.queuesByType[static_cast<uint64_t>(queueType)];
+    popo::ChunkQueuePusher<ChunkQueueData_t>(queue).push(chunk.value());
+    popo::ChunkQueuePopper<ChunkQueueData_t>(queue).tryPop().and_then(
+        [](auto& sharedChunk) { globalCounter += sharedChunk.getChunkHeader()->chunkSize(); });
+}
+
+void pushAndPopChunkFiFoSingleProducer()
+{
+    pushAndPopChunk(cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer);
+}
+
+void pushAndPopChunkSoFiSingleProducer()
+{
+    pushAndPopChunk(cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer);
+}
+
+void pushAndPopChunkFiFoMultiProducer()
+{
+    pushAndPopChunk(cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+}
+
+void pushAndPopChunkSoFiMultiProducer()
+{
+    pushAndPopChunk(cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer);
+}
+} // namespace
+
+int main()
+{
+    constexpr auto DURATION = 2_s;
+
+    // initialize the segment before the measurement starts
+    segment();
+
+    BENCHMARK(resolveRelativePointerWithRepositoryLookup, DURATION);
+    BENCHMARK(resolveRelativePointer, DURATION);
+    BENCHMARK(deliverChunkToAllQueues, DURATION);
+    BENCHMARK(pushAndPopChunkFiFoSingleProducer, DURATION);
+    BENCHMARK(pushAndPopChunkSoFiSingleProducer, DURATION);
+    BENCHMARK(pushAndPopChunkFiFoMultiProducer, DURATION);
+    BENCHMARK(pushAndPopChunkSoFiMultiProducer, DURATION);
+
+    std::cout << "(" << globalCounter << ")" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_ICEORYX_CHUNK_TRACE_TRACE_EXPORT_APP_HPP
+#define IOX_TOOLS_ICEORYX_CHUNK_TRACE_TRACE_EXPORT_APP_HPP
+
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_trace.hpp"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace chunk_trace
+{
+static constexpr option traceExportLongOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                                    {"version", no_argument, nullptr, 'v'},
+                                                    {"name", required_argument, nullptr, 'n'},
+                                                    {"output", required_argument, nullptr, 'o'},
+                                                    {"remove", no_argument, nullptr, 'r'},
+                                                    {nullptr, 0, nullptr, 0}};
+
+static constexpr const char* traceExportShortOptions = "hvn:o:r";
+
+static constexpr const char* DEFAULT_OUTPUT_FILE = "chunk_trace.json";
+
+/// @brief A consistent copy of an event of a ChunkTraceRing together with the process which wrote it
+struct ExportedEvent
+{
+    uint64_t position{0U};
+    uint64_t timestamp{0U};
+    uint64_t id{0U};
+    uint64_t chunk{0U};
+    uint64_t sequenceNumber{0U};
+    popo::ChunkTraceEventType type{popo::ChunkTraceEventType::LOAN};
+    uint64_t pid{0U};
+};
+
+/// @brief The exporter of iox-trace-export; it reads the chunk trace rings of the given runtimes and writes their
+/// events in the Chrome trace event format, which can be opened with chrome://tracing or Perfetto
+class TraceExportApp
+{
+  public:
+    /// @brief constructor to create the exporter
+    /// @param[in] argc forwarding of command line arguments
+    /// @param[in] argv forwarding of command line arguments
+    TraceExportApp(int argc, char* argv[]) noexcept;
+
+    /// @brief exports the rings and optionally removes them afterwards
+    void run() noexcept;
+
+  private:
+    struct Process
+    {
+        RuntimeName_t runtimeName;
+        uint64_t pid{0U};
+    };
+
+    void parseCmdLineArguments(int argc, char** argv) noexcept;
+    void printHelp() noexcept;
+    void printShortInfo(const std::string& binaryName) noexcept;
+
+    /// @brief copies all consistent events of the ring of a runtime into m_events
+    /// @return false if the ring does not exist or has an incompatible layout
+    bool readRing(const RuntimeName_t& runtimeName) noexcept;
+    void writeChromeTrace(std::ostream& output) const noexcept;
+
+    std::vector<RuntimeName_t> m_runtimeNames;
+    std::string m_outputFile{DEFAULT_OUTPUT_FILE};
+    bool m_removeRings{false};
+
+    std::vector<Process> m_processes;
+    std::vector<ExportedEvent> m_events;
+};
+
+} // namespace chunk_trace
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_CHUNK_TRACE_TRACE_EXPORT_APP_HPP
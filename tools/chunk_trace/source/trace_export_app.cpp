@@ -0,0 +1,326 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_chunk_trace/trace_export_app.hpp"
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_versions.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <tuple>
+
+namespace iox
+{
+namespace chunk_trace
+{
+namespace
+{
+bool isPublisherEvent(const popo::ChunkTraceEventType type) noexcept
+{
+    return type == popo::ChunkTraceEventType::LOAN || type == popo::ChunkTraceEventType::PUBLISH
+           || type == popo::ChunkTraceEventType::DISCARD;
+}
+
+/// @brief the Chrome trace format expects microseconds; the nanoseconds are kept as fraction
+void writeTimestamp(std::ostream& output, const uint64_t timestampInNs) noexcept
+{
+    constexpr uint64_t NANOSECONDS_PER_MICROSECOND{1000U};
+    output << timestampInNs / NANOSECONDS_PER_MICROSECOND << '.' << std::setw(3) << std::setfill('0')
+           << timestampInNs % NANOSECONDS_PER_MICROSECOND << std::setfill(' ');
+}
+} // namespace
+
+TraceExportApp::TraceExportApp(int argc, char* argv[]) noexcept
+{
+    parseCmdLineArguments(argc, argv);
+}
+
+void TraceExportApp::printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-trace-export [OPTIONS] --name <runtime name> [--name <runtime name> ...]\n"
+                 "  iox-trace-export --help\n"
+                 "  iox-trace-export --version\n"
+                 "\nOptions:\n"
+                 "  -h, --help            Display help and exit.\n"
+                 "  -n, --name <name>     Runtime name of a process which was started with "
+              << popo::CHUNK_TRACE_CAPACITY_ENV_VARIABLE
+              << ".\n"
+                 "  -o, --output <file>   Output file in the Chrome trace event format. [default: "
+              << DEFAULT_OUTPUT_FILE
+              << "]\n"
+                 "  -r, --remove          Remove the trace rings after the export.\n"
+                 "  -v, --version         Display latest official iceoryx release version and exit.\n"
+              << std::endl;
+}
+
+void TraceExportApp::printShortInfo(const std::string& binaryName) noexcept
+{
+    std::cout << "Run '" << binaryName << " --help' for more information." << std::endl;
+}
+
+void TraceExportApp::parseCmdLineArguments(int argc, char** argv) noexcept
+{
+    int32_t opt;
+    int32_t index;
+
+    while ((opt = getopt_long(argc, argv, traceExportShortOptions, traceExportLongOptions, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'v':
+            std::cout << "Latest official iceoryx release version: " << ICEORYX_LATEST_RELEASE_VERSION << "\n"
+                      << std::endl;
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'n':
+            if (strnlen(optarg, MAX_RUNTIME_NAME_LENGTH + 1U) > MAX_RUNTIME_NAME_LENGTH)
+            {
+                std::cout << "Runtime name '" << optarg << "' is too long! Will be ignored!" << std::endl;
+                break;
+            }
+            m_runtimeNames.emplace_back(cxx::TruncateToCapacity, optarg);
+            break;
+
+        case 'o':
+            m_outputFile = optarg;
+            break;
+
+        case 'r':
+            m_removeRings = true;
+            break;
+
+        case '?':
+        default:
+            printShortInfo(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (m_runtimeNames.empty())
+    {
+        std::cout << "Wrong usage. ";
+        printShortInfo(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+void TraceExportApp::run() noexcept
+{
+    for (const auto& runtimeName : m_runtimeNames)
+    {
+        if (!readRing(runtimeName))
+        {
+            continue;
+        }
+        if (m_removeRings)
+        {
+            IOX_DISCARD_RESULT(posix::SharedMemory::unlinkIfExist(popo::ChunkTrace::shmName(runtimeName)));
+        }
+    }
+
+    std::stable_sort(m_events.begin(), m_events.end(), [](const ExportedEvent& lhs, const ExportedEvent& rhs) {
+        return lhs.timestamp < rhs.timestamp;
+    });
+
+    std::ofstream output(m_outputFile);
+    if (!output)
+    {
+        std::cerr << "Unable to open '" << m_outputFile << "'" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    writeChromeTrace(output);
+    output.close();
+    if (!output)
+    {
+        std::cerr << "Unable to write '" << m_outputFile << "'" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "Exported " << m_events.size() << " events of " << m_processes.size() << " processes to '"
+              << m_outputFile << "'" << std::endl;
+}
+
+bool TraceExportApp::readRing(const RuntimeName_t& runtimeName) noexcept
+{
+    auto openRing = [&](const uint64_t size) {
+        return posix::SharedMemoryObjectBuilder()
+            .name(popo::ChunkTrace::shmName(runtimeName))
+            .memorySizeInBytes(size)
+            .accessMode(posix::AccessMode::READ_ONLY)
+            .openMode(posix::OpenMode::OPEN_EXISTING)
+            .create();
+    };
+
+    // the capacity is only known after the head of the ring was mapped
+    auto headResult = openRing(sizeof(popo::ChunkTraceRing));
+    if (headResult.has_error())
+    {
+        std::cerr << "No chunk trace of '" << runtimeName << "' found" << std::endl;
+        return false;
+    }
+    const auto& head = *static_cast<const popo::ChunkTraceRing*>(headResult->getBaseAddress());
+    if (head.version != popo::ChunkTraceRing::VERSION || head.eventSize != sizeof(popo::ChunkTraceEvent))
+    {
+        std::cerr << "The chunk trace of '" << runtimeName << "' has the incompatible version " << head.version
+                  << std::endl;
+        return false;
+    }
+
+    auto ringResult = openRing(popo::ChunkTraceRing::requiredMemorySize(head.capacity));
+    if (ringResult.has_error())
+    {
+        std::cerr << "Unable to map the chunk trace of '" << runtimeName << "'" << std::endl;
+        return false;
+    }
+    const auto& ring = *static_cast<const popo::ChunkTraceRing*>(ringResult->getBaseAddress());
+
+    uint64_t numberOfInconsistentEvents{0U};
+    for (uint64_t i = 0U; i < ring.capacity; ++i)
+    {
+        const auto& event = ring.events()[i];
+        const uint64_t position = event.position.load(std::memory_order_acquire);
+        if (position == 0U || position == popo::ChunkTraceEvent::POSITION_BUSY)
+        {
+            continue;
+        }
+
+        ExportedEvent exportedEvent;
+        exportedEvent.position = position - 1U;
+        exportedEvent.timestamp = event.timestamp;
+        exportedEvent.id = event.id;
+        exportedEvent.chunk = event.chunk;
+        exportedEvent.sequenceNumber = event.sequenceNumber;
+        exportedEvent.type = event.type;
+        exportedEvent.pid = ring.pid;
+
+        // the writer of the process may have overwritten the event while it was copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.position.load(std::memory_order_relaxed) != position)
+        {
+            ++numberOfInconsistentEvents;
+            continue;
+        }
+        m_events.push_back(exportedEvent);
+    }
+
+    const uint64_t writeIndex = ring.writeIndex.load(std::memory_order_relaxed);
+    if (writeIndex > ring.capacity)
+    {
+        std::cout << "The oldest " << writeIndex - ring.capacity << " events of '" << runtimeName
+                  << "' were overwritten; increase " << popo::CHUNK_TRACE_CAPACITY_ENV_VARIABLE
+                  << " to keep them" << std::endl;
+    }
+    if (numberOfInconsistentEvents > 0U)
+    {
+        std::cout << numberOfInconsistentEvents << " events of '" << runtimeName
+                  << "' were skipped since they were written during the export" << std::endl;
+    }
+
+    m_processes.push_back({ring.runtimeName, ring.pid});
+    return true;
+}
+
+void TraceExportApp::writeChromeTrace(std::ostream& output) const noexcept
+{
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    const char* separator = "\n";
+
+    for (const auto& process : m_processes)
+    {
+        output << separator << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << process.pid
+               << ",\"args\":{\"name\":\"" << process.runtimeName << "\"}}";
+        separator = ",\n";
+    }
+
+    // every publisher port and every chunk queue gets its own track in the process which traced it
+    using TrackKey_t = std::tuple<uint64_t, bool, uint64_t>;
+    std::map<TrackKey_t, uint64_t> tracks;
+    auto trackOf = [&](const ExportedEvent& event) {
+        const bool isPublisher = isPublisherEvent(event.type);
+        const TrackKey_t key{event.pid, isPublisher, event.id};
+        auto track = tracks.find(key);
+        if (track != tracks.end())
+        {
+            return track->second;
+        }
+        const uint64_t tid = tracks.size() + 1U;
+        tracks.emplace(key, tid);
+        output << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << event.pid << ",\"tid\":" << tid
+               << ",\"args\":{\"name\":\"" << (isPublisher ? "publisher " : "queue ") << event.id << "\"}}";
+        return tid;
+    };
+
+    // a push is connected with the take of the same chunk queue and sequence number by a flow arrow; this works
+    // across processes since the queue id is the same in the publishing and the subscribing process
+    using PendingPushKey_t = std::pair<uint64_t, uint64_t>;
+    std::map<PendingPushKey_t, std::deque<std::pair<const ExportedEvent*, uint64_t>>> pendingPushes;
+    uint64_t flowId{0U};
+
+    for (const auto& event : m_events)
+    {
+        const uint64_t tid = trackOf(event);
+        output << separator << "{\"name\":\"" << popo::asStringLiteral(event.type)
+               << "\",\"cat\":\"chunk\",\"ph\":\"i\",\"s\":\"t\",\"ts\":";
+        writeTimestamp(output, event.timestamp);
+        output << ",\"pid\":" << event.pid << ",\"tid\":" << tid << ",\"args\":{\"chunk\":\""
+               << (event.chunk >> popo::ChunkTraceRing::SEGMENT_ID_SHIFT) << ":0x" << std::hex
+               << (event.chunk & ((static_cast<uint64_t>(1U) << popo::ChunkTraceRing::SEGMENT_ID_SHIFT) - 1U))
+               << std::dec << "\",\"sequence\":" << event.sequenceNumber << "}}";
+
+        const PendingPushKey_t key{event.id, event.sequenceNumber};
+        if (event.type == popo::ChunkTraceEventType::PUSH)
+        {
+            pendingPushes[key].emplace_back(&event, tid);
+        }
+        else if (event.type == popo::ChunkTraceEventType::TAKE)
+        {
+            auto pending = pendingPushes.find(key);
+            if (pending == pendingPushes.end() || pending->second.empty())
+            {
+                continue;
+            }
+            const auto& push = pending->second.front();
+            ++flowId;
+            output << ",\n{\"name\":\"delivery\",\"cat\":\"chunk\",\"ph\":\"s\",\"id\":" << flowId << ",\"ts\":";
+            writeTimestamp(output, push.first->timestamp);
+            output << ",\"pid\":" << push.first->pid << ",\"tid\":" << push.second << "}";
+            output << ",\n{\"name\":\"delivery\",\"cat\":\"chunk\",\"ph\":\"f\",\"bp\":\"e\",\"id\":" << flowId
+                   << ",\"ts\":";
+            writeTimestamp(output, event.timestamp);
+            output << ",\"pid\":" << event.pid << ",\"tid\":" << tid << "}";
+            pending->second.pop_front();
+        }
+    }
+
+    output << "\n]}\n";
+}
+
+} // namespace chunk_trace
+} // namespace iox
@@ -314,6 +314,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     // constexpr int32_t intervalWidth{19};
     constexpr int32_t subscriptionStateWidth{14};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
+    constexpr int32_t takeLatencyWidth{17};
     constexpr int32_t scopeWidth{12};
     constexpr int32_t interfaceSourceWidth{8};
 
@@ -424,6 +425,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", nodeNameWidth, "Node");
     wprintw(pad, " %*s |", subscriptionStateWidth, "Subscription");
     // wprintw(pad, " %*s |", fifoWidth, "FiFo"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", takeLatencyWidth, "Take Latency");
     wprintw(pad, " %*s\n", scopeWidth, "Propagation");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -433,10 +435,25 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", nodeNameWidth, "");
     wprintw(pad, " %*s |", subscriptionStateWidth, "State");
     // wprintw(pad, " %*s |", fifoWidth, "size / capacity"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", takeLatencyWidth, "p50 / p99 [us]");
     wprintw(pad, " %*s\n", scopeWidth, "scope");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "---------------------------------------------------\n");
+    wprintw(pad, "----------------------------------------------------------------------\n");
+
+    // the latencies are only measured for chunks of publishers which stamp a publish timestamp
+    auto takeLatencyToString = [](const SubscriberPortChangingData& data) -> std::string {
+        if (data.takeLatencySampleCount == 0U)
+        {
+            return "n/a";
+        }
+        constexpr double NANOSECONDS_PER_MICROSECOND{1000.0};
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(1)
+               << static_cast<double>(data.takeLatencyP50InNs) / NANOSECONDS_PER_MICROSECOND << " / "
+               << static_cast<double>(data.takeLatencyP99InNs) / NANOSECONDS_PER_MICROSECOND;
+        return stream.str();
+    };
 
     auto subscriptionStateToString = [](iox::SubscribeState subState) -> std::string {
         switch (subState)
@@ -486,6 +503,9 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             //{
             // wprintw(pad, " %*s |", fifoWidth, "");
             //}
+            wprintw(pad,
+                    " %s |",
+                    printEntry(takeLatencyWidth, takeLatencyToString(*subscriber.subscriberPortChangingData)).c_str());
             wprintw(pad,
                     " %s\n",
                     printEntry(scopeWidth,
@@ -503,6 +523,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         wprintw(pad, " %*s |", nodeNameWidth, "");
         wprintw(pad, " %*s |", subscriptionStateWidth, "");
         // wprintw(pad, " %*s |", fifoWidth, ""); // uncomment once this information is needed
+        wprintw(pad, " %*s |", takeLatencyWidth, "");
         wprintw(pad, " %*s", scopeWidth, "");
         wprintw(pad, "\n");
     }
@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_APP_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_APP_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/runtime/service_discovery.hpp"
+#include "iceoryx_record_replay/record_writer.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+static constexpr option recordLongOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                               {"version", no_argument, nullptr, 'v'},
+                                               {"output", required_argument, nullptr, 'o'},
+                                               {"topic", required_argument, nullptr, 't'},
+                                               {"segment-size", required_argument, nullptr, 's'},
+                                               {"lossless", no_argument, nullptr, 'l'},
+                                               {nullptr, 0, nullptr, 0}};
+
+static constexpr const char* recordShortOptions = "hvo:t:s:l";
+
+static constexpr uint64_t DEFAULT_SEGMENT_SIZE_IN_MIB{1024U};
+static constexpr units::Duration DISCOVERY_PERIOD = units::Duration::fromSeconds(1U);
+static constexpr units::Duration RECORD_WAIT_TIMEOUT = units::Duration::fromMilliseconds(100U);
+
+/// @brief The recorder of iox-record; it subscribes to all topics which match the topic patterns and writes their
+/// chunks with the RecordWriter. Topics which are offered while the recorder runs are added every DISCOVERY_PERIOD.
+class RecordApp
+{
+  public:
+    /// @brief constructor to create the recorder
+    /// @param[in] argc forwarding of command line arguments
+    /// @param[in] argv forwarding of command line arguments
+    RecordApp(int argc, char* argv[]) noexcept;
+
+    /// @brief records until SIGINT or SIGTERM is received
+    void run() noexcept;
+
+  private:
+    /// @brief a topic pattern of the command line; a nullopt matches every string
+    struct TopicPattern
+    {
+        cxx::optional<capro::IdString_t> service;
+        cxx::optional<capro::IdString_t> instance;
+        cxx::optional<capro::IdString_t> event;
+    };
+
+    void parseCmdLineArguments(int argc, char** argv) noexcept;
+    bool parseTopicPattern(const std::string& pattern) noexcept;
+    void printHelp() noexcept;
+    void printShortInfo(const std::string& binaryName) noexcept;
+
+    void discoverTopics(runtime::ServiceDiscovery& serviceDiscovery,
+                        popo::WaitSet<>& waitSet,
+                        RecordWriter& writer) noexcept;
+    void addTopic(const capro::ServiceDescription& service, popo::WaitSet<>& waitSet, RecordWriter& writer) noexcept;
+    bool recordTopic(const uint32_t topicId, RecordWriter& writer) noexcept;
+
+    std::string m_directory;
+    std::vector<TopicPattern> m_topicPatterns;
+    uint64_t m_segmentSize{DEFAULT_SEGMENT_SIZE_IN_MIB * 1024U * 1024U};
+    bool m_lossless{false};
+
+    /// @brief the topic id of a subscriber is its position in the vector
+    std::vector<capro::ServiceDescription> m_services;
+    std::vector<std::unique_ptr<popo::UntypedSubscriber>> m_subscribers;
+    uint64_t m_numberOfRecords{0U};
+    uint64_t m_numberOfDataLosses{0U};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_APP_HPP
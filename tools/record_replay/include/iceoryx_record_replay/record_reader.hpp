@@ -0,0 +1,94 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_READER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_READER_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_record_replay/record_types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief Reads a recording of the RecordWriter. The segments are mapped read-only into the process and the returned
+/// records point directly into the mapped segment, i.e. the chunks are not copied.
+/// @code
+///     auto reader = RecordReader::open("/data/recording");
+///     while (auto record = reader->next())
+///     {
+///         const auto& topic = reader->topics()[record->topicId];
+///         process(topic, record->chunkHeader->userPayload());
+///     }
+/// @endcode
+class RecordReader
+{
+  public:
+    /// @brief opens the recording in the given directory
+    /// @param[in] directory the directory of the recording
+    /// @return the RecordReader positioned at the first record or the RecordError which occurred
+    static cxx::expected<RecordReader, RecordError> open(const std::string& directory) noexcept;
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+    RecordReader(RecordReader&&) noexcept = default;
+    RecordReader& operator=(RecordReader&&) noexcept = default;
+    ~RecordReader() noexcept = default;
+
+    /// @brief returns the topics of the recording; the topic id of a record is the position in this vector
+    const std::vector<Topic>& topics() const noexcept;
+
+    /// @brief returns the record at the current position without advancing
+    /// @return the record or a nullopt at the end of the recording
+    /// @note the returned chunk header is valid until the reader advances to the next segment
+    cxx::optional<Record> peek() noexcept;
+
+    /// @brief returns the record at the current position and advances to the next one
+    /// @return the record or a nullopt at the end of the recording
+    /// @note the returned chunk header is valid until the reader advances to the next segment
+    cxx::optional<Record> next() noexcept;
+
+    /// @brief positions the reader at the first record with a timestamp which is not smaller than the given one; the
+    /// index is used to skip the segments and the parts of a segment before the timestamp
+    /// @param[in] timestamp the timestamp to seek
+    /// @return a RecordError if the segment of the timestamp could not be read
+    cxx::expected<RecordError> seek(const uint64_t timestamp) noexcept;
+
+  private:
+    explicit RecordReader(const std::string& directory) noexcept;
+
+    cxx::expected<RecordError> readTopics() noexcept;
+    void readIndex() noexcept;
+    cxx::expected<RecordError> mapSegment(const uint32_t segment) noexcept;
+
+    std::string m_directory;
+    std::vector<Topic> m_topics;
+    std::vector<IndexEntry> m_index;
+    cxx::optional<posix::MemoryMap> m_segmentMemory;
+    uint64_t m_segmentSize{0U};
+    uint32_t m_segment{0U};
+    uint64_t m_offset{0U};
+    uint64_t m_recordSize{0U};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_READER_HPP
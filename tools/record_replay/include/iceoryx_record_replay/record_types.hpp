@@ -0,0 +1,132 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_TYPES_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_TYPES_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief A recording is a directory with the following files
+///     - TOPICS_FILE_NAME: one line per topic with the topic id, service, instance and event separated by tabs
+///     - INDEX_FILE_NAME: IndexEntry's pointing into the segments, sorted by the timestamp
+///     - <SEGMENT_FILE_PREFIX><segment number><SEGMENT_FILE_SUFFIX>: a SegmentHeader followed by the records; each
+///       record is a RecordHeader followed by the used part of the chunk, i.e. the ChunkHeader, the user-header and the
+///       user-payload exactly like they were in the shared memory
+constexpr const char TOPICS_FILE_NAME[] = "topics";
+constexpr const char INDEX_FILE_NAME[] = "index";
+constexpr const char SEGMENT_FILE_PREFIX[] = "segment_";
+constexpr const char SEGMENT_FILE_SUFFIX[] = ".ioxlog";
+
+/// @brief increased when the layout of the segments or the index changes
+constexpr uint32_t RECORD_FORMAT_VERSION{1U};
+
+/// @brief the records start at multiples of this alignment, therefore a ChunkHeader read from a mapped segment is
+/// properly aligned
+constexpr uint64_t RECORD_ALIGNMENT{alignof(mepoo::ChunkHeader)};
+
+/// @brief an index entry is written for the first record of a segment and then after this amount of recorded bytes
+constexpr uint64_t INDEX_INTERVAL{1024U * 1024U};
+
+struct SegmentHeader
+{
+    /// @brief "ioxrecrd" in little endian
+    static constexpr uint64_t MAGIC{0x6472636572786f69U};
+
+    uint64_t magic{MAGIC};
+    uint32_t formatVersion{RECORD_FORMAT_VERSION};
+    /// @brief the chunks of a recording can only be replayed with the same ChunkHeader version
+    uint8_t chunkHeaderVersion{mepoo::ChunkHeader::CHUNK_HEADER_VERSION};
+    uint8_t reserved[3]{0U, 0U, 0U};
+};
+
+struct RecordHeader
+{
+    /// @brief the time in nanoseconds when the recorder took the chunk; only the differences are meaningful
+    uint64_t timestamp{0U};
+    uint32_t topicId{0U};
+    /// @brief the size of the ChunkHeader, the user-header and the user-payload which follow the RecordHeader
+    uint32_t chunkSize{0U};
+};
+
+struct IndexEntry
+{
+    uint64_t timestamp{0U};
+    uint32_t segment{0U};
+    uint32_t offset{0U};
+};
+
+/// @brief A recorded chunk; for the RecordWriter the chunk header points into the shared memory, for the RecordReader
+/// into the mapped segment
+struct Record
+{
+    uint64_t timestamp{0U};
+    uint32_t topicId{0U};
+    const mepoo::ChunkHeader* chunkHeader{nullptr};
+    /// @brief the recorded size of the chunk, i.e. the ChunkHeader, the user-header and the user-payload; only set by
+    /// the RecordReader
+    uint32_t chunkSize{0U};
+};
+
+struct Topic
+{
+    uint32_t id{0U};
+    capro::ServiceDescription service;
+};
+
+enum class RecordError
+{
+    UNABLE_TO_CREATE_DIRECTORY,
+    UNABLE_TO_OPEN_FILE,
+    UNABLE_TO_WRITE_FILE,
+    INVALID_TOPICS_FILE,
+    UNABLE_TO_MAP_SEGMENT,
+    INVALID_SEGMENT,
+    INCOMPATIBLE_CHUNK_HEADER_VERSION,
+    INVALID_SEGMENT_SIZE,
+    RECORD_EXCEEDS_SEGMENT_SIZE,
+    TOO_MANY_TOPICS
+};
+
+constexpr const char* RECORD_ERROR_STRING[] = {"UNABLE_TO_CREATE_DIRECTORY",
+                                               "UNABLE_TO_OPEN_FILE",
+                                               "UNABLE_TO_WRITE_FILE",
+                                               "INVALID_TOPICS_FILE",
+                                               "UNABLE_TO_MAP_SEGMENT",
+                                               "INVALID_SEGMENT",
+                                               "INCOMPATIBLE_CHUNK_HEADER_VERSION",
+                                               "INVALID_SEGMENT_SIZE",
+                                               "RECORD_EXCEEDS_SEGMENT_SIZE",
+                                               "TOO_MANY_TOPICS"};
+
+/// @brief the topic ids are restricted to the WaitSet capacity since the recorder waits on all subscribers with one
+/// WaitSet
+constexpr uint32_t MAX_NUMBER_OF_TOPICS{MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET};
+
+/// @brief returns the path of the segment file with the given number
+std::string segmentPath(const std::string& directory, const uint32_t segment) noexcept;
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_TYPES_HPP
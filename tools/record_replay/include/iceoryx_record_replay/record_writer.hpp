@@ -0,0 +1,112 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_WRITER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_WRITER_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_record_replay/record_types.hpp"
+
+#include <fstream>
+#include <string>
+#include <sys/uio.h>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace internal
+{
+/// @brief advances the vectors of a writev call past the bytes which were written; writev might write less than
+/// requested, e.g. when it is interrupted by a signal
+/// @param[in, out] vectors the vectors which were passed to writev, afterwards the first vector which is not completely
+/// written; its base and length are adjusted to the remaining part
+/// @param[in, out] numberOfVectors the number of vectors, afterwards the number of vectors which are not completely
+/// written
+/// @param[in] bytesWritten the return value of writev
+void skipWrittenBytes(struct iovec*& vectors, int32_t& numberOfVectors, uint64_t bytesWritten) noexcept;
+} // namespace internal
+
+/// @brief Writes the chunks of a recording into segment files. The chunks are gathered with writev directly from the
+/// shared memory into the file, i.e. besides the copy into the page cache there is no copy of the payload.
+/// @code
+///     auto writer = RecordWriter::create("/data/recording", 1024U * 1024U * 1024U);
+///     auto topicId = writer->addTopic(service);
+///     Record records[] = {{timestamp, topicId.value(), ChunkHeader::fromUserPayload(userPayload)}};
+///     writer->write(records, 1U);
+///     // the chunks can be released after write returned
+/// @endcode
+class RecordWriter
+{
+  public:
+    /// @brief the maximum number of records which are written with one system call
+    static constexpr uint64_t MAX_RECORDS_PER_WRITE{64U};
+
+    /// @brief creates the directory if it does not exist and starts a new recording in it; an existing recording in
+    /// the directory is overwritten
+    /// @param[in] directory the directory of the recording
+    /// @param[in] segmentSize the maximum size of a segment file, at most 4 GiB since the index uses 32 bit offsets
+    /// @return the RecordWriter or the RecordError which occurred
+    static cxx::expected<RecordWriter, RecordError> create(const std::string& directory,
+                                                           const uint64_t segmentSize) noexcept;
+
+    RecordWriter(const RecordWriter&) = delete;
+    RecordWriter& operator=(const RecordWriter&) = delete;
+    RecordWriter(RecordWriter&& rhs) noexcept;
+    RecordWriter& operator=(RecordWriter&& rhs) noexcept;
+
+    /// @brief closes the current segment and the index
+    ~RecordWriter() noexcept;
+
+    /// @brief adds a topic to the recording
+    /// @param[in] service the service description of the topic
+    /// @return the id of the topic which must be used for the records of this topic
+    cxx::expected<uint32_t, RecordError> addTopic(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief writes the records; a new segment is started when a record does not fit into the current one
+    /// @param[in] records pointer to the records
+    /// @param[in] numberOfRecords the number of records
+    /// @return a RecordError if a record could not be written
+    cxx::expected<RecordError> write(const Record* const records, const uint64_t numberOfRecords) noexcept;
+
+    /// @brief returns the number of bytes which were written to all segments, including the headers
+    uint64_t bytesWritten() const noexcept;
+
+  private:
+    RecordWriter(const std::string& directory, const uint64_t segmentSize) noexcept;
+
+    cxx::expected<RecordError> writeBatch(const Record* const records, const uint64_t numberOfRecords) noexcept;
+    cxx::expected<RecordError> openSegment() noexcept;
+    void closeSegment() noexcept;
+    cxx::expected<RecordError> writeToSegment(struct iovec* vectors, int32_t numberOfVectors) noexcept;
+
+    static constexpr int32_t INVALID_FILE_DESCRIPTOR{-1};
+
+    std::string m_directory;
+    uint64_t m_segmentSize{0U};
+    uint32_t m_numberOfTopics{0U};
+    uint32_t m_segment{0U};
+    int32_t m_segmentFileDescriptor{INVALID_FILE_DESCRIPTOR};
+    uint64_t m_segmentOffset{0U};
+    uint64_t m_nextIndexOffset{0U};
+    uint64_t m_bytesWritten{0U};
+    std::ofstream m_topicsFile;
+    std::ofstream m_indexFile;
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORD_WRITER_HPP
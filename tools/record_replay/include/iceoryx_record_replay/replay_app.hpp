@@ -0,0 +1,85 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_REPLAY_APP_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_REPLAY_APP_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_record_replay/record_reader.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+static constexpr option replayLongOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                               {"version", no_argument, nullptr, 'v'},
+                                               {"input", required_argument, nullptr, 'i'},
+                                               {"rate", required_argument, nullptr, 'r'},
+                                               {"start", required_argument, nullptr, 's'},
+                                               {"delay", required_argument, nullptr, 'd'},
+                                               {nullptr, 0, nullptr, 0}};
+
+static constexpr const char* replayShortOptions = "hvi:r:s:d:";
+
+static constexpr double DEFAULT_REPLAY_RATE{1.0};
+static constexpr uint64_t DEFAULT_REPLAY_DELAY_IN_MS{1000U};
+/// @brief the replay sleeps at most this long at once to react on SIGINT and SIGTERM
+static constexpr units::Duration MAX_REPLAY_SLEEP = units::Duration::fromMilliseconds(100U);
+
+/// @brief The player of iox-replay; it offers a publisher for every topic of the recording and publishes the recorded
+/// chunks with the recorded time differences, optionally scaled by the replay rate
+class ReplayApp
+{
+  public:
+    /// @brief constructor to create the player
+    /// @param[in] argc forwarding of command line arguments
+    /// @param[in] argv forwarding of command line arguments
+    ReplayApp(int argc, char* argv[]) noexcept;
+
+    /// @brief replays the recording until its end or until SIGINT or SIGTERM is received
+    void run() noexcept;
+
+  private:
+    void parseCmdLineArguments(int argc, char** argv) noexcept;
+    void printHelp() noexcept;
+    void printShortInfo(const std::string& binaryName) noexcept;
+
+    /// @brief sleeps until the given time point of the steady clock
+    /// @return false if the termination was requested in the meantime
+    bool sleepUntil(const uint64_t timePointInNs) noexcept;
+    bool replayRecord(const Record& record) noexcept;
+
+    std::string m_directory;
+    double m_rate{DEFAULT_REPLAY_RATE};
+    uint64_t m_startOffsetInMs{0U};
+    uint64_t m_delayInMs{DEFAULT_REPLAY_DELAY_IN_MS};
+
+    /// @brief the publisher of a topic is at the position of the topic id
+    std::vector<std::unique_ptr<popo::UntypedPublisher>> m_publishers;
+    uint64_t m_numberOfReplayedRecords{0U};
+    uint64_t m_numberOfFailedLoans{0U};
+    uint64_t m_numberOfInvalidRecords{0U};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_REPLAY_APP_HPP
@@ -0,0 +1,323 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/record_app.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/posix_wrapper/signal_watcher.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_versions.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+uint64_t now() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+} // namespace
+
+RecordApp::RecordApp(int argc, char* argv[]) noexcept
+{
+    parseCmdLineArguments(argc, argv);
+}
+
+void RecordApp::printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-record [OPTIONS] --output <directory>\n"
+                 "  iox-record --help\n"
+                 "  iox-record --version\n"
+                 "\nOptions:\n"
+                 "  -h, --help                Display help and exit.\n"
+                 "  -o, --output <directory>  Directory of the recording; an existing recording is overwritten.\n"
+                 "  -t, --topic <pattern>     Record the topics matching <service>/<instance>/<event>; a '*' matches\n"
+                 "                            every string. Can be used multiple times. [default: */*/*]\n"
+                 "  -s, --segment-size <MiB>  Maximum size of a segment file [max: 4095, default: "
+              << DEFAULT_SEGMENT_SIZE_IN_MIB
+              << "]\n"
+                 "  -l, --lossless            Request a subscriber queue which blocks the publishers when it is full.\n"
+                 "                            Only publishers with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER wait.\n"
+                 "  -v, --version             Display latest official iceoryx release version and exit.\n"
+              << std::endl;
+}
+
+void RecordApp::printShortInfo(const std::string& binaryName) noexcept
+{
+    std::cout << "Run '" << binaryName << " --help' for more information." << std::endl;
+}
+
+void RecordApp::parseCmdLineArguments(int argc, char** argv) noexcept
+{
+    int32_t opt;
+    int32_t index;
+
+    while ((opt = getopt_long(argc, argv, recordShortOptions, recordLongOptions, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'v':
+            std::cout << "Latest official iceoryx release version: " << ICEORYX_LATEST_RELEASE_VERSION << "\n"
+                      << std::endl;
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'o':
+            m_directory = optarg;
+            break;
+
+        case 't':
+            if (!parseTopicPattern(optarg))
+            {
+                std::cout << "Invalid topic pattern '" << optarg << "'! Expected <service>/<instance>/<event>."
+                          << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            break;
+
+        case 's':
+        {
+            constexpr uint64_t MAX_SEGMENT_SIZE_IN_MIB{4095U};
+            uint64_t segmentSizeInMiB{0U};
+            if (!cxx::convert::fromString(optarg, segmentSizeInMiB) || segmentSizeInMiB == 0U
+                || segmentSizeInMiB > MAX_SEGMENT_SIZE_IN_MIB)
+            {
+                std::cout << "Invalid argument for `s`! Will be ignored!" << std::endl;
+                break;
+            }
+            m_segmentSize = segmentSizeInMiB * 1024U * 1024U;
+            break;
+        }
+
+        case 'l':
+            m_lossless = true;
+            break;
+
+        case '?':
+        default:
+            printShortInfo(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (m_directory.empty())
+    {
+        std::cout << "Wrong usage. ";
+        printShortInfo(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    if (m_topicPatterns.empty())
+    {
+        m_topicPatterns.push_back({cxx::nullopt, cxx::nullopt, cxx::nullopt});
+    }
+}
+
+bool RecordApp::parseTopicPattern(const std::string& pattern) noexcept
+{
+    constexpr uint64_t NUMBER_OF_PARTS{3U};
+    cxx::optional<capro::IdString_t> parts[NUMBER_OF_PARTS];
+
+    std::istringstream patternStream(pattern);
+    std::string part;
+    uint64_t numberOfParts{0U};
+    while (std::getline(patternStream, part, '/'))
+    {
+        if (numberOfParts == NUMBER_OF_PARTS || part.empty() || part.size() > capro::IdString_t::capacity())
+        {
+            return false;
+        }
+        if (part != "*")
+        {
+            parts[numberOfParts].emplace(cxx::TruncateToCapacity, part);
+        }
+        ++numberOfParts;
+    }
+
+    if (numberOfParts != NUMBER_OF_PARTS)
+    {
+        return false;
+    }
+
+    m_topicPatterns.push_back({parts[0], parts[1], parts[2]});
+    return true;
+}
+
+void RecordApp::run() noexcept
+{
+    auto writerResult = RecordWriter::create(m_directory, m_segmentSize);
+    if (writerResult.has_error())
+    {
+        std::cerr << "Unable to create the recording in '" << m_directory
+                  << "': " << RECORD_ERROR_STRING[static_cast<uint64_t>(writerResult.get_error())] << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    auto& writer = writerResult.value();
+
+    runtime::PoshRuntime::initRuntime("iox-record");
+    runtime::ServiceDiscovery serviceDiscovery;
+    popo::WaitSet<> waitSet;
+
+    auto nextDiscovery = std::chrono::steady_clock::now();
+    bool keepRunning{true};
+    while (keepRunning && !posix::hasTerminationRequested())
+    {
+        if (std::chrono::steady_clock::now() >= nextDiscovery)
+        {
+            discoverTopics(serviceDiscovery, waitSet, writer);
+            nextDiscovery += std::chrono::nanoseconds(DISCOVERY_PERIOD.toNanoseconds());
+        }
+
+        auto notificationVector = waitSet.timedWait(RECORD_WAIT_TIMEOUT);
+        for (auto& notification : notificationVector)
+        {
+            keepRunning = keepRunning && recordTopic(static_cast<uint32_t>(notification->getNotificationId()), writer);
+        }
+    }
+
+    // the subscribers must be detached before the WaitSet goes out of scope
+    for (auto& subscriber : m_subscribers)
+    {
+        waitSet.detachState(*subscriber, popo::SubscriberState::HAS_DATA);
+    }
+
+    std::cout << "Recorded " << m_numberOfRecords << " chunks of " << m_subscribers.size() << " topics with "
+              << writer.bytesWritten() << " bytes into '" << m_directory << "'" << std::endl;
+    if (m_numberOfDataLosses > 0U)
+    {
+        std::cout << "Chunks were lost " << m_numberOfDataLosses
+                  << " times since the subscriber queues overflowed; consider --lossless" << std::endl;
+    }
+}
+
+void RecordApp::discoverTopics(runtime::ServiceDiscovery& serviceDiscovery,
+                               popo::WaitSet<>& waitSet,
+                               RecordWriter& writer) noexcept
+{
+    for (const auto& pattern : m_topicPatterns)
+    {
+        serviceDiscovery.findService(
+            pattern.service,
+            pattern.instance,
+            pattern.event,
+            [&](const capro::ServiceDescription& service) {
+                // the internal topics of RouDi are only recorded when they are requested explicitly
+                const bool isRouDiTopic = service.getInstanceIDString() == SERVICE_DISCOVERY_INSTANCE_NAME;
+                if ((!isRouDiTopic || pattern.instance.has_value())
+                    && std::find(m_services.begin(), m_services.end(), service) == m_services.end())
+                {
+                    addTopic(service, waitSet, writer);
+                }
+            },
+            popo::MessagingPattern::PUB_SUB);
+    }
+}
+
+void RecordApp::addTopic(const capro::ServiceDescription& service,
+                         popo::WaitSet<>& waitSet,
+                         RecordWriter& writer) noexcept
+{
+    // the service is also remembered when it cannot be recorded to report the failure only once
+    m_services.push_back(service);
+
+    popo::SubscriberOptions options;
+    options.queueCapacity = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    options.nodeName = "iox-record";
+    if (m_lossless)
+    {
+        options.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    }
+
+    auto subscriber = std::make_unique<popo::UntypedSubscriber>(service, options);
+    const auto topicId = static_cast<uint32_t>(m_subscribers.size());
+
+    if (waitSet.attachState(*subscriber, popo::SubscriberState::HAS_DATA, topicId).has_error())
+    {
+        std::cerr << "Unable to record " << service << " since the maximum of " << MAX_NUMBER_OF_TOPICS
+                  << " topics is reached" << std::endl;
+        return;
+    }
+
+    auto topicResult = writer.addTopic(service);
+    if (topicResult.has_error())
+    {
+        std::cerr << "Unable to record " << service << ": "
+                  << RECORD_ERROR_STRING[static_cast<uint64_t>(topicResult.get_error())] << std::endl;
+        waitSet.detachState(*subscriber, popo::SubscriberState::HAS_DATA);
+        return;
+    }
+
+    std::cout << "Recording " << service << std::endl;
+    m_subscribers.push_back(std::move(subscriber));
+}
+
+bool RecordApp::recordTopic(const uint32_t topicId, RecordWriter& writer) noexcept
+{
+    auto& subscriber = *m_subscribers[topicId];
+
+    Record records[RecordWriter::MAX_RECORDS_PER_WRITE];
+    uint64_t numberOfRecords{0U};
+    while (numberOfRecords < RecordWriter::MAX_RECORDS_PER_WRITE)
+    {
+        auto takeResult = subscriber.take();
+        if (takeResult.has_error())
+        {
+            break;
+        }
+        records[numberOfRecords++] = {now(), topicId, mepoo::ChunkHeader::fromUserPayload(takeResult.value())};
+    }
+
+    if (subscriber.hasMissedData())
+    {
+        ++m_numberOfDataLosses;
+    }
+
+    auto writeResult = writer.write(records, numberOfRecords);
+
+    // the chunks are written by now and can be released; remaining chunks trigger the WaitSet again
+    for (uint64_t i = 0U; i < numberOfRecords; ++i)
+    {
+        subscriber.release(records[i].chunkHeader->userPayload());
+    }
+
+    if (writeResult.has_error())
+    {
+        std::cerr << "Unable to write the recording: "
+                  << RECORD_ERROR_STRING[static_cast<uint64_t>(writeResult.get_error())] << std::endl;
+        return false;
+    }
+
+    m_numberOfRecords += numberOfRecords;
+    return true;
+}
+
+} // namespace record_replay
+} // namespace iox
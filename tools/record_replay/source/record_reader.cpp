@@ -0,0 +1,253 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/record_reader.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/platform/fcntl.hpp"
+#include "iceoryx_hoofs/platform/stat.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+void closeSegmentFile(const int32_t fileDescriptor) noexcept
+{
+    posix::posixCall(iox_close)(fileDescriptor).failureReturnValue(-1).evaluate().or_else([](auto& r) {
+        std::cerr << "unable to close the segment file: " << r.getHumanReadableErrnum() << std::endl;
+    });
+}
+} // namespace
+
+cxx::expected<RecordReader, RecordError> RecordReader::open(const std::string& directory) noexcept
+{
+    RecordReader reader(directory);
+
+    auto result = reader.readTopics();
+    if (!result.has_error())
+    {
+        reader.readIndex();
+        result = reader.mapSegment(0U);
+    }
+    if (result.has_error())
+    {
+        return cxx::error<RecordError>(result.get_error());
+    }
+
+    return cxx::success<RecordReader>(std::move(reader));
+}
+
+RecordReader::RecordReader(const std::string& directory) noexcept
+    : m_directory(directory)
+{
+}
+
+const std::vector<Topic>& RecordReader::topics() const noexcept
+{
+    return m_topics;
+}
+
+cxx::optional<Record> RecordReader::peek() noexcept
+{
+    while (m_segmentMemory.has_value())
+    {
+        const auto segmentBase = static_cast<const uint8_t*>(m_segmentMemory->getBaseAddress());
+        if (m_offset + sizeof(RecordHeader) <= m_segmentSize)
+        {
+            const auto recordHeader = reinterpret_cast<const RecordHeader*>(segmentBase + m_offset);
+            const uint64_t chunkOffset = m_offset + sizeof(RecordHeader);
+            // a record which is cut off, e.g. since the recorder was killed, ends the segment
+            if (recordHeader->chunkSize >= sizeof(mepoo::ChunkHeader)
+                && chunkOffset + recordHeader->chunkSize <= m_segmentSize && recordHeader->topicId < m_topics.size())
+            {
+                m_recordSize = cxx::align<uint64_t>(sizeof(RecordHeader) + recordHeader->chunkSize, RECORD_ALIGNMENT);
+                return Record{recordHeader->timestamp,
+                              recordHeader->topicId,
+                              reinterpret_cast<const mepoo::ChunkHeader*>(segmentBase + chunkOffset),
+                              recordHeader->chunkSize};
+            }
+        }
+
+        if (mapSegment(m_segment + 1U).has_error())
+        {
+            m_segmentMemory.reset();
+        }
+    }
+
+    return cxx::nullopt;
+}
+
+cxx::optional<Record> RecordReader::next() noexcept
+{
+    auto record = peek();
+    if (record.has_value())
+    {
+        m_offset += m_recordSize;
+    }
+    return record;
+}
+
+cxx::expected<RecordError> RecordReader::seek(const uint64_t timestamp) noexcept
+{
+    // the index entry before the first one with a timestamp which is not smaller than the requested one points to the
+    // last record which is certainly before the timestamp
+    auto indexEntry = std::lower_bound(
+        m_index.begin(), m_index.end(), timestamp, [](const IndexEntry& entry, const uint64_t value) {
+            return entry.timestamp < value;
+        });
+    IndexEntry start;
+    if (indexEntry != m_index.begin())
+    {
+        start = *std::prev(indexEntry);
+    }
+
+    auto result = mapSegment(start.segment);
+    if (result.has_error())
+    {
+        return result;
+    }
+    m_offset = std::max(m_offset, static_cast<uint64_t>(start.offset));
+
+    for (auto record = peek(); record.has_value() && record->timestamp < timestamp; record = peek())
+    {
+        m_offset += m_recordSize;
+    }
+
+    return cxx::success<>();
+}
+
+cxx::expected<RecordError> RecordReader::readTopics() noexcept
+{
+    std::ifstream topicsFile(m_directory + "/" + TOPICS_FILE_NAME);
+    if (!topicsFile.is_open())
+    {
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_OPEN_FILE);
+    }
+
+    constexpr uint64_t NUMBER_OF_FIELDS{4U};
+    std::string line;
+    while (std::getline(topicsFile, line))
+    {
+        std::string fields[NUMBER_OF_FIELDS];
+        std::istringstream lineStream(line);
+        uint64_t numberOfFields{0U};
+        while (numberOfFields < NUMBER_OF_FIELDS && std::getline(lineStream, fields[numberOfFields], '\t'))
+        {
+            ++numberOfFields;
+        }
+
+        uint32_t topicId{0U};
+        // the ids are consecutive, therefore the id of a topic is its position in m_topics
+        if (numberOfFields != NUMBER_OF_FIELDS || !cxx::convert::fromString(fields[0].c_str(), topicId)
+            || topicId != m_topics.size())
+        {
+            return cxx::error<RecordError>(RecordError::INVALID_TOPICS_FILE);
+        }
+
+        m_topics.push_back({topicId,
+                            capro::ServiceDescription(capro::IdString_t(cxx::TruncateToCapacity, fields[1]),
+                                                      capro::IdString_t(cxx::TruncateToCapacity, fields[2]),
+                                                      capro::IdString_t(cxx::TruncateToCapacity, fields[3]))});
+    }
+
+    return cxx::success<>();
+}
+
+void RecordReader::readIndex() noexcept
+{
+    // without an index seek reads the recording from the beginning
+    std::ifstream indexFile(m_directory + "/" + INDEX_FILE_NAME, std::ios::binary);
+    IndexEntry indexEntry;
+    while (indexFile.read(reinterpret_cast<char*>(&indexEntry), sizeof(IndexEntry)))
+    {
+        m_index.push_back(indexEntry);
+    }
+}
+
+cxx::expected<RecordError> RecordReader::mapSegment(const uint32_t segment) noexcept
+{
+    if (m_segmentMemory.has_value() && m_segment == segment)
+    {
+        m_offset = sizeof(SegmentHeader);
+        return cxx::success<>();
+    }
+
+    auto openCall =
+        posix::posixCall(iox_open)(segmentPath(m_directory, segment).c_str(), O_RDONLY, static_cast<mode_t>(0))
+            .failureReturnValue(-1)
+            .suppressErrorMessagesForErrnos(ENOENT)
+            .evaluate();
+    if (openCall.has_error())
+    {
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_OPEN_FILE);
+    }
+    const int32_t fileDescriptor = openCall->value;
+
+    struct stat fileStatus;
+    auto statCall = posix::posixCall(fstat)(fileDescriptor, &fileStatus).failureReturnValue(-1).evaluate();
+    const uint64_t segmentSize = statCall.has_error() ? 0U : static_cast<uint64_t>(fileStatus.st_size);
+    if (segmentSize < sizeof(SegmentHeader))
+    {
+        closeSegmentFile(fileDescriptor);
+        return cxx::error<RecordError>(RecordError::INVALID_SEGMENT);
+    }
+
+    auto memoryMap = posix::MemoryMapBuilder()
+                         .baseAddressHint(nullptr)
+                         .length(segmentSize)
+                         .fileDescriptor(fileDescriptor)
+                         .accessMode(posix::AccessMode::READ_ONLY)
+                         .flags(posix::MemoryMapFlags::PRIVATE_CHANGES)
+                         .offset(0)
+                         .create();
+
+    // the mapping stays valid after the file is closed
+    closeSegmentFile(fileDescriptor);
+
+    if (memoryMap.has_error())
+    {
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_MAP_SEGMENT);
+    }
+
+    const auto segmentHeader = static_cast<const SegmentHeader*>(memoryMap->getBaseAddress());
+    if (segmentHeader->magic != SegmentHeader::MAGIC || segmentHeader->formatVersion != RECORD_FORMAT_VERSION)
+    {
+        return cxx::error<RecordError>(RecordError::INVALID_SEGMENT);
+    }
+    if (segmentHeader->chunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        return cxx::error<RecordError>(RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+    }
+
+    m_segmentMemory.emplace(std::move(memoryMap.value()));
+    m_segmentSize = segmentSize;
+    m_segment = segment;
+    m_offset = sizeof(SegmentHeader);
+
+    return cxx::success<>();
+}
+
+} // namespace record_replay
+} // namespace iox
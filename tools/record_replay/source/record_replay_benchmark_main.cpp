@@ -0,0 +1,174 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_record_replay/record_reader.hpp"
+#include "iceoryx_record_replay/record_writer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+// Measures the throughput of the RecordWriter and the RecordReader. The writer records the same chunk over
+// and over again, i.e. the chunk stays in the CPU cache and the measurement is dominated by the file system; the
+// reader copies every user-payload like a replay into a loaned chunk would do.
+namespace
+{
+using namespace iox;
+using namespace iox::record_replay;
+
+constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                  {"output", required_argument, nullptr, 'o'},
+                                  {"size", required_argument, nullptr, 's'},
+                                  {"payload-size", required_argument, nullptr, 'p'},
+                                  {nullptr, 0, nullptr, 0}};
+constexpr const char* shortOptions = "ho:s:p:";
+
+constexpr uint64_t MIB{1024U * 1024U};
+constexpr uint64_t SEGMENT_SIZE{1024U * MIB};
+
+double secondsSince(const std::chrono::steady_clock::time_point start) noexcept
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-bm-record-replay [OPTIONS]\n"
+                 "\nOptions:\n"
+                 "  -h, --help                  Display help and exit.\n"
+                 "  -o, --output <directory>    Directory of the recording. [default: /tmp/iox-bm-record-replay]\n"
+                 "  -s, --size <MiB>            Amount of data which is recorded. [default: 4096]\n"
+                 "  -p, --payload-size <bytes>  User-payload size of the recorded chunks. [default: 1048576]\n"
+              << std::endl;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string directory{"/tmp/iox-bm-record-replay"};
+    uint64_t sizeInMiB{4096U};
+    uint32_t payloadSize{1024U * 1024U};
+
+    int32_t opt;
+    int32_t index;
+    while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'o':
+            directory = optarg;
+            break;
+        case 's':
+            if (!cxx::convert::fromString(optarg, sizeInMiB) || sizeInMiB == 0U)
+            {
+                std::cout << "Invalid argument for `s`!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'p':
+            if (!cxx::convert::fromString(optarg, payloadSize))
+            {
+                std::cout << "Invalid argument for `p`!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            printHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto chunkSettings = mepoo::ChunkSettings::create(payloadSize, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    if (chunkSettings.has_error() || chunkSettings->requiredChunkSize() > SEGMENT_SIZE / 2U)
+    {
+        std::cout << "Invalid payload size!" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const uint32_t chunkSize = chunkSettings->requiredChunkSize();
+    std::unique_ptr<uint64_t[]> chunkMemory(new uint64_t[chunkSize / sizeof(uint64_t) + 1U]);
+    auto chunkHeader = new (chunkMemory.get()) mepoo::ChunkHeader(chunkSize, chunkSettings.value());
+    std::memset(chunkHeader->userPayload(), 42, payloadSize);
+
+    const uint64_t numberOfRecords = std::max<uint64_t>(1U, sizeInMiB * MIB / chunkSize);
+    uint64_t bytesWritten{0U};
+
+    {
+        auto writer = RecordWriter::create(directory, SEGMENT_SIZE);
+        if (writer.has_error() || writer->addTopic({"Benchmark", "Record", "Replay"}).has_error())
+        {
+            std::cout << "Unable to create the recording in '" << directory << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        Record records[RecordWriter::MAX_RECORDS_PER_WRITE];
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t written = 0U; written < numberOfRecords; written += RecordWriter::MAX_RECORDS_PER_WRITE)
+        {
+            const uint64_t batchSize = std::min(numberOfRecords - written, RecordWriter::MAX_RECORDS_PER_WRITE);
+            for (uint64_t i = 0U; i < batchSize; ++i)
+            {
+                records[i] = {written + i, 0U, chunkHeader};
+            }
+            if (writer->write(records, batchSize).has_error())
+            {
+                std::cout << "Unable to write the recording" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        const double writeSeconds = secondsSince(start);
+        bytesWritten = writer->bytesWritten();
+        // the data is only on the disk after sync
+        ::sync();
+        const double syncSeconds = secondsSince(start);
+
+        std::cout << "write: " << numberOfRecords << " records, " << bytesWritten / MIB << " MiB in " << writeSeconds
+                  << " s -> " << static_cast<double>(bytesWritten) / writeSeconds / 1e9 << " GB/s (page cache), "
+                  << static_cast<double>(bytesWritten) / syncSeconds / 1e9 << " GB/s (including sync)" << std::endl;
+    }
+
+    auto reader = RecordReader::open(directory);
+    if (reader.has_error())
+    {
+        std::cout << "Unable to open the recording in '" << directory << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::unique_ptr<uint64_t[]> replayMemory(new uint64_t[payloadSize / sizeof(uint64_t) + 1U]);
+    uint64_t numberOfReadRecords{0U};
+    const auto start = std::chrono::steady_clock::now();
+    for (auto record = reader->next(); record.has_value(); record = reader->next())
+    {
+        std::memcpy(replayMemory.get(), record->chunkHeader->userPayload(), record->chunkHeader->userPayloadSize());
+        ++numberOfReadRecords;
+    }
+    const double readSeconds = secondsSince(start);
+
+    std::cout << "read:  " << numberOfReadRecords << " records, " << bytesWritten / MIB << " MiB in " << readSeconds
+              << " s -> " << static_cast<double>(bytesWritten) / readSeconds / 1e9 << " GB/s" << std::endl;
+
+    return numberOfReadRecords == numberOfRecords ? EXIT_SUCCESS : EXIT_FAILURE;
+}
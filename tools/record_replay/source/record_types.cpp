@@ -0,0 +1,36 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/record_types.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace iox
+{
+namespace record_replay
+{
+std::string segmentPath(const std::string& directory, const uint32_t segment) noexcept
+{
+    constexpr int32_t SEGMENT_NUMBER_DIGITS{6};
+    std::ostringstream path;
+    path << directory << "/" << SEGMENT_FILE_PREFIX << std::setw(SEGMENT_NUMBER_DIGITS) << std::setfill('0') << segment
+         << SEGMENT_FILE_SUFFIX;
+    return path.str();
+}
+
+} // namespace record_replay
+} // namespace iox
@@ -0,0 +1,315 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/record_writer.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/platform/fcntl.hpp"
+#include "iceoryx_hoofs/platform/stat.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+/// @brief the source of the padding bytes between the records
+constexpr uint8_t PADDING[RECORD_ALIGNMENT]{};
+} // namespace
+
+namespace internal
+{
+void skipWrittenBytes(struct iovec*& vectors, int32_t& numberOfVectors, uint64_t bytesWritten) noexcept
+{
+    while (numberOfVectors > 0 && bytesWritten >= vectors->iov_len)
+    {
+        bytesWritten -= vectors->iov_len;
+        ++vectors;
+        --numberOfVectors;
+    }
+    if (numberOfVectors > 0)
+    {
+        vectors->iov_base = static_cast<uint8_t*>(vectors->iov_base) + bytesWritten;
+        vectors->iov_len -= bytesWritten;
+    }
+}
+} // namespace internal
+
+constexpr uint64_t RecordWriter::MAX_RECORDS_PER_WRITE;
+
+cxx::expected<RecordWriter, RecordError> RecordWriter::create(const std::string& directory,
+                                                              const uint64_t segmentSize) noexcept
+{
+    constexpr uint64_t MIN_SEGMENT_SIZE{sizeof(SegmentHeader) + sizeof(RecordHeader) + sizeof(mepoo::ChunkHeader)};
+    if (segmentSize < MIN_SEGMENT_SIZE || segmentSize > std::numeric_limits<uint32_t>::max())
+    {
+        return cxx::error<RecordError>(RecordError::INVALID_SEGMENT_SIZE);
+    }
+
+    if (posix::posixCall(mkdir)(directory.c_str(), static_cast<mode_t>(S_IRWXU | S_IRGRP | S_IXGRP))
+            .failureReturnValue(-1)
+            .ignoreErrnos(EEXIST)
+            .evaluate()
+            .has_error())
+    {
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_CREATE_DIRECTORY);
+    }
+
+    // the segments of a previous recording which exceed the new one must not be replayed
+    for (uint32_t segment = 0U;; ++segment)
+    {
+        if (posix::posixCall(unlink)(segmentPath(directory, segment).c_str())
+                .failureReturnValue(-1)
+                .suppressErrorMessagesForErrnos(ENOENT)
+                .evaluate()
+                .has_error())
+        {
+            break;
+        }
+    }
+
+    RecordWriter writer(directory, segmentSize);
+    if (!writer.m_topicsFile.is_open() || !writer.m_indexFile.is_open())
+    {
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_OPEN_FILE);
+    }
+
+    auto result = writer.openSegment();
+    if (result.has_error())
+    {
+        return cxx::error<RecordError>(result.get_error());
+    }
+
+    return cxx::success<RecordWriter>(std::move(writer));
+}
+
+RecordWriter::RecordWriter(const std::string& directory, const uint64_t segmentSize) noexcept
+    : m_directory(directory)
+    , m_segmentSize(segmentSize)
+    , m_topicsFile(directory + "/" + TOPICS_FILE_NAME, std::ios::out | std::ios::trunc)
+    , m_indexFile(directory + "/" + INDEX_FILE_NAME, std::ios::out | std::ios::trunc | std::ios::binary)
+{
+}
+
+RecordWriter::RecordWriter(RecordWriter&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+RecordWriter& RecordWriter::operator=(RecordWriter&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        closeSegment();
+
+        m_directory = std::move(rhs.m_directory);
+        m_segmentSize = rhs.m_segmentSize;
+        m_numberOfTopics = rhs.m_numberOfTopics;
+        m_segment = rhs.m_segment;
+        m_segmentFileDescriptor = rhs.m_segmentFileDescriptor;
+        m_segmentOffset = rhs.m_segmentOffset;
+        m_nextIndexOffset = rhs.m_nextIndexOffset;
+        m_bytesWritten = rhs.m_bytesWritten;
+        m_topicsFile = std::move(rhs.m_topicsFile);
+        m_indexFile = std::move(rhs.m_indexFile);
+
+        rhs.m_segmentFileDescriptor = INVALID_FILE_DESCRIPTOR;
+    }
+    return *this;
+}
+
+RecordWriter::~RecordWriter() noexcept
+{
+    closeSegment();
+}
+
+cxx::expected<uint32_t, RecordError> RecordWriter::addTopic(const capro::ServiceDescription& service) noexcept
+{
+    if (m_numberOfTopics >= MAX_NUMBER_OF_TOPICS)
+    {
+        return cxx::error<RecordError>(RecordError::TOO_MANY_TOPICS);
+    }
+
+    const uint32_t topicId = m_numberOfTopics;
+    m_topicsFile << topicId << '\t' << service.getServiceIDString().c_str() << '\t'
+                 << service.getInstanceIDString().c_str() << '\t' << service.getEventIDString().c_str() << std::endl;
+    if (!m_topicsFile.good())
+    {
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_WRITE_FILE);
+    }
+
+    ++m_numberOfTopics;
+    return cxx::success<uint32_t>(topicId);
+}
+
+cxx::expected<RecordError> RecordWriter::write(const Record* const records, const uint64_t numberOfRecords) noexcept
+{
+    for (uint64_t written = 0U; written < numberOfRecords; written += MAX_RECORDS_PER_WRITE)
+    {
+        auto result = writeBatch(records + written, std::min(numberOfRecords - written, MAX_RECORDS_PER_WRITE));
+        if (result.has_error())
+        {
+            return result;
+        }
+    }
+    return cxx::success<>();
+}
+
+cxx::expected<RecordError> RecordWriter::writeBatch(const Record* const records,
+                                                    const uint64_t numberOfRecords) noexcept
+{
+    constexpr uint64_t VECTORS_PER_RECORD{3U};
+    RecordHeader recordHeaders[MAX_RECORDS_PER_WRITE];
+    struct iovec vectors[MAX_RECORDS_PER_WRITE * VECTORS_PER_RECORD];
+    int32_t numberOfVectors{0};
+
+    for (uint64_t i = 0U; i < numberOfRecords; ++i)
+    {
+        const uint32_t chunkSize = records[i].chunkHeader->usedSizeOfChunk();
+        const uint64_t recordSize = cxx::align<uint64_t>(sizeof(RecordHeader) + chunkSize, RECORD_ALIGNMENT);
+        if (recordSize > m_segmentSize - sizeof(SegmentHeader))
+        {
+            return cxx::error<RecordError>(RecordError::RECORD_EXCEEDS_SEGMENT_SIZE);
+        }
+
+        if (m_segmentOffset + recordSize > m_segmentSize)
+        {
+            auto result = writeToSegment(vectors, numberOfVectors);
+            if (result.has_error())
+            {
+                return result;
+            }
+            numberOfVectors = 0;
+
+            closeSegment();
+            if (!m_indexFile.good())
+            {
+                return cxx::error<RecordError>(RecordError::UNABLE_TO_WRITE_FILE);
+            }
+            ++m_segment;
+            result = openSegment();
+            if (result.has_error())
+            {
+                return result;
+            }
+        }
+
+        auto& recordHeader = recordHeaders[i];
+        recordHeader.timestamp = records[i].timestamp;
+        recordHeader.topicId = records[i].topicId;
+        recordHeader.chunkSize = chunkSize;
+
+        if (m_segmentOffset >= m_nextIndexOffset)
+        {
+            IndexEntry indexEntry{recordHeader.timestamp, m_segment, static_cast<uint32_t>(m_segmentOffset)};
+            if (!m_indexFile.write(reinterpret_cast<const char*>(&indexEntry), sizeof(IndexEntry)))
+            {
+                return cxx::error<RecordError>(RecordError::UNABLE_TO_WRITE_FILE);
+            }
+            m_nextIndexOffset = m_segmentOffset + INDEX_INTERVAL;
+        }
+
+        vectors[numberOfVectors++] = {&recordHeader, sizeof(RecordHeader)};
+        // the chunk is only read by writev; the const_cast is required by the iovec interface
+        vectors[numberOfVectors++] = {const_cast<mepoo::ChunkHeader*>(records[i].chunkHeader), chunkSize};
+        const uint64_t paddingSize = recordSize - sizeof(RecordHeader) - chunkSize;
+        if (paddingSize > 0U)
+        {
+            vectors[numberOfVectors++] = {const_cast<uint8_t*>(PADDING), paddingSize};
+        }
+
+        m_segmentOffset += recordSize;
+    }
+
+    return writeToSegment(vectors, numberOfVectors);
+}
+
+uint64_t RecordWriter::bytesWritten() const noexcept
+{
+    return m_bytesWritten;
+}
+
+cxx::expected<RecordError> RecordWriter::openSegment() noexcept
+{
+    auto openCall = posix::posixCall(iox_open)(segmentPath(m_directory, m_segment).c_str(),
+                                               O_CREAT | O_WRONLY | O_TRUNC,
+                                               static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP))
+                        .failureReturnValue(-1)
+                        .evaluate();
+    if (openCall.has_error())
+    {
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_OPEN_FILE);
+    }
+    m_segmentFileDescriptor = openCall->value;
+
+    SegmentHeader segmentHeader;
+    struct iovec vector
+    {
+        &segmentHeader, sizeof(SegmentHeader)
+    };
+    m_segmentOffset = sizeof(SegmentHeader);
+    m_nextIndexOffset = m_segmentOffset;
+
+    return writeToSegment(&vector, 1);
+}
+
+void RecordWriter::closeSegment() noexcept
+{
+    if (m_segmentFileDescriptor == INVALID_FILE_DESCRIPTOR)
+    {
+        return;
+    }
+
+    posix::posixCall(iox_close)(m_segmentFileDescriptor).failureReturnValue(-1).evaluate().or_else([](auto& r) {
+        std::cerr << "unable to close the segment file: " << r.getHumanReadableErrnum() << std::endl;
+    });
+    m_segmentFileDescriptor = INVALID_FILE_DESCRIPTOR;
+
+    // the reader can seek in the completed segments while the recording is still running
+    if (!m_indexFile.flush())
+    {
+        std::cerr << "unable to write the index file" << std::endl;
+    }
+}
+
+cxx::expected<RecordError> RecordWriter::writeToSegment(struct iovec* vectors, int32_t numberOfVectors) noexcept
+{
+    while (numberOfVectors > 0)
+    {
+        auto writeCall = posix::posixCall(writev)(m_segmentFileDescriptor, vectors, numberOfVectors)
+                             .failureReturnValue(-1)
+                             .evaluate();
+        if (writeCall.has_error())
+        {
+            return cxx::error<RecordError>(RecordError::UNABLE_TO_WRITE_FILE);
+        }
+
+        // the remaining data of a partial write is written with the next call
+        const auto bytesWritten = static_cast<uint64_t>(writeCall->value);
+        m_bytesWritten += bytesWritten;
+        internal::skipWrittenBytes(vectors, numberOfVectors, bytesWritten);
+    }
+
+    return cxx::success<>();
+}
+
+} // namespace record_replay
+} // namespace iox
@@ -0,0 +1,290 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/replay_app.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/posix_wrapper/signal_watcher.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_versions.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+uint64_t now() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+/// @brief the user-header alignment is not part of the ChunkHeader; since the user-header size is a multiple of its
+/// alignment and the alignment is limited to the one of the ChunkHeader, the largest power of two which divides the
+/// size, limited to the ChunkHeader alignment, is a valid alignment which results in the same chunk layout
+uint32_t userHeaderAlignment(const uint32_t userHeaderSize) noexcept
+{
+    if (userHeaderSize == 0U)
+    {
+        return CHUNK_NO_USER_HEADER_ALIGNMENT;
+    }
+    const uint32_t lowestSetBit = userHeaderSize & (~userHeaderSize + 1U);
+    return std::min(lowestSetBit, static_cast<uint32_t>(alignof(mepoo::ChunkHeader)));
+}
+
+/// @brief the sizes and the user-payload offset in the ChunkHeader are read from the recording; a corrupted record must
+/// not let the replay read beyond the recorded chunk
+bool isChunkWithinRecord(const Record& record) noexcept
+{
+    const auto& chunkHeader = *record.chunkHeader;
+    const uint64_t userHeaderEnd = sizeof(mepoo::ChunkHeader) + static_cast<uint64_t>(chunkHeader.userHeaderSize());
+    const uint64_t userPayloadOffset = static_cast<uint64_t>(static_cast<const uint8_t*>(chunkHeader.userPayload())
+                                                             - reinterpret_cast<const uint8_t*>(&chunkHeader));
+    const uint64_t userPayloadEnd = userPayloadOffset + static_cast<uint64_t>(chunkHeader.userPayloadSize());
+    return userHeaderEnd <= record.chunkSize && userPayloadEnd <= record.chunkSize;
+}
+} // namespace
+
+ReplayApp::ReplayApp(int argc, char* argv[]) noexcept
+{
+    parseCmdLineArguments(argc, argv);
+}
+
+void ReplayApp::printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-replay [OPTIONS] --input <directory>\n"
+                 "  iox-replay --help\n"
+                 "  iox-replay --version\n"
+                 "\nOptions:\n"
+                 "  -h, --help               Display help and exit.\n"
+                 "  -i, --input <directory>  Directory of the recording.\n"
+                 "  -r, --rate <factor>      Replay speed relative to the recording; 0 replays as fast as possible.\n"
+                 "                           [default: "
+              << DEFAULT_REPLAY_RATE
+              << "]\n"
+                 "  -s, --start <ms>         Skip the first <ms> milliseconds of the recording. [default: 0]\n"
+                 "  -d, --delay <ms>         Wait <ms> milliseconds after offering the topics to give the\n"
+                 "                           subscribers time to connect. [default: "
+              << DEFAULT_REPLAY_DELAY_IN_MS
+              << "]\n"
+                 "  -v, --version            Display latest official iceoryx release version and exit.\n"
+              << std::endl;
+}
+
+void ReplayApp::printShortInfo(const std::string& binaryName) noexcept
+{
+    std::cout << "Run '" << binaryName << " --help' for more information." << std::endl;
+}
+
+void ReplayApp::parseCmdLineArguments(int argc, char** argv) noexcept
+{
+    int32_t opt;
+    int32_t index;
+
+    while ((opt = getopt_long(argc, argv, replayShortOptions, replayLongOptions, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'v':
+            std::cout << "Latest official iceoryx release version: " << ICEORYX_LATEST_RELEASE_VERSION << "\n"
+                      << std::endl;
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'i':
+            m_directory = optarg;
+            break;
+
+        case 'r':
+        {
+            double rate{0.0};
+            if (!cxx::convert::fromString(optarg, rate) || rate < 0.0)
+            {
+                std::cout << "Invalid argument for `r`! Will be ignored!" << std::endl;
+                break;
+            }
+            m_rate = rate;
+            break;
+        }
+
+        case 's':
+            if (!cxx::convert::fromString(optarg, m_startOffsetInMs))
+            {
+                std::cout << "Invalid argument for `s`! Will be ignored!" << std::endl;
+                m_startOffsetInMs = 0U;
+            }
+            break;
+
+        case 'd':
+            if (!cxx::convert::fromString(optarg, m_delayInMs))
+            {
+                std::cout << "Invalid argument for `d`! Will be ignored!" << std::endl;
+                m_delayInMs = DEFAULT_REPLAY_DELAY_IN_MS;
+            }
+            break;
+
+        case '?':
+        default:
+            printShortInfo(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (m_directory.empty())
+    {
+        std::cout << "Wrong usage. ";
+        printShortInfo(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+void ReplayApp::run() noexcept
+{
+    auto readerResult = RecordReader::open(m_directory);
+    if (readerResult.has_error())
+    {
+        std::cerr << "Unable to open the recording in '" << m_directory
+                  << "': " << RECORD_ERROR_STRING[static_cast<uint64_t>(readerResult.get_error())] << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    auto& reader = readerResult.value();
+
+    auto firstRecord = reader.peek();
+    if (!firstRecord.has_value())
+    {
+        std::cout << "The recording in '" << m_directory << "' is empty" << std::endl;
+        return;
+    }
+
+    constexpr uint64_t NANOSECONDS_PER_MILLISECOND{1000U * 1000U};
+    const uint64_t recordingStart = firstRecord->timestamp + m_startOffsetInMs * NANOSECONDS_PER_MILLISECOND;
+    if (m_startOffsetInMs > 0U && reader.seek(recordingStart).has_error())
+    {
+        std::cerr << "Unable to seek to " << m_startOffsetInMs << " ms" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    runtime::PoshRuntime::initRuntime("iox-replay");
+
+    popo::PublisherOptions options;
+    options.nodeName = "iox-replay";
+    for (const auto& topic : reader.topics())
+    {
+        m_publishers.push_back(std::make_unique<popo::UntypedPublisher>(topic.service, options));
+    }
+
+    if (!sleepUntil(now() + m_delayInMs * NANOSECONDS_PER_MILLISECOND))
+    {
+        return;
+    }
+
+    const uint64_t replayStart = now();
+    for (auto record = reader.next(); record.has_value(); record = reader.next())
+    {
+        if (m_rate > 0.0)
+        {
+            const auto recordingTime = static_cast<double>(record->timestamp - recordingStart);
+            if (!sleepUntil(replayStart + static_cast<uint64_t>(recordingTime / m_rate)))
+            {
+                break;
+            }
+        }
+        else if (posix::hasTerminationRequested())
+        {
+            break;
+        }
+
+        if (!isChunkWithinRecord(record.value()))
+        {
+            ++m_numberOfInvalidRecords;
+        }
+        else if (!replayRecord(record.value()))
+        {
+            ++m_numberOfFailedLoans;
+        }
+    }
+
+    std::cout << "Replayed " << m_numberOfReplayedRecords << " chunks of " << m_publishers.size() << " topics from '"
+              << m_directory << "'" << std::endl;
+    if (m_numberOfFailedLoans > 0U)
+    {
+        std::cout << m_numberOfFailedLoans << " chunks could not be replayed since no chunk could be loaned"
+                  << std::endl;
+    }
+    if (m_numberOfInvalidRecords > 0U)
+    {
+        std::cout << m_numberOfInvalidRecords
+                  << " chunks were skipped since their user-header or user-payload exceeds the recorded chunk"
+                  << std::endl;
+    }
+}
+
+bool ReplayApp::sleepUntil(const uint64_t timePointInNs) noexcept
+{
+    const auto maxSleep = MAX_REPLAY_SLEEP.toNanoseconds();
+    for (uint64_t currentTime = now(); currentTime < timePointInNs; currentTime = now())
+    {
+        if (posix::hasTerminationRequested())
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(std::min(timePointInNs - currentTime, maxSleep)));
+    }
+    return !posix::hasTerminationRequested();
+}
+
+bool ReplayApp::replayRecord(const Record& record) noexcept
+{
+    const auto& chunkHeader = *record.chunkHeader;
+    auto& publisher = *m_publishers[record.topicId];
+
+    auto loanResult = publisher.loan(chunkHeader.userPayloadSize(),
+                                     chunkHeader.userPayloadAlignment(),
+                                     chunkHeader.userHeaderSize(),
+                                     userHeaderAlignment(chunkHeader.userHeaderSize()));
+    if (loanResult.has_error())
+    {
+        return false;
+    }
+
+    auto userPayload = loanResult.value();
+    auto loanedChunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+    if (chunkHeader.userHeaderSize() > 0U)
+    {
+        std::memcpy(loanedChunkHeader->userHeader(), chunkHeader.userHeader(), chunkHeader.userHeaderSize());
+    }
+    std::memcpy(userPayload, chunkHeader.userPayload(), chunkHeader.userPayloadSize());
+
+    publisher.publish(userPayload);
+    ++m_numberOfReplayedRecords;
+    return true;
+}
+
+} // namespace record_replay
+} // namespace iox
@@ -0,0 +1,209 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/record_reader.hpp"
+#include "iceoryx_record_replay/record_writer.hpp"
+#include "test_record_replay_fixture.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <unistd.h>
+
+namespace
+{
+using namespace iox_test_record_replay;
+
+class RecordReader_test : public RecordReplay_test
+{
+  public:
+    static constexpr uint64_t RECORDS_PER_SEGMENT{2U};
+    static constexpr uint64_t NUMBER_OF_RECORDS{5U};
+    /// @brief the records are written with a gap between the timestamps to seek in between
+    static constexpr uint64_t TIMESTAMP_STEP{10U};
+
+    /// @brief writes NUMBER_OF_RECORDS records to segments with RECORDS_PER_SEGMENT records each
+    void writeRecording()
+    {
+        auto writer = RecordWriter::create(m_directory, sizeof(SegmentHeader) + RECORDS_PER_SEGMENT * recordSize());
+        ASSERT_FALSE(writer.has_error());
+        auto topicId = writer->addTopic(m_service);
+        ASSERT_FALSE(topicId.has_error());
+
+        Record records[NUMBER_OF_RECORDS];
+        for (uint64_t i = 0U; i < NUMBER_OF_RECORDS; ++i)
+        {
+            records[i] = {i * TIMESTAMP_STEP, topicId.value(), createChunk(static_cast<uint8_t>(i))};
+        }
+        ASSERT_FALSE(writer->write(records, NUMBER_OF_RECORDS).has_error());
+    }
+
+    void expectRecord(const cxx::optional<Record>& record, const uint64_t number)
+    {
+        ASSERT_TRUE(record.has_value());
+        EXPECT_THAT(record->timestamp, Eq(number * TIMESTAMP_STEP));
+        EXPECT_THAT(record->topicId, Eq(0U));
+        EXPECT_THAT(record->chunkSize, Eq(record->chunkHeader->usedSizeOfChunk()));
+        ASSERT_THAT(record->chunkHeader->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+        const auto userPayload = static_cast<const uint8_t*>(record->chunkHeader->userPayload());
+        EXPECT_THAT(userPayload[0U], Eq(number));
+        EXPECT_THAT(userPayload[USER_PAYLOAD_SIZE - 1U], Eq(number));
+    }
+
+    /// @brief overwrites a byte of the SegmentHeader of the first segment
+    void overwriteSegmentHeader(const uint64_t offset, const uint8_t value)
+    {
+        std::fstream segment(segmentPath(m_directory, 0U), std::ios::in | std::ios::out | std::ios::binary);
+        segment.seekp(static_cast<std::streamoff>(offset));
+        segment.put(static_cast<char>(value));
+        ASSERT_TRUE(segment.good());
+    }
+};
+
+constexpr uint64_t RecordReader_test::RECORDS_PER_SEGMENT;
+constexpr uint64_t RecordReader_test::NUMBER_OF_RECORDS;
+constexpr uint64_t RecordReader_test::TIMESTAMP_STEP;
+
+TEST_F(RecordReader_test, OpeningMissingRecordingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ec8a566a-bdeb-460e-8f4e-258de3c4237e");
+    auto reader = RecordReader::open(m_directory);
+
+    ASSERT_TRUE(reader.has_error());
+    EXPECT_THAT(reader.get_error(), Eq(RecordError::UNABLE_TO_OPEN_FILE));
+}
+
+TEST_F(RecordReader_test, RecordsAreReadInOrderAcrossAllSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df936653-6abc-4376-9e5b-9b3cf30a56ff");
+    writeRecording();
+    auto reader = RecordReader::open(m_directory);
+    ASSERT_FALSE(reader.has_error());
+
+    ASSERT_THAT(reader->topics().size(), Eq(1U));
+    EXPECT_THAT(reader->topics()[0U].service, Eq(m_service));
+    for (uint64_t i = 0U; i < NUMBER_OF_RECORDS; ++i)
+    {
+        expectRecord(reader->next(), i);
+    }
+    EXPECT_FALSE(reader->next().has_value());
+}
+
+TEST_F(RecordReader_test, SeekPositionsAtFirstRecordWithEqualTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5129207-a95e-4206-8866-f3fe3fefa398");
+    writeRecording();
+    auto reader = RecordReader::open(m_directory);
+    ASSERT_FALSE(reader.has_error());
+
+    ASSERT_FALSE(reader->seek(3U * TIMESTAMP_STEP).has_error());
+
+    expectRecord(reader->next(), 3U);
+}
+
+TEST_F(RecordReader_test, SeekPositionsAtFirstRecordWithLargerTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6896fa0d-2e0b-4abc-bc49-5c5cd92312f6");
+    writeRecording();
+    auto reader = RecordReader::open(m_directory);
+    ASSERT_FALSE(reader.has_error());
+
+    ASSERT_FALSE(reader->seek(2U * TIMESTAMP_STEP + 1U).has_error());
+
+    expectRecord(reader->next(), 3U);
+}
+
+TEST_F(RecordReader_test, SeekBackwardsAfterReadingTheWholeRecordingWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14e72b46-45da-4b67-bd49-c7a784115589");
+    writeRecording();
+    auto reader = RecordReader::open(m_directory);
+    ASSERT_FALSE(reader.has_error());
+    while (reader->next().has_value())
+    {
+    }
+
+    ASSERT_FALSE(reader->seek(TIMESTAMP_STEP).has_error());
+
+    expectRecord(reader->next(), 1U);
+}
+
+TEST_F(RecordReader_test, SeekBeyondTheLastRecordEndsTheRecording)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8fddc9f-ee26-4373-862e-69caf32dd97a");
+    writeRecording();
+    auto reader = RecordReader::open(m_directory);
+    ASSERT_FALSE(reader.has_error());
+
+    ASSERT_FALSE(reader->seek(NUMBER_OF_RECORDS * TIMESTAMP_STEP).has_error());
+
+    EXPECT_FALSE(reader->next().has_value());
+}
+
+TEST_F(RecordReader_test, SeekWithoutIndexReadsFromTheBeginning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "86227368-4c77-4a8c-ab23-5919a520ff15");
+    writeRecording();
+    ASSERT_THAT(std::remove((m_directory + "/" + INDEX_FILE_NAME).c_str()), Eq(0));
+    auto reader = RecordReader::open(m_directory);
+    ASSERT_FALSE(reader.has_error());
+
+    ASSERT_FALSE(reader->seek(4U * TIMESTAMP_STEP).has_error());
+
+    expectRecord(reader->next(), 4U);
+}
+
+TEST_F(RecordReader_test, TruncatedLastRecordEndsTheRecording)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d7ead34-c245-4c78-8bd2-f9ebfc77f1b0");
+    writeRecording();
+    // the last segment contains only the last record
+    const auto lastSegment = segmentPath(m_directory, NUMBER_OF_RECORDS / RECORDS_PER_SEGMENT);
+    ASSERT_THAT(truncate(lastSegment.c_str(), static_cast<off_t>(sizeof(SegmentHeader) + recordSize() - 1U)), Eq(0));
+    auto reader = RecordReader::open(m_directory);
+    ASSERT_FALSE(reader.has_error());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_RECORDS - 1U; ++i)
+    {
+        expectRecord(reader->next(), i);
+    }
+    EXPECT_FALSE(reader->next().has_value());
+}
+
+TEST_F(RecordReader_test, SegmentWithDifferentFormatVersionIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3cb8489d-78a1-46b9-a177-7359414d2468");
+    writeRecording();
+    overwriteSegmentHeader(offsetof(SegmentHeader, formatVersion), RECORD_FORMAT_VERSION + 1U);
+
+    auto reader = RecordReader::open(m_directory);
+
+    ASSERT_TRUE(reader.has_error());
+    EXPECT_THAT(reader.get_error(), Eq(RecordError::INVALID_SEGMENT));
+}
+
+TEST_F(RecordReader_test, SegmentWithDifferentChunkHeaderVersionIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "363c1299-4328-4c27-9180-0723eba3a6de");
+    writeRecording();
+    overwriteSegmentHeader(offsetof(SegmentHeader, chunkHeaderVersion), mepoo::ChunkHeader::CHUNK_HEADER_VERSION + 1U);
+
+    auto reader = RecordReader::open(m_directory);
+
+    ASSERT_TRUE(reader.has_error());
+    EXPECT_THAT(reader.get_error(), Eq(RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION));
+}
+
+} // namespace
@@ -0,0 +1,90 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_TOOLS_RECORD_REPLAY_TEST_RECORD_REPLAY_FIXTURE_HPP
+#define IOX_TOOLS_RECORD_REPLAY_TEST_RECORD_REPLAY_FIXTURE_HPP
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_record_replay/record_types.hpp"
+
+#include "iceoryx_hoofs/testing/test.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace iox_test_record_replay
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::record_replay;
+
+constexpr uint32_t USER_PAYLOAD_SIZE{16U};
+constexpr uint32_t USER_PAYLOAD_ALIGNMENT{8U};
+
+class RecordReplay_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        removeRecording();
+    }
+
+    void TearDown() override
+    {
+        removeRecording();
+    }
+
+    /// @brief creates a chunk like the ones in the shared memory with the given value in every user-payload byte
+    const mepoo::ChunkHeader* createChunk(const uint8_t value)
+    {
+        auto chunkSettings = mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT).value();
+        m_chunkMemory.emplace_back(chunkSettings.requiredChunkSize() / sizeof(uint64_t) + 1U);
+        auto chunkHeader = new (m_chunkMemory.back().data())
+            mepoo::ChunkHeader(chunkSettings.requiredChunkSize(), chunkSettings);
+        std::memset(chunkHeader->userPayload(), value, USER_PAYLOAD_SIZE);
+        return chunkHeader;
+    }
+
+    /// @brief the size of a record with a chunk of createChunk in a segment
+    uint64_t recordSize()
+    {
+        return cxx::align<uint64_t>(sizeof(RecordHeader) + createChunk(0U)->usedSizeOfChunk(), RECORD_ALIGNMENT);
+    }
+
+    void removeRecording()
+    {
+        for (uint32_t segment = 0U; std::remove(segmentPath(m_directory, segment).c_str()) == 0; ++segment)
+        {
+        }
+        std::remove((m_directory + "/" + TOPICS_FILE_NAME).c_str());
+        std::remove((m_directory + "/" + INDEX_FILE_NAME).c_str());
+        std::remove(m_directory.c_str());
+    }
+
+    const std::string m_directory{"/tmp/iox_record_replay_test"};
+    const capro::ServiceDescription m_service{"Radar", "FrontLeft", "Objects"};
+
+  private:
+    /// @brief uint64_t elements to fulfill the alignment of the ChunkHeader
+    std::vector<std::vector<uint64_t>> m_chunkMemory;
+};
+
+} // namespace iox_test_record_replay
+
+#endif // IOX_TOOLS_RECORD_REPLAY_TEST_RECORD_REPLAY_FIXTURE_HPP
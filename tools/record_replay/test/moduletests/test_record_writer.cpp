@@ -0,0 +1,150 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/record_writer.hpp"
+#include "test_record_replay_fixture.hpp"
+
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace iox_test_record_replay;
+
+class RecordWriter_test : public RecordReplay_test
+{
+  public:
+    bool segmentExists(const uint32_t segment)
+    {
+        return std::ifstream(segmentPath(m_directory, segment)).good();
+    }
+};
+
+TEST_F(RecordWriter_test, SkippingAllWrittenBytesLeavesNoVectors)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "caa8649d-6d83-42e2-b20e-f805398d7f63");
+    uint8_t data[16U];
+    struct iovec vectors[]{{data, 4U}, {data + 4U, 8U}, {data + 12U, 4U}};
+    struct iovec* remainingVectors = vectors;
+    int32_t numberOfVectors{3};
+
+    record_replay::internal::skipWrittenBytes(remainingVectors, numberOfVectors, 16U);
+
+    EXPECT_THAT(numberOfVectors, Eq(0));
+}
+
+TEST_F(RecordWriter_test, SkippingBytesUpToAVectorBoundaryLeavesTheFollowingVectorsUnchanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aacccf50-6b73-473f-bc37-daa797d306bf");
+    uint8_t data[16U];
+    struct iovec vectors[]{{data, 4U}, {data + 4U, 8U}, {data + 12U, 4U}};
+    struct iovec* remainingVectors = vectors;
+    int32_t numberOfVectors{3};
+
+    record_replay::internal::skipWrittenBytes(remainingVectors, numberOfVectors, 4U);
+
+    ASSERT_THAT(numberOfVectors, Eq(2));
+    EXPECT_THAT(remainingVectors, Eq(&vectors[1]));
+    EXPECT_THAT(remainingVectors->iov_base, Eq(static_cast<void*>(data + 4U)));
+    EXPECT_THAT(remainingVectors->iov_len, Eq(8U));
+}
+
+TEST_F(RecordWriter_test, SkippingBytesOfAPartialWriteAdjustsThePartiallyWrittenVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4161bf9-30ff-400a-ba1d-a6993ab78179");
+    uint8_t data[16U];
+    struct iovec vectors[]{{data, 4U}, {data + 4U, 8U}, {data + 12U, 4U}};
+    struct iovec* remainingVectors = vectors;
+    int32_t numberOfVectors{3};
+
+    record_replay::internal::skipWrittenBytes(remainingVectors, numberOfVectors, 6U);
+
+    ASSERT_THAT(numberOfVectors, Eq(2));
+    EXPECT_THAT(remainingVectors, Eq(&vectors[1]));
+    EXPECT_THAT(remainingVectors->iov_base, Eq(static_cast<void*>(data + 6U)));
+    EXPECT_THAT(remainingVectors->iov_len, Eq(6U));
+    EXPECT_THAT(vectors[2].iov_len, Eq(4U));
+}
+
+TEST_F(RecordWriter_test, CreatingWriterWithTooSmallSegmentSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5674d96-f8c7-46ab-9570-e7ae21583691");
+    auto writer = RecordWriter::create(m_directory, sizeof(SegmentHeader));
+
+    ASSERT_TRUE(writer.has_error());
+    EXPECT_THAT(writer.get_error(), Eq(RecordError::INVALID_SEGMENT_SIZE));
+}
+
+TEST_F(RecordWriter_test, RecordsAreWrittenToTheNextSegmentWhenTheCurrentOneIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de20c306-eeed-487a-9fb5-96e5de421087");
+    constexpr uint64_t RECORDS_PER_SEGMENT{2U};
+    auto writer = RecordWriter::create(m_directory, sizeof(SegmentHeader) + RECORDS_PER_SEGMENT * recordSize());
+    ASSERT_FALSE(writer.has_error());
+    auto topicId = writer->addTopic(m_service);
+    ASSERT_FALSE(topicId.has_error());
+
+    constexpr uint64_t NUMBER_OF_RECORDS{5U};
+    Record records[NUMBER_OF_RECORDS];
+    for (uint64_t i = 0U; i < NUMBER_OF_RECORDS; ++i)
+    {
+        records[i] = {i, topicId.value(), createChunk(static_cast<uint8_t>(i))};
+    }
+    ASSERT_FALSE(writer->write(records, NUMBER_OF_RECORDS).has_error());
+
+    EXPECT_TRUE(segmentExists(0U));
+    EXPECT_TRUE(segmentExists(1U));
+    EXPECT_TRUE(segmentExists(2U));
+    EXPECT_FALSE(segmentExists(3U));
+    EXPECT_THAT(writer->bytesWritten(), Eq(3U * sizeof(SegmentHeader) + NUMBER_OF_RECORDS * recordSize()));
+}
+
+TEST_F(RecordWriter_test, WritingRecordWhichExceedsTheSegmentSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d31b08c-9ce3-456b-9941-0bf7176dbff6");
+    auto writer = RecordWriter::create(m_directory, sizeof(SegmentHeader) + recordSize() - RECORD_ALIGNMENT);
+    ASSERT_FALSE(writer.has_error());
+    auto topicId = writer->addTopic(m_service);
+    ASSERT_FALSE(topicId.has_error());
+
+    Record record{0U, topicId.value(), createChunk(42U)};
+    auto result = writer->write(&record, 1U);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::RECORD_EXCEEDS_SEGMENT_SIZE));
+}
+
+TEST_F(RecordWriter_test, FailingToWriteTheIndexIsReportedWhenTheSegmentIsCompleted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99646a5f-9753-4472-85f1-884c04e45144");
+    // the writes to /dev/full fail with ENOSPC
+    ASSERT_THAT(mkdir(m_directory.c_str(), S_IRWXU), Eq(0));
+    ASSERT_THAT(symlink("/dev/full", (m_directory + "/" + INDEX_FILE_NAME).c_str()), Eq(0));
+
+    auto writer = RecordWriter::create(m_directory, sizeof(SegmentHeader) + recordSize());
+    ASSERT_FALSE(writer.has_error());
+    auto topicId = writer->addTopic(m_service);
+    ASSERT_FALSE(topicId.has_error());
+
+    Record records[]{{0U, topicId.value(), createChunk(13U)}, {1U, topicId.value(), createChunk(37U)}};
+    auto result = writer->write(records, 2U);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::UNABLE_TO_WRITE_FILE));
+}
+
+} // namespace